@@ -0,0 +1,111 @@
+// app/api/ai/generate/stream/route.ts
+// Streaming variant of the AI geometry route. Emits newline-delimited
+// JSON events: {type:"partial", intent} snapshots as the model writes,
+// then one {type:"complete", ...} with the same payload as the
+// non-streaming route. Clients speculatively compile the partials so
+// geometry appears at time-to-first-node instead of full generation.
+
+import { NextRequest, NextResponse } from 'next/server'
+import { streamGeometryFromIntent } from '@/lib/deepseek-client'
+import { generateMeshFromIntent, intentToWorkspaceObject } from '@/lib/geometry-generator'
+
+export async function POST(request: NextRequest) {
+  let body: any
+  try {
+    body = await request.json()
+  } catch {
+    return NextResponse.json(
+      { success: false, error: 'Invalid request body' },
+      { status: 400 }
+    )
+  }
+
+  const { intent, conversationHistory } = body
+
+  if (!intent || typeof intent !== 'string') {
+    return NextResponse.json(
+      { success: false, error: 'Intent is required and must be a string' },
+      { status: 400 }
+    )
+  }
+
+  const apiKey = process.env.DEEPSEEK_API_KEY
+  if (!apiKey) {
+    return NextResponse.json(
+      { success: false, error: 'AI geometry generation is not configured. Please set DEEPSEEK_API_KEY.' },
+      { status: 503 }
+    )
+  }
+
+  const encoder = new TextEncoder()
+
+  const stream = new ReadableStream<Uint8Array>({
+    start: async (controller) => {
+      const send = (event: Record<string, unknown>) => {
+        controller.enqueue(encoder.encode(JSON.stringify(event) + '\n'))
+      }
+
+      try {
+        const deepseekResult = await streamGeometryFromIntent(
+          intent,
+          (partialIntent) => {
+            send({ type: 'partial', intent: partialIntent })
+          },
+          conversationHistory
+        )
+
+        if (deepseekResult.error) {
+          send({ type: 'error', error: deepseekResult.error })
+          controller.close()
+          return
+        }
+
+        // Same finalization as the non-streaming route
+        const geometryResult = generateMeshFromIntent(deepseekResult.intent)
+
+        if (!geometryResult.success) {
+          send({
+            type: 'error',
+            error: geometryResult.errors?.join(', ') || 'Failed to generate geometry',
+          })
+          controller.close()
+          return
+        }
+
+        const workspaceObject = intentToWorkspaceObject(deepseekResult.intent, geometryResult.geometry?.id)
+
+        send({
+          type: 'complete',
+          intent: deepseekResult.intent,
+          geometry: {
+            id: geometryResult.geometry?.id,
+            type: geometryResult.geometry?.type,
+            dimensions: geometryResult.geometry?.dimensions,
+            features: geometryResult.geometry?.features,
+            material: geometryResult.geometry?.material,
+            volume: geometryResult.geometry?.volume,
+            boundingBox: geometryResult.geometry?.boundingBox,
+          },
+          workspaceObject,
+          conversationHistory: deepseekResult.conversationHistory,
+          warnings: geometryResult.warnings,
+        })
+        controller.close()
+      } catch (error) {
+        console.error('AI geometry stream error:', error)
+        send({
+          type: 'error',
+          error: error instanceof Error ? error.message : 'Unknown error',
+        })
+        controller.close()
+      }
+    },
+  })
+
+  return new Response(stream, {
+    headers: {
+      'Content-Type': 'application/x-ndjson; charset=utf-8',
+      'Cache-Control': 'no-cache, no-transform',
+    },
+  })
+}
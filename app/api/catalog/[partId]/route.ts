@@ -3,10 +3,7 @@
 
 import { NextResponse } from 'next/server';
 import { supabase } from '@/lib/supabaseClient';
-import { CATALOG_PARTS } from '@/lib/catalog-data';
-
-// Create a map of parts by ID for fast lookup
-const catalogPartsMap = new Map(CATALOG_PARTS.map((part) => [part.id, part]));
+import { findPartById } from '@/lib/catalog/parts';
 
 // Legacy sample parts for backwards compatibility
 // eslint-disable-next-line @typescript-eslint/no-explicit-any
@@ -226,7 +223,8 @@ export async function GET(
 
   // Try catalog parts map first
   if (!part) {
-    const catalogPart = catalogPartsMap.get(partId);
+    // Lazy chunked lookup: loads part chunks on first use, memoized
+    const catalogPart = await findPartById(partId);
     if (catalogPart) {
       // Transform catalog part to include expected fields for detail view
       part = {
@@ -0,0 +1,39 @@
+// app/api/catalog/quote/route.ts
+// Batch quote API: prices a list of (partId, material, quantity) tuples
+// in one request so the catalog page does not fire one round trip per
+// visible card. Shares the memoized pricing in lib/quote/catalog-quote.
+
+import { NextResponse } from 'next/server'
+import { quoteCatalogParts, type CatalogQuoteItem } from '@/lib/quote/catalog-quote'
+
+const MAX_BATCH_ITEMS = 100
+
+export async function POST(request: Request) {
+  try {
+    const body = await request.json()
+    const items = body?.items
+
+    if (!Array.isArray(items) || items.length === 0) {
+      return NextResponse.json(
+        { error: 'Request body must contain a non-empty items array' },
+        { status: 400 }
+      )
+    }
+    if (items.length > MAX_BATCH_ITEMS) {
+      return NextResponse.json(
+        { error: `Batch size exceeds ${MAX_BATCH_ITEMS} items` },
+        { status: 400 }
+      )
+    }
+    if (!items.every((item: CatalogQuoteItem) => typeof item?.partId === 'string')) {
+      return NextResponse.json(
+        { error: 'Every item must have a partId' },
+        { status: 400 }
+      )
+    }
+
+    return NextResponse.json({ quotes: await quoteCatalogParts(items) })
+  } catch (error) {
+    return NextResponse.json({ error: 'Invalid request' }, { status: 400 })
+  }
+}
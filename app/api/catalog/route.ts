@@ -3,9 +3,8 @@
 
 import { NextResponse } from 'next/server';
 import { supabase } from '@/lib/supabaseClient';
-import { CATALOG_PARTS, type CategoryId } from '@/lib/catalog-data';
-
-const sampleCatalogItems = CATALOG_PARTS;
+import type { CatalogPart, CategoryId } from '@/lib/catalog/categories';
+import { loadAllParts, loadPartsForCategory } from '@/lib/catalog/parts';
 
 // Legacy sample data for backwards compatibility (kept for reference)
 const _legacySampleItems = [
@@ -128,7 +127,7 @@ export async function GET(request: Request) {
   const offset = parseInt(searchParams.get('offset') || '0');
   const useDatabase = searchParams.get('db') !== 'false';
 
-  let items: typeof CATALOG_PARTS = [];
+  let items: CatalogPart[] = [];
   let total = 0;
   let dbSource = false;
 
@@ -186,7 +185,15 @@ export async function GET(request: Request) {
   }
 
   if (!dbSource) {
-    let filtered = [...sampleCatalogItems];
+    // Category-scoped requests touch one lazy chunk; search and
+    // unfiltered listings need the whole library
+    const categoriesParam = searchParams.get('categories');
+    let filtered: CatalogPart[];
+    if (category && category !== 'all' && !search) {
+      filtered = [...(await loadPartsForCategory(category as CategoryId))];
+    } else {
+      filtered = await loadAllParts();
+    }
 
     // Handle search query
     if (search) {
@@ -206,7 +213,6 @@ export async function GET(request: Request) {
       filtered = filtered.filter((item) => item.category === category);
     }
 
-    const categoriesParam = searchParams.get('categories');
     if (categoriesParam) {
       const categories = categoriesParam.split(',') as CategoryId[];
       filtered = filtered.filter((item) => categories.includes(item.category));
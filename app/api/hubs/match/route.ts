@@ -1,8 +1,14 @@
 // app/api/hubs/match/route.ts
 // Hub matching API with database-backed queries
+//
+// The hub table is fetched once per TTL and served from the warm
+// geospatial/capability index in lib/hubs/hub-index, so a match request
+// does bitset filters plus a ring-bounded distance query instead of a
+// linear scan per checkout.
 
 import { NextResponse } from "next/server"
 import { supabase } from "@/lib/supabaseClient"
+import { getHubIndex, type HubRecord } from "@/lib/hubs/hub-index"
 
 const sampleHubs = [
   {
@@ -72,42 +78,51 @@ const sampleHubs = [
   },
 ]
 
-export async function POST(request: Request) {
-  try {
-    const body = await request.json()
-    const { partId, material, process, quantity, leadTimeRequirement } = body
+// Full hub table cached across requests; the index filters in memory,
+// so per-request database round trips disappear from the hot path
+const HUBS_CACHE_TTL_MS = 5 * 60 * 1000
+let hubsCache: { hubs: HubRecord[]; dbSource: boolean; expiresAt: number } | null = null
 
-    let hubs: any[] = []
-    let dbSource = false
+async function loadHubs(): Promise<{ hubs: HubRecord[]; dbSource: boolean }> {
+  if (hubsCache && hubsCache.expiresAt > Date.now()) {
+    return hubsCache
+  }
 
-    try {
-      let query = supabase.from("hubs").select("*")
+  let hubs: HubRecord[] = []
+  let dbSource = false
 
-      if (process) {
-        query = query.contains("capabilities", [process])
-      }
+  try {
+    const { data, error } = await supabase.from("hubs").select("*")
+    if (!error && data && data.length > 0) {
+      hubs = data
+      dbSource = true
+    }
+  } catch (dbError) {
+    console.warn("Database not available, using sample data:", dbError)
+  }
 
-      if (material) {
-        query = query.contains("materials", [material])
-      }
+  if (!dbSource) {
+    hubs = sampleHubs
+  }
 
-      const { data, error } = await query
+  hubsCache = { hubs, dbSource, expiresAt: Date.now() + HUBS_CACHE_TTL_MS }
+  return hubsCache
+}
 
-      if (!error && data && data.length > 0) {
-        hubs = data
-        dbSource = true
-      }
-    } catch (dbError) {
-      console.warn("Database not available, using sample data:", dbError)
-    }
+export async function POST(request: Request) {
+  try {
+    const body = await request.json()
+    const { partId, material, process, quantity, leadTimeRequirement, location } = body
 
-    if (!dbSource) {
-      hubs = sampleHubs.filter((hub) => {
-        const hasProcess = !process || hub.capabilities.some((c: string) => c.toLowerCase().includes(process.toLowerCase()))
-        const hasMaterial = !material || hub.materials.some((m: string) => m.toLowerCase().includes(material.toLowerCase()))
-        return hasProcess && hasMaterial
-      })
-    }
+    const { hubs: allHubs, dbSource } = await loadHubs()
+    const index = getHubIndex(allHubs, dbSource ? "database" : "sample")
+
+    const origin =
+      location && typeof location.lat === "number" && typeof location.lng === "number"
+        ? { lat: location.lat, lng: location.lng }
+        : undefined
+
+    const matches = index.match({ process, material, origin })
 
     const weights = {
       compatibility: 0.5,
@@ -116,15 +131,18 @@ export async function POST(request: Request) {
       rating: 0.1,
     }
 
-    const scoredHubs = hubs.map((hub) => {
-      const hasProcess = !process || hub.capabilities?.some((c: string) => c.toLowerCase().includes(process.toLowerCase()))
-      const hasMaterial = !material || hub.materials?.some((m: string) => m.toLowerCase().includes(material.toLowerCase()))
+    const scoredHubs = matches.map(({ hub, distanceKm }) => {
+      // Matches already passed the bitset capability filter
+      const hasProcess = true
+      const hasMaterial = true
       const compatibilityScore = (hasProcess ? 0.5 : 0) + (hasMaterial ? 0.5 : 0)
 
-      const currentLoad = hub.currentLoad ?? hub.avgLeadTime ? hub.avgLeadTime / 10 : 0.5
+      const currentLoad = hub.currentLoad ?? (hub.avgLeadTime ? hub.avgLeadTime / 10 : 0.5)
       const loadScore = 1 - currentLoad
 
-      const distanceScore = 0.8
+      // Real distance when the request carries an origin; the old
+      // neutral constant otherwise
+      const distanceScore = distanceKm !== null ? Math.max(0, 1 - distanceKm / 20000) : 0.8
 
       const rating = hub.rating ?? 4.5
       const ratingScore = rating / 5
@@ -147,7 +165,9 @@ export async function POST(request: Request) {
       return {
         hubId: hub.id,
         hubName: hub.name,
-        hubLocation: hub.location?.city || hub.location || "Unknown",
+        hubLocation:
+          typeof hub.location === "string" ? hub.location : hub.location?.city || "Unknown",
+        distanceKm: distanceKm !== null ? Math.round(distanceKm) : null,
         rating: rating,
         completedJobs: hub.completedJobs || 0,
         certified: hub.certified ?? true,
@@ -88,6 +88,7 @@ export async function PATCH(request: Request, { params }: { params: Promise<{ jo
       key: jobKey(user.id, jobId),
       body: JSON.stringify(updated, null, 2),
       contentType: "application/json",
+      compress: true,
     })
 
     return NextResponse.json(updated)
@@ -63,6 +63,7 @@ export async function POST(req: Request) {
       key: `${user.id}/${jobId}.json`,
       body: JSON.stringify(job, null, 2),
       contentType: "application/json",
+      compress: true,
     })
 
     return NextResponse.json({ jobId }, { status: 200 })
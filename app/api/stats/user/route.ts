@@ -1,54 +1,93 @@
 // app/api/stats/user/route.ts
 // User-specific statistics endpoint
+//
+// Reads the user's row from the trigger-maintained user_stats rollup
+// (see complete_schema.sql, update_user_stats) instead of counting the
+// projects/jobs tables per request. The row's updated_at is used as an
+// ETag so unchanged stats revalidate with a 304.
 
 import { NextResponse } from "next/server"
 import { supabase } from "@/lib/supabaseClient"
 import { cookies } from "next/headers"
 
-export async function GET() {
+export async function GET(request: Request) {
   try {
     const cookieStore = cookies()
     const supabaseAccessToken = cookieStore.get("sb-access-token")?.value
-    
+
     if (!supabaseAccessToken) {
       return NextResponse.json({ error: "Unauthorized" }, { status: 401 })
     }
 
     // Get user from token
     const { data: { user }, error: authError } = await supabase.auth.getUser(supabaseAccessToken)
-    
+
     if (authError || !user) {
       return NextResponse.json({ error: "Unauthorized" }, { status: 401 })
     }
 
-    // Get user's projects count
-    const { count: projectsCount, error: projectsError } = await supabase
-      .from("projects")
-      .select("*", { count: "exact", head: true })
+    // Fast path: single-row read from the user_stats rollup
+    const { data: rollup, error: rollupError } = await supabase
+      .from("user_stats")
+      .select("total_projects, total_completed_jobs, updated_at")
       .eq("user_id", user.id)
+      .single()
 
-    // Get user's completed jobs count
-    const { count: jobsCount, error: jobsError } = await supabase
-      .from("jobs")
-      .select("*", { count: "exact", head: true })
-      .eq("user_id", user.id)
-      .eq("status", "completed")
+    let totalProjects: number
+    let totalCompletedJobs: number
+    let etag: string | null = null
+
+    if (!rollupError && rollup) {
+      totalProjects = rollup.total_projects || 0
+      totalCompletedJobs = rollup.total_completed_jobs || 0
+      etag = `"user-${user.id}-${rollup.updated_at ?? "0"}"`
+    } else {
+      // No rollup row yet (user predates the stats triggers): count
+      // directly, as this endpoint always did
+      const { count: projectsCount, error: projectsError } = await supabase
+        .from("projects")
+        .select("*", { count: "exact", head: true })
+        .eq("user_id", user.id)
 
-    if (projectsError || jobsError) {
-      throw new Error("Failed to fetch user statistics")
+      const { count: jobsCount, error: jobsError } = await supabase
+        .from("jobs")
+        .select("*", { count: "exact", head: true })
+        .eq("user_id", user.id)
+        .eq("status", "completed")
+
+      if (projectsError || jobsError) {
+        throw new Error("Failed to fetch user statistics")
+      }
+
+      totalProjects = projectsCount || 0
+      totalCompletedJobs = jobsCount || 0
     }
 
-    return NextResponse.json({
+    if (etag && request.headers.get("if-none-match") === etag) {
+      return new Response(null, {
+        status: 304,
+        headers: { ETag: etag, "Cache-Control": "private, no-cache" },
+      })
+    }
+
+    const response = NextResponse.json({
       userId: user.id,
       email: user.email,
-      totalProjects: projectsCount || 0,
-      totalCompletedJobs: jobsCount || 0,
+      totalProjects,
+      totalCompletedJobs,
       accountCreated: user.created_at,
       source: "database"
     })
+
+    if (etag) {
+      response.headers.set("ETag", etag)
+      response.headers.set("Cache-Control", "private, no-cache")
+    }
+
+    return response
   } catch (error) {
     console.error("Error fetching user stats:", error)
-    
+
     // Fallback to sample data if database fails
     return NextResponse.json({
       userId: "sample-user-id",
@@ -59,4 +98,4 @@ export async function GET() {
       source: "sample"
     })
   }
-}
\ No newline at end of file
+}
@@ -17,7 +17,7 @@ import {
   CATALOG_CATEGORIES,
   type CatalogPart,
   type CategoryId,
-} from '@/lib/catalog-data';
+} from '@/lib/catalog/categories';
 import {
   ALL_MATERIALS,
   ALL_FINISHES,
@@ -8,10 +8,16 @@ import * as THREE from "three"
 import { OrbitControls } from "three/examples/jsm/controls/OrbitControls.js"
 import {
   generateMesh,
+  disposeGeneratedMesh,
   workspaceObjectToMeshInput,
   type MeshGeneratorInput,
 } from "@/lib/mesh-generator"
-import { setCanvasScene } from "@/lib/canvas-utils"
+import { setCanvasScene, setCanvasRenderBridge } from "@/lib/canvas-utils"
+import {
+  RenderWorkerClient,
+  isRenderWorkerSupported,
+  type RenderObjectRecord,
+} from "@/lib/render-worker-client"
 import { useIsMobile } from "@/hooks/use-media-query"
 import type { WorkspaceObject } from "@/hooks/use-workspace"
 import { useWorkspaceKernelResult } from "@/hooks/use-workspace-kernel"
@@ -52,24 +58,9 @@ function getGeometryKey(obj: WorkspaceObject): string {
   return `${obj.type}|${getDimensionsKey(obj.dimensions)}|${meshKey}`
 }
 
-function disposeMesh(mesh: THREE.Mesh): void {
-  mesh.traverse((child) => {
-    const childMesh = child as THREE.Mesh
-
-    if (childMesh.geometry) {
-      childMesh.geometry.dispose()
-    }
-
-    const material = childMesh.material
-    if (!material) return
-
-    if (Array.isArray(material)) {
-      material.forEach((m) => m.dispose())
-    } else {
-      material.dispose()
-    }
-  })
-}
+// Pool-aware disposal: pooled geometry is released (shared with other
+// objects showing the same part), everything else disposed outright
+const disposeMesh = disposeGeneratedMesh
 
 function getOrCreateEdgesMesh(mesh: THREE.Mesh): THREE.LineSegments {
   const existing = mesh.userData.edgesMesh as THREE.LineSegments | undefined
@@ -130,6 +121,12 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
   const controlsRef = useRef<OrbitControls | null>(null)
   const gridRef = useRef<THREE.GridHelper | null>(null)
 
+  // OffscreenCanvas path: rendering and picking live in the render
+  // worker; rendererRef/sceneRef stay null and only the camera (driven
+  // by OrbitControls, which needs DOM events) remains on this thread.
+  const renderClientRef = useRef<RenderWorkerClient | null>(null)
+  const canvasElRef = useRef<HTMLCanvasElement | null>(null)
+
   const hoveredIdRef = useRef<string | null>(null)
   const isOrbitingRef = useRef(false)
 
@@ -156,7 +153,8 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
         const renderer = rendererRef.current
         const scene = sceneRef.current
         const camera = cameraRef.current
-        if (!renderer || !scene || !camera) {
+        const client = renderClientRef.current
+        if (!camera || (!client && (!renderer || !scene))) {
           isLoopRunningRef.current = false
           return
         }
@@ -179,7 +177,17 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
           last.quaternion.copy(camera.quaternion)
           last.zoom = camera.zoom
 
-          renderer.render(scene, camera)
+          if (client) {
+            // The worker renders on its own schedule; we only need to
+            // forward the pose when it actually changed
+            client.setCamera(
+              camera.position.toArray() as [number, number, number],
+              camera.quaternion.toArray() as [number, number, number, number],
+              camera.zoom
+            )
+          } else {
+            renderer!.render(scene!, camera)
+          }
           renderRequestedRef.current = false
           idleFramesRef.current = 0
         } else {
@@ -201,6 +209,14 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
 
   const applyMeshVisualState = useCallback(
     (meshId: string) => {
+      // Worker mode: the worker owns the materials and recomputes
+      // selection/hover state from its object records
+      const client = renderClientRef.current
+      if (client) {
+        client.setVisual(hoveredIdRef.current)
+        return
+      }
+
       const mesh = meshRefs.current.get(meshId)
       if (!mesh) return
 
@@ -239,10 +255,37 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
   )
 
   const fitCameraToObjects = () => {
-    if (!cameraRef.current || !controlsRef.current || meshRefs.current.size === 0) return
+    if (!cameraRef.current || !controlsRef.current) return
 
     const camera = cameraRef.current
     const controls = controlsRef.current
+
+    // Worker mode: the meshes (and their bounds) live worker-side
+    const client = renderClientRef.current
+    if (client) {
+      client
+        .fitView()
+        .then((bounds) => {
+          if (!bounds) return
+
+          const [cx, cy, cz] = bounds.center
+          const fov = camera.fov * (Math.PI / 180)
+          let cameraZ = Math.abs(bounds.maxDim / 2 / Math.tan(fov / 2))
+          cameraZ *= 1.5
+
+          camera.position.set(cx + cameraZ * 0.5, cy + cameraZ * 0.5, cz + cameraZ * 0.5)
+          controls.target.set(cx, cy, cz)
+          controls.update()
+
+          requestRender()
+          if (onFitView) onFitView()
+        })
+        .catch(() => {})
+      return
+    }
+
+    if (meshRefs.current.size === 0) return
+
     const box = new THREE.Box3()
 
     meshRefs.current.forEach((mesh) => {
@@ -301,16 +344,28 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
     }
   }
 
+  // Async because worker-mode picking is a round trip to the render
+  // worker; the local path resolves immediately
   const pickObjectAt = useCallback(
-    (clientX: number, clientY: number): string | null => {
+    async (clientX: number, clientY: number): Promise<string | null> => {
       const camera = cameraRef.current
-      const renderer = rendererRef.current
-      if (!camera || !renderer) return null
+      const canvas = canvasElRef.current
+      if (!camera || !canvas) return null
 
-      const rect = renderer.domElement.getBoundingClientRect()
-      mouse.current.x = ((clientX - rect.left) / rect.width) * 2 - 1
-      mouse.current.y = -((clientY - rect.top) / rect.height) * 2 + 1
+      const rect = canvas.getBoundingClientRect()
+      const ndcX = ((clientX - rect.left) / rect.width) * 2 - 1
+      const ndcY = -((clientY - rect.top) / rect.height) * 2 + 1
+
+      const client = renderClientRef.current
+      if (client) {
+        try {
+          return await client.pick(ndcX, ndcY)
+        } catch {
+          return null
+        }
+      }
 
+      mouse.current.set(ndcX, ndcY)
       raycaster.current.setFromCamera(mouse.current, camera)
 
       const intersects = raycaster.current.intersectObjects(pickableMeshesRef.current, true)
@@ -334,30 +389,30 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
     (event: MouseEvent) => {
       event.preventDefault()
 
-      const objectId = pickObjectAt(event.clientX, event.clientY)
-
-      let actions: any[] = []
-
-      if (objectId) {
-        actions = [
-          { label: "Delete", icon: "trash", objectId },
-          { label: "Duplicate", icon: "copy", objectId },
-          { label: "Properties", icon: "settings", objectId },
-          { divider: true },
-          { label: "Hide", icon: "eye-off", objectId },
-          { label: "Lock", icon: "lock", objectId },
-        ]
-      } else {
-        actions = [
-          { label: "Paste", icon: "clipboard", disabled: true },
-          { label: "Select All", icon: "select-all" },
-          { divider: true },
-          { label: "Fit View", icon: "maximize" },
-          { label: "Clear All", icon: "trash" },
-        ]
-      }
+      void pickObjectAt(event.clientX, event.clientY).then((objectId) => {
+        let actions: any[] = []
+
+        if (objectId) {
+          actions = [
+            { label: "Delete", icon: "trash", objectId },
+            { label: "Duplicate", icon: "copy", objectId },
+            { label: "Properties", icon: "settings", objectId },
+            { divider: true },
+            { label: "Hide", icon: "eye-off", objectId },
+            { label: "Lock", icon: "lock", objectId },
+          ]
+        } else {
+          actions = [
+            { label: "Paste", icon: "clipboard", disabled: true },
+            { label: "Select All", icon: "select-all" },
+            { divider: true },
+            { label: "Fit View", icon: "maximize" },
+            { label: "Clear All", icon: "trash" },
+          ]
+        }
 
-      onContextMenu?.({ x: event.clientX, y: event.clientY }, actions)
+        onContextMenu?.({ x: event.clientX, y: event.clientY }, actions)
+      })
     },
     [onContextMenu, pickObjectAt]
   )
@@ -384,56 +439,90 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
       isMobile: isMobileView
     })
 
-    const scene = new THREE.Scene()
-    scene.background = new THREE.Color(0xf5f5f5)
-
-    setCanvasScene(scene)
-    sceneRef.current = scene
+    const width = mountRef.current.clientWidth
+    const height = mountRef.current.clientHeight
+    const pixelRatio = Math.min(window.devicePixelRatio, isMobileView ? 1.5 : 2)
 
-    const camera = new THREE.PerspectiveCamera(
-      50,
-      mountRef.current.clientWidth / mountRef.current.clientHeight,
-      0.1,
-      10000
-    )
+    const camera = new THREE.PerspectiveCamera(50, width / height, 0.1, 10000)
     camera.position.set(70, 70, 70)
     camera.lookAt(0, 0, 0)
     cameraRef.current = camera
 
     console.log('📷 Camera positioned at:', camera.position)
 
-    const renderer = new THREE.WebGLRenderer({ antialias: true, powerPreference: "high-performance" })
-    renderer.setSize(mountRef.current.clientWidth, mountRef.current.clientHeight)
-    renderer.setPixelRatio(Math.min(window.devicePixelRatio, isMobileView ? 1.5 : 2))
-    renderer.shadowMap.enabled = true
-    renderer.outputColorSpace = THREE.SRGBColorSpace
-
-    mountRef.current.appendChild(renderer.domElement)
-    rendererRef.current = renderer
-
-    console.log('🎨 Renderer created, pixel ratio:', window.devicePixelRatio)
-
-    const directionalLight = new THREE.DirectionalLight(0xffffff, 1)
-    directionalLight.position.set(50, 50, 50)
-    directionalLight.castShadow = true
-    directionalLight.shadow.mapSize.width = isMobileView ? 512 : 1024
-    directionalLight.shadow.mapSize.height = isMobileView ? 512 : 1024
-    scene.add(directionalLight)
-
-    const ambientLight = new THREE.AmbientLight(0xffffff, 0.5)
-    scene.add(ambientLight)
+    const useWorker = isRenderWorkerSupported()
+    let scene: THREE.Scene | null = null
+    let renderer: THREE.WebGLRenderer | null = null
+    let client: RenderWorkerClient | null = null
+    let canvasEl: HTMLCanvasElement
+
+    if (useWorker) {
+      // Worker path: the scene, renderer and picking live in the render
+      // worker; this thread keeps only the camera for OrbitControls.
+      canvasEl = document.createElement("canvas")
+      canvasEl.style.width = "100%"
+      canvasEl.style.height = "100%"
+      canvasEl.style.display = "block"
+      canvasEl.width = width
+      canvasEl.height = height
+      mountRef.current.appendChild(canvasEl)
+
+      client = new RenderWorkerClient()
+      renderClientRef.current = client
+      client
+        .init(canvasEl, { width, height, pixelRatio, showGrid, isMobile: isMobileView })
+        .catch((error) => {
+          console.error('❌ Render worker initialization failed:', error)
+        })
+
+      // Meshes streamed from outside the viewer (AI geometry,
+      // progressive LOD) have no main-thread scene to land in
+      setCanvasRenderBridge(client)
+
+      console.log('🧵 Viewport rendering moved to OffscreenCanvas worker')
+    } else {
+      scene = new THREE.Scene()
+      scene.background = new THREE.Color(0xf5f5f5)
 
-    const grid = new THREE.GridHelper(100, 20, 0xcccccc, 0xe0e0e0)
-    grid.visible = showGrid
-    gridRef.current = grid
-    scene.add(grid)
+      setCanvasScene(scene)
+      sceneRef.current = scene
 
-    if (!isMobileView) {
-      const axesHelper = new THREE.AxesHelper(20)
-      scene.add(axesHelper)
+      renderer = new THREE.WebGLRenderer({ antialias: true, powerPreference: "high-performance" })
+      renderer.setSize(width, height)
+      renderer.setPixelRatio(pixelRatio)
+      renderer.shadowMap.enabled = true
+      renderer.outputColorSpace = THREE.SRGBColorSpace
+
+      mountRef.current.appendChild(renderer.domElement)
+      rendererRef.current = renderer
+      canvasEl = renderer.domElement
+
+      console.log('🎨 Renderer created, pixel ratio:', window.devicePixelRatio)
+
+      const directionalLight = new THREE.DirectionalLight(0xffffff, 1)
+      directionalLight.position.set(50, 50, 50)
+      directionalLight.castShadow = true
+      directionalLight.shadow.mapSize.width = isMobileView ? 512 : 1024
+      directionalLight.shadow.mapSize.height = isMobileView ? 512 : 1024
+      scene.add(directionalLight)
+
+      const ambientLight = new THREE.AmbientLight(0xffffff, 0.5)
+      scene.add(ambientLight)
+
+      const grid = new THREE.GridHelper(100, 20, 0xcccccc, 0xe0e0e0)
+      grid.visible = showGrid
+      gridRef.current = grid
+      scene.add(grid)
+
+      if (!isMobileView) {
+        const axesHelper = new THREE.AxesHelper(20)
+        scene.add(axesHelper)
+      }
     }
 
-    const controls = new OrbitControls(camera, renderer.domElement)
+    canvasElRef.current = canvasEl
+
+    const controls = new OrbitControls(camera, canvasEl)
     controls.enableDamping = true
     controls.dampingFactor = 0.05
     controls.enablePan = !isMobileView
@@ -462,18 +551,27 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
     const ro = new ResizeObserver(() => {
       const container = mountRef.current
       const camera = cameraRef.current
-      const renderer = rendererRef.current
-      if (!container || !camera || !renderer) return
+      if (!container || !camera) return
 
       const width = container.clientWidth
       const height = container.clientHeight
       if (width === 0 || height === 0) return
 
+      // The main-thread camera drives the worker's raycasts and sketch
+      // plane math, so its aspect stays in sync on both paths
       camera.aspect = width / height
       camera.updateProjectionMatrix()
 
-      renderer.setSize(width, height)
-      renderer.setPixelRatio(Math.min(window.devicePixelRatio, isMobileView ? 1.5 : 2))
+      const nextPixelRatio = Math.min(window.devicePixelRatio, isMobileView ? 1.5 : 2)
+
+      const client = renderClientRef.current
+      const renderer = rendererRef.current
+      if (client) {
+        client.resize(width, height, nextPixelRatio)
+      } else if (renderer) {
+        renderer.setSize(width, height)
+        renderer.setPixelRatio(nextPixelRatio)
+      }
 
       console.log('📏 Canvas resized to:', width, 'x', height)
       requestRender()
@@ -489,34 +587,43 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
       controls.dispose()
       controlsRef.current = null
 
-      setCanvasScene(null)
-
       if (animationFrameRef.current) {
         cancelAnimationFrame(animationFrameRef.current)
         animationFrameRef.current = null
       }
       isLoopRunningRef.current = false
 
-      meshRefs.current.forEach((mesh) => {
-        scene.remove(mesh)
-        disposeMesh(mesh)
-      })
-      meshRefs.current.clear()
-      pickableMeshesRef.current = []
+      if (client) {
+        setCanvasRenderBridge(null)
+        client.destroy()
+        renderClientRef.current = null
+      }
 
-      renderer.dispose()
-      if (mountRef.current) {
-        mountRef.current.removeChild(renderer.domElement)
+      if (scene) {
+        setCanvasScene(null)
+
+        meshRefs.current.forEach((mesh) => {
+          scene!.remove(mesh)
+          disposeMesh(mesh)
+        })
+        meshRefs.current.clear()
+        pickableMeshesRef.current = []
+      }
+
+      renderer?.dispose()
+      if (mountRef.current && canvasEl.parentNode === mountRef.current) {
+        mountRef.current.removeChild(canvasEl)
       }
 
       rendererRef.current = null
       cameraRef.current = null
       sceneRef.current = null
+      canvasElRef.current = null
     }
   }, [isMobileView, requestRender])
 
   useEffect(() => {
-    const canvas = rendererRef.current?.domElement
+    const canvas = canvasElRef.current
     if (!canvas) return
 
     const handlePointerDown = (event: PointerEvent) => {
@@ -537,28 +644,39 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
 
       if (distSq > 9 || isOrbitingRef.current) return
 
-      const pickedId = pickObjectAt(event.clientX, event.clientY)
-      onObjectSelect?.(pickedId)
+      void pickObjectAt(event.clientX, event.clientY).then((pickedId) => {
+        onObjectSelect?.(pickedId)
+      })
     }
 
     let hoverRaf: number | null = null
+    let hoverPickInFlight = false
     const handlePointerMove = (event: PointerEvent) => {
       if (activeTool !== "select" || isOrbitingRef.current) return
 
-      if (hoverRaf) return
+      // The in-flight guard keeps worker-mode pick round trips from
+      // stacking up behind a slow frame
+      if (hoverRaf || hoverPickInFlight) return
       hoverRaf = requestAnimationFrame(() => {
         hoverRaf = null
+        hoverPickInFlight = true
 
-        const nextHoveredId = pickObjectAt(event.clientX, event.clientY)
-        const prevHoveredId = hoveredIdRef.current
+        pickObjectAt(event.clientX, event.clientY)
+          .then((nextHoveredId) => {
+            hoverPickInFlight = false
 
-        if (nextHoveredId === prevHoveredId) return
+            const prevHoveredId = hoveredIdRef.current
+            if (nextHoveredId === prevHoveredId) return
 
-        hoveredIdRef.current = nextHoveredId
-        if (prevHoveredId) applyMeshVisualState(prevHoveredId)
-        if (nextHoveredId) applyMeshVisualState(nextHoveredId)
+            hoveredIdRef.current = nextHoveredId
+            if (prevHoveredId) applyMeshVisualState(prevHoveredId)
+            if (nextHoveredId) applyMeshVisualState(nextHoveredId)
 
-        requestRender()
+            requestRender()
+          })
+          .catch(() => {
+            hoverPickInFlight = false
+          })
       })
     }
 
@@ -589,6 +707,13 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
   }, [activeTool, applyMeshVisualState, handleCanvasRightClick, onObjectSelect, pickObjectAt, requestRender])
 
   useEffect(() => {
+    const client = renderClientRef.current
+    if (client) {
+      client.setGrid(showGrid)
+      requestRender()
+      return
+    }
+
     if (gridRef.current) {
       gridRef.current.visible = showGrid
       requestRender()
@@ -596,6 +721,26 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
   }, [requestRender, showGrid])
 
   useEffect(() => {
+    // Worker mode: ship serializable object records; the worker runs
+    // the same generateMesh/geometryKey diffing on its side
+    const client = renderClientRef.current
+    if (client) {
+      const records: RenderObjectRecord[] = Object.entries(workspaceObjects).map(
+        ([id, objectData]) => ({
+          id,
+          geometryKey: getGeometryKey(objectData),
+          input: { ...workspaceObjectToMeshInput(objectData), selected: false },
+          visible: objectData.visible !== false,
+          selected: Boolean(objectData.selected || id === selectedObjectId),
+          color: objectData.color,
+        })
+      )
+
+      client.syncObjects(records, hoveredIdRef.current)
+      requestRender()
+      return
+    }
+
     const scene = sceneRef.current
     if (!scene) return
 
@@ -687,6 +832,7 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
       setIsSketchMode(false)
       // Clear sketch points when switching away from sketch tool
       setSketchPoints([])
+      renderClientRef.current?.clearSketch()
       sketchLines.forEach(line => {
         line.geometry.dispose()
         line.material.dispose()
@@ -697,7 +843,7 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
 
   // Add sketch click handler
   useEffect(() => {
-    const canvas = rendererRef.current?.domElement
+    const canvas = canvasElRef.current
     if (!canvas || !isSketchMode) return
 
     const handleSketchClick = (event: MouseEvent) => {
@@ -731,18 +877,29 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
         
         // Draw line from previous point
         if (sketchPoints.length > 0) {
-          const scene = sceneRef.current
-          if (scene) {
-            const prevPoint = sketchPoints[sketchPoints.length - 1]
-            const points = [
-              new THREE.Vector3(prevPoint.x, prevPoint.y, prevPoint.z),
-              new THREE.Vector3(newPoint.x, newPoint.y, newPoint.z)
-            ]
-            const geometry = new THREE.BufferGeometry().setFromPoints(points)
-            const material = new THREE.LineBasicMaterial({ color: 0x2a2a72 })
-            const line = new THREE.Line(geometry, material)
-            scene.add(line)
-            setSketchLines([...sketchLines, line])
+          const prevPoint = sketchPoints[sketchPoints.length - 1]
+          const client = renderClientRef.current
+
+          if (client) {
+            // Worker mode: the line lives in the worker's scene and is
+            // cleared via clearSketch
+            client.addSketchLine(
+              [prevPoint.x, prevPoint.y, prevPoint.z],
+              [newPoint.x, newPoint.y, newPoint.z]
+            )
+          } else {
+            const scene = sceneRef.current
+            if (scene) {
+              const points = [
+                new THREE.Vector3(prevPoint.x, prevPoint.y, prevPoint.z),
+                new THREE.Vector3(newPoint.x, newPoint.y, newPoint.z)
+              ]
+              const geometry = new THREE.BufferGeometry().setFromPoints(points)
+              const material = new THREE.LineBasicMaterial({ color: 0x2a2a72 })
+              const line = new THREE.Line(geometry, material)
+              scene.add(line)
+              setSketchLines([...sketchLines, line])
+            }
           }
         }
       }
@@ -757,9 +914,10 @@ export const CanvasViewer: React.FC<CanvasViewerProps> = ({
       console.log('✅ Sketch completed with', sketchPoints.length, 'points')
       // TODO: Convert sketch to extrusion
       // For now, just log and clear
-      
+
       // Clear sketch
       setSketchPoints([])
+      renderClientRef.current?.clearSketch()
       sketchLines.forEach(line => {
         line.geometry.dispose()
         line.material.dispose()
@@ -8,7 +8,7 @@ import { Label } from '@/components/ui/label';
 import { Input } from '@/components/ui/input';
 import { toast } from 'sonner';
 import { PriceDisplay } from '@/components/price-display';
-import type { CatalogPart } from '@/lib/catalog-data';
+import type { CatalogPart } from '@/lib/catalog/categories';
 
 interface CustomizeAddModalProps {
   open: boolean;
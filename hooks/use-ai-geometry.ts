@@ -2,9 +2,27 @@
 
 import { useState, useCallback, useRef, useEffect } from 'react'
 import { ExecutionEngine, type ExecutionProgress } from '@/lib/geometry/execution-engine'
+import { buildOperationSequence, type GeometryIntent as SequencerIntent } from '@/lib/geometry/operation-sequencer'
 import { updateCanvasMesh, clearAllMeshes } from '@/lib/canvas-utils'
 import { useWorkspace } from '@/hooks/use-workspace'
 
+// Maps a streamed Deepseek intent snapshot (flat type/dimensions shape)
+// onto the sequencer's intent format so it can compile speculatively
+function toSequencerIntent(intent: any): SequencerIntent {
+  return {
+    intent: intent.description || '',
+    baseGeometry: {
+      type: intent.type || 'box',
+      parameters: intent.dimensions || {},
+    },
+    features: (intent.features || []).map((feature: any) => ({
+      type: feature.type,
+      name: feature.type,
+      parameters: feature.parameters || {},
+    })),
+  }
+}
+
 export interface AIGeometryState {
   isGenerating: boolean
   progress: number
@@ -23,6 +41,10 @@ export function useAIGeometry() {
   })
 
   const engineRef = useRef<ExecutionEngine | null>(null)
+  // Speculative compile of streamed partial intents: latest-wins queue
+  // so a fast model never outruns the worker pool
+  const speculativeBusyRef = useRef(false)
+  const pendingPartialRef = useRef<any | null>(null)
 
   // Initialize execution engine
   useEffect(() => {
@@ -188,6 +210,201 @@ export function useAIGeometry() {
     }
   }, [addObject, selectObject])
 
+  // Compiles a partial intent snapshot while the model is still
+  // writing. Latest-wins: if snapshots arrive faster than the worker
+  // pool compiles, intermediates are dropped. Failures are expected
+  // (half-written features) — the authoritative pass after 'complete'
+  // decides the final geometry.
+  const compileSpeculative = useCallback(async (partialIntent: any) => {
+    pendingPartialRef.current = partialIntent
+    if (speculativeBusyRef.current || !engineRef.current) return
+
+    speculativeBusyRef.current = true
+    try {
+      while (pendingPartialRef.current) {
+        const snapshot = pendingPartialRef.current
+        pendingPartialRef.current = null
+
+        try {
+          const operations = buildOperationSequence(toSequencerIntent(snapshot))
+          clearAllMeshes()
+          await engineRef.current.executeSequence(
+            operations,
+            undefined,
+            (geometryId: string, mesh: any) => updateCanvasMesh(geometryId, mesh)
+          )
+        } catch {
+          // Partial snapshots can be incomplete; keep streaming
+        }
+      }
+    } finally {
+      speculativeBusyRef.current = false
+    }
+  }, [])
+
+  // Streaming variant: consumes /api/ai/generate/stream, speculatively
+  // compiling each partial intent so geometry appears at
+  // time-to-first-node instead of after the full model response.
+  const generateGeometryStreaming = useCallback(async (intent: string) => {
+    if (!engineRef.current) {
+      throw new Error('Execution engine not initialized')
+    }
+
+    setState({
+      isGenerating: true,
+      progress: 0,
+      status: 'Initializing geometry engine...',
+      error: null,
+    })
+
+    try {
+      await engineRef.current.ensureReady()
+
+      setState((prev) => ({
+        ...prev,
+        progress: 10,
+        status: 'Streaming design intent...',
+      }))
+
+      const response = await fetch('/api/ai/generate/stream', {
+        method: 'POST',
+        headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify({ intent }),
+      })
+
+      if (!response.ok || !response.body) {
+        throw new Error(`API error: ${response.status}`)
+      }
+
+      const reader = response.body.getReader()
+      const decoder = new TextDecoder()
+      let buffer = ''
+      let finalEvent: any = null
+      let partialCount = 0
+
+      const handleEvent = (event: any) => {
+        if (event.type === 'partial') {
+          partialCount++
+          setState((prev) => ({
+            ...prev,
+            progress: Math.min(10 + partialCount * 5, 60),
+            status: 'Previewing geometry as the model writes...',
+          }))
+          void compileSpeculative(event.intent)
+        } else if (event.type === 'error') {
+          throw new Error(event.error || 'Stream error')
+        } else if (event.type === 'complete') {
+          finalEvent = event
+        }
+      }
+
+      // NDJSON: one event per line, lines may split across reads
+      while (true) {
+        const { done, value } = await reader.read()
+        if (done) break
+
+        buffer += decoder.decode(value, { stream: true })
+        let newline: number
+        while ((newline = buffer.indexOf('\n')) >= 0) {
+          const line = buffer.slice(0, newline).trim()
+          buffer = buffer.slice(newline + 1)
+          if (line) handleEvent(JSON.parse(line))
+        }
+      }
+
+      if (!finalEvent?.intent) {
+        throw new Error('Stream ended without a complete intent')
+      }
+
+      // Authoritative pass at full quality; replaces the coarse
+      // speculative preview on the canvas
+      const operations = buildOperationSequence(toSequencerIntent(finalEvent.intent))
+
+      setState((prev) => ({
+        ...prev,
+        progress: 60,
+        status: `Building ${operations.length} operations...`,
+      }))
+
+      let latestMeshData: any = null
+      let latestGeometryId = ''
+
+      const finalGeometryId = await engineRef.current.executeSequence(
+        operations,
+        (progress: ExecutionProgress) => {
+          setState((prev) => ({
+            ...prev,
+            progress: 60 + (progress.current / progress.total) * 40,
+            status: progress.operation.description,
+            currentOperation: progress.operation.operation,
+          }))
+        },
+        (geometryId: string, mesh: any) => {
+          if (!mesh?.vertices || !mesh?.indices) {
+            console.error('Invalid mesh data received from worker:', { geometryId, mesh })
+            return
+          }
+
+          latestMeshData = mesh
+          latestGeometryId = geometryId
+          updateCanvasMesh(geometryId, mesh)
+        }
+      )
+
+      if (latestMeshData && latestGeometryId) {
+        const objectId = `geometry_${Date.now()}`
+
+        addObject(objectId, {
+          type: finalEvent.intent.type || 'box',
+          geometryId: latestGeometryId,
+          dimensions: finalEvent.intent.dimensions || {},
+          features: finalEvent.intent.features || [],
+          material: finalEvent.intent.material || 'aluminum',
+          description: intent,
+          meshData: latestMeshData,
+          color: '#0077ff',
+          visible: true,
+          selected: false,
+        })
+
+        selectObject(objectId)
+
+        clearAllMeshes()
+      }
+
+      setState({
+        isGenerating: false,
+        progress: 100,
+        status: 'Complete!',
+        error: null,
+      })
+
+      setTimeout(() => {
+        setState({
+          isGenerating: false,
+          progress: 0,
+          status: '',
+          error: null,
+        })
+      }, 2000)
+
+      return finalGeometryId
+    } catch (error) {
+      clearAllMeshes()
+
+      const errorMessage = error instanceof Error ? error.message : 'Unknown error'
+
+      setState({
+        isGenerating: false,
+        progress: 0,
+        status: 'Error',
+        error: errorMessage,
+      })
+
+      throw error
+    }
+  }, [addObject, selectObject, compileSpeculative])
+
   const exportGeometry = useCallback(async (geometryId: string, format: 'stl' | 'obj') => {
     if (!engineRef.current) {
       throw new Error('Execution engine not initialized')
@@ -214,6 +431,7 @@ export function useAIGeometry() {
   return {
     ...state,
     generateGeometry,
+    generateGeometryStreaming,
     exportGeometry,
   }
 }
@@ -1,9 +1,22 @@
 import { useRef, useCallback, useEffect, useState } from 'react'
+import { CadmiumWorkerPool } from '../lib/cadmium-worker-pool'
+import { preloadCadmiumWasm } from '../lib/wasm-preload'
+
+// Start pulling the WASM binary into the shared Cache API entry as
+// soon as this module is evaluated, so the download and compile
+// overlap React hydration instead of waiting for the pool's workers
+// to boot. The workers read the same cache when they initialize.
+if (typeof window !== 'undefined') {
+  preloadCadmiumWasm()
+}
 
+// Mesh buffers arrive from the worker as typed-array views whose
+// underlying ArrayBuffers were transferred, not cloned; the number[]
+// variants remain for meshes built by hand on the main thread.
 export interface MeshData {
-  vertices: number[]
-  indices: number[]
-  normals?: number[]
+  vertices: Float32Array | number[]
+  indices: Uint32Array | number[]
+  normals?: Float32Array | number[]
 }
 
 export interface GeometryResult {
@@ -31,8 +44,7 @@ export interface UseCadmiumWorkerReturn {
 }
 
 export function useCadmiumWorker(): UseCadmiumWorkerReturn {
-  const workerRef = useRef<Worker | null>(null)
-  const callbacksRef = useRef<Map<string, Function>>(new Map())
+  const poolRef = useRef<CadmiumWorkerPool | null>(null)
   const isReadyRef = useRef(false)
   const [isReady, setIsReady] = useState(false)
   const initTimeoutRef = useRef<NodeJS.Timeout | null>(null)
@@ -40,30 +52,14 @@ export function useCadmiumWorker(): UseCadmiumWorkerReturn {
   useEffect(() => {
     if (typeof window === 'undefined') return
 
-    // Initialize worker
-    if (!workerRef.current) {
+    // Initialize worker pool (sized to hardware concurrency)
+    if (!poolRef.current) {
       try {
-        console.log('🔄 Initializing Cadmium Worker...')
-
-        // Use new URL for worker to allow Next.js/Webpack to bundle it correctly
-        workerRef.current = new Worker(
-          new URL('../workers/cadmium-worker.ts', import.meta.url),
-          { type: 'module' }
-        )
-
-        // Set initialization timeout (increased from 10s to 30s)
-        initTimeoutRef.current = setTimeout(() => {
-          if (!isReadyRef.current) {
-            console.error('❌ Cadmium Worker initialization timed out after 30s')
-            setIsReady(false)
-          }
-        }, 30000)
+        console.log('🔄 Initializing Cadmium Worker pool...')
 
-        workerRef.current.onmessage = (event: MessageEvent) => {
-          const { id, result, error, type } = event.data
-
-          if (type === 'READY') {
-            console.log('✅ Cadmium Worker is ready')
+        poolRef.current = new CadmiumWorkerPool(undefined, (ready) => {
+          if (ready) {
+            console.log('✅ Cadmium Worker pool is ready')
             isReadyRef.current = true
             setIsReady(true)
 
@@ -71,42 +67,18 @@ export function useCadmiumWorker(): UseCadmiumWorkerReturn {
               clearTimeout(initTimeoutRef.current)
               initTimeoutRef.current = null
             }
-            return
           }
+        })
 
-          if (type === 'ERROR' && !id) {
-            console.error('❌ Cadmium Worker initialization failed:', error)
+        // Set initialization timeout (increased from 10s to 30s)
+        initTimeoutRef.current = setTimeout(() => {
+          if (!isReadyRef.current) {
+            console.error('❌ Cadmium Worker pool initialization timed out after 30s')
             setIsReady(false)
-
-            if (initTimeoutRef.current) {
-              clearTimeout(initTimeoutRef.current)
-              initTimeoutRef.current = null
-            }
-            return
-          }
-
-          const callback = callbacksRef.current.get(id)
-          if (callback) {
-            callbacksRef.current.delete(id)
-            if (error) {
-              callback(error, null)
-            } else {
-              callback(null, result)
-            }
           }
-        }
-
-        workerRef.current.onerror = (error) => {
-          console.error('❌ Cadmium Worker error:', error)
-          setIsReady(false)
-
-          if (initTimeoutRef.current) {
-            clearTimeout(initTimeoutRef.current)
-            initTimeoutRef.current = null
-          }
-        }
+        }, 30000)
       } catch (error) {
-        console.error('❌ Failed to create Cadmium Worker:', error)
+        console.error('❌ Failed to create Cadmium Worker pool:', error)
         setIsReady(false)
       }
     }
@@ -116,44 +88,23 @@ export function useCadmiumWorker(): UseCadmiumWorkerReturn {
         clearTimeout(initTimeoutRef.current)
       }
 
-      if (workerRef.current) {
-        workerRef.current.terminate()
-        workerRef.current = null
+      if (poolRef.current) {
+        poolRef.current.destroy()
+        poolRef.current = null
       }
     }
   }, [])
-  
+
   const runOperation = useCallback((operation: string, payload: any, timeout = 30000): Promise<any> => {
-    return new Promise((resolve, reject) => {
-      if (!workerRef.current) {
-        reject(new Error('Worker not initialized'))
-        return
-      }
-      
-      if (!isReadyRef.current) {
-        reject(new Error('Worker not ready yet'))
-        return
-      }
-      
-      const id = Math.random().toString(36).substr(2, 9)
-      
-      // Set timeout for operation
-      const timeoutId = setTimeout(() => {
-        callbacksRef.current.delete(id)
-        reject(new Error(`Operation ${operation} timed out after ${timeout}ms`))
-      }, timeout)
-      
-      callbacksRef.current.set(id, (error: string | null, result: any) => {
-        clearTimeout(timeoutId)
-        if (error) {
-          reject(new Error(error))
-        } else {
-          resolve(result)
-        }
-      })
-      
-      workerRef.current.postMessage({ id, operation, payload })
-    })
+    if (!poolRef.current) {
+      return Promise.reject(new Error('Worker not initialized'))
+    }
+
+    if (!isReadyRef.current) {
+      return Promise.reject(new Error('Worker not ready yet'))
+    }
+
+    return poolRef.current.run(operation, payload, timeout)
   }, [])
   
   return {
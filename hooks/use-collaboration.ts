@@ -1,6 +1,6 @@
 "use client"
 
-import { useEffect, useRef, useState } from "react"
+import { useCallback, useEffect, useRef, useState } from "react"
 import { CollaborationManager } from "@/lib/collaboration"
 import { useAuth } from "@/lib/auth-context"
 
@@ -12,20 +12,32 @@ interface UseCollaborationProps {
 export function useCollaboration({ projectId, enabled = true }: UseCollaborationProps) {
   const { user } = useAuth()
   const managerRef = useRef<CollaborationManager | null>(null)
+  // Objects whose subdocuments are currently synced (viewport-driven)
+  const loadedObjectsRef = useRef<Set<string>>(new Set())
   const [collaborators, setCollaborators] = useState<any[]>([])
   const [isConnected, setIsConnected] = useState(false)
 
   useEffect(() => {
     if (!enabled || !user || !projectId) return
 
-    managerRef.current = new CollaborationManager({
-      roomName: `project:${projectId}`,
+    const roomName = `project:${projectId}`
+    const manager = new CollaborationManager({
+      roomName,
       userId: user.id,
       userName: user.name,
     })
+    managerRef.current = manager
+
+    // Warm the join from the last compacted snapshot so we render
+    // before the websocket replays the room history
+    void CollaborationManager.fetchSnapshot(roomName).then((snapshot) => {
+      if (snapshot && managerRef.current === manager) {
+        manager.applySnapshot(snapshot)
+      }
+    })
 
     // Listen to geometry changes
-    managerRef.current.onGeometryChange(() => {
+    manager.onGeometryChange(() => {
       // Trigger re-render with updated geometry
     })
 
@@ -40,15 +52,39 @@ export function useCollaboration({ projectId, enabled = true }: UseCollaboration
 
     return () => {
       clearInterval(interval)
+      loadedObjectsRef.current.clear()
       managerRef.current?.destroy()
       setIsConnected(false)
     }
   }, [projectId, enabled, user])
 
+  // Sync exactly the objects the viewport shows: load entering ids,
+  // unload leaving ones. Off-screen objects stay registered stubs and
+  // cost no memory or bandwidth until they come back.
+  const setVisibleObjects = useCallback((objectIds: string[]) => {
+    const manager = managerRef.current
+    if (!manager) return
+
+    const visible = new Set(objectIds)
+    for (const id of loadedObjectsRef.current) {
+      if (!visible.has(id)) {
+        manager.unloadObject(id)
+        loadedObjectsRef.current.delete(id)
+      }
+    }
+    for (const id of visible) {
+      if (!loadedObjectsRef.current.has(id)) {
+        manager.loadObject(id)
+        loadedObjectsRef.current.add(id)
+      }
+    }
+  }, [])
+
   return {
     manager: managerRef.current,
     collaborators,
     isConnected,
+    setVisibleObjects,
     updateCursor: (pos: { x: number; y: number }) => {
       managerRef.current?.updateCursor(pos)
     },
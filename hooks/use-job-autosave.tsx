@@ -2,7 +2,13 @@
 // Auto-save hook for workspace state
 
 import { useState, useCallback, useEffect, useRef } from 'react'
-import { saveJob, generateJobId, type Job } from '@/lib/job-persistence'
+import {
+  saveJob,
+  saveJobVersion,
+  generateJobId,
+  VERSION_COMPACTION_INTERVAL,
+  type Job,
+} from '@/lib/job-persistence'
 import { useWorkspace, type WorkspaceObject } from '@/hooks/use-workspace'
 import { useAuth } from '@/lib/auth-context'
 import { toast } from 'sonner'
@@ -11,6 +17,28 @@ const AUTOSAVE_INTERVAL_MS = 30000 // 30 seconds
 const MAX_RETRIES = 3
 const RETRY_DELAY_MS = 2000
 
+const versionCounterKey = (jobId: string) => `qutlas-autosave-version:${jobId}`
+
+function readVersionCounter(jobId: string): number {
+  try {
+    const saved = typeof window !== 'undefined'
+      ? window.localStorage.getItem(versionCounterKey(jobId))
+      : null
+    const parsed = saved ? Number.parseInt(saved, 10) : NaN
+    return Number.isFinite(parsed) && parsed > 0 ? parsed : 0
+  } catch {
+    return 0
+  }
+}
+
+function writeVersionCounter(jobId: string, version: number): void {
+  try {
+    window.localStorage.setItem(versionCounterKey(jobId), String(version))
+  } catch {
+    // Private mode / storage quota; the save itself still succeeded
+  }
+}
+
 interface UseJobAutosaveReturn {
   isSaving: boolean
   lastSavedAt: Date | null
@@ -36,6 +64,14 @@ export function useJobAutosave(
   const savedStateRef = useRef<string>('')
   const retryCountRef = useRef(0)
   const autosaveTimeoutRef = useRef<NodeJS.Timeout | null>(null)
+  // Last workspace state that reached storage; autosave diffs against
+  // this so each tick uploads only the objects that changed
+  const lastPersistedWorkspaceRef = useRef<Job['workspace'] | null>(null)
+  // Highest version number written for this job. Persisted per job so
+  // a new session continues the chain instead of overwriting earlier
+  // versions with deltas against a different base.
+  const versionCounterRef = useRef(0)
+  const versionCounterLoadedRef = useRef(false)
 
   // Create a snapshot of current state for comparison
   const createStateSnapshot = useCallback(() => {
@@ -85,20 +121,61 @@ export function useJobAutosave(
         activeTool,
       }
 
-      const result = await saveJob(user.id, currentJobId, workspace, undefined, undefined, {
-        title: isAutoSave ? undefined : `Job ${new Date().toLocaleDateString()}`,
-      })
+      let result: { success: boolean; error?: string }
+      if (isAutoSave) {
+        // Continue the version chain of a resumed job; starting over at
+        // v1 would overwrite earlier versions with deltas against a
+        // different base
+        if (!versionCounterLoadedRef.current) {
+          versionCounterLoadedRef.current = true
+          versionCounterRef.current = Math.max(
+            versionCounterRef.current,
+            readVersionCounter(currentJobId)
+          )
+        }
+
+        // Delta autosave: upload only the objects that changed since
+        // the last persisted state. Without one (first tick of a
+        // session) the version is written as a full base snapshot, so
+        // the chain never references deltas from an earlier session.
+        const version = versionCounterRef.current + 1
+        const previous = lastPersistedWorkspaceRef.current ?? undefined
+        result = await saveJobVersion(
+          user.id,
+          currentJobId,
+          workspace,
+          version,
+          previous
+        )
+        if (result.success) {
+          versionCounterRef.current = version
+          writeVersionCounter(currentJobId, version)
+
+          // Whenever a base snapshot was written, refresh the main job
+          // blob too so it never trails by more than one interval
+          const wroteBase =
+            !previous || version % VERSION_COMPACTION_INTERVAL === 1
+          if (wroteBase) {
+            await saveJob(user.id, currentJobId, workspace, undefined, undefined, {})
+          }
+        }
+      } else {
+        result = await saveJob(user.id, currentJobId, workspace, undefined, undefined, {
+          title: isAutoSave ? undefined : `Job ${new Date().toLocaleDateString()}`,
+        })
+      }
 
       if (result.success) {
         savedStateRef.current = snapshot
+        lastPersistedWorkspaceRef.current = workspace
         setHasUnsavedChanges(false)
         setLastSavedAt(new Date())
         retryCountRef.current = 0
-        
+
         if (!isAutoSave) {
           toast.success('Job saved successfully')
         }
-        
+
         return true
       } else {
         throw new Error(result.error || 'Save failed')
@@ -160,6 +237,7 @@ export function useJobAutosave(
 
       if (result.success) {
         savedStateRef.current = snapshot
+        lastPersistedWorkspaceRef.current = workspace
         setHasUnsavedChanges(false)
         setLastSavedAt(new Date())
         toast.success('Job saved successfully')
@@ -1,10 +1,12 @@
 // Cadmium Client - Direct WASM interface (non-worker)
 // For lightweight operations that don't need background threading
 
+// Typed-array views are preferred end to end (WASM exit through to
+// THREE.BufferAttribute); plain arrays remain for hand-built meshes.
 export interface MeshData {
-  vertices: number[]
-  indices: number[]
-  normals?: number[]
+  vertices: Float32Array | number[]
+  indices: Uint32Array | number[]
+  normals?: Float32Array | number[]
 }
 
 export interface BoundingBox {
@@ -144,7 +146,7 @@ export class CadmiumClient {
       // Fallback: merge meshes
       const combinedVertices = [...shape1.meshData.vertices, ...shape2.meshData.vertices]
       const offset = shape1.meshData.vertices.length / 3
-      const offsetIndices = shape2.meshData.indices.map(idx => idx + offset)
+      const offsetIndices = Array.from(shape2.meshData.indices, (idx) => idx + offset)
       const combinedIndices = [...shape1.meshData.indices, ...offsetIndices]
       return new Geometry(this.generateId(), {
         vertices: combinedVertices,
@@ -271,9 +273,9 @@ export class CadmiumClient {
   // Utility methods
   private extractMeshData(wasmMesh: any): MeshData {
     return {
-      vertices: Array.from(wasmMesh.vertices || []),
-      indices: Array.from(wasmMesh.faces || []),
-      normals: Array.from(wasmMesh.normals || [])
+      vertices: new Float32Array(wasmMesh.vertices || []),
+      indices: new Uint32Array(wasmMesh.faces || []),
+      normals: new Float32Array(wasmMesh.normals || [])
     }
   }
   
@@ -0,0 +1,346 @@
+// Cadmium Worker Pool - Dispatches geometry operations across N workers
+// Replaces the single cadmium-worker instance so one expensive boolean
+// doesn't serialize every other regeneration behind it.
+//
+// Scheduling model:
+// - Each worker has its own queue. Operations that reference existing
+//   geometry are pinned to the worker whose cache holds that geometry
+//   (the per-worker mesh cache is not shared). Creation operations are
+//   unpinned and go to the least-loaded worker.
+// - When a worker goes idle with an empty queue it steals the most
+//   recently queued unpinned task from the longest queue, so cheap
+//   primitive regenerations flow around a stalled boolean.
+// - When a boolean's two inputs live on different workers, the second
+//   mesh is migrated (GET_MESH + IMPORT_MESH) before the operation is
+//   pinned, preserving its geometry id.
+//
+// The message protocol is unchanged: the per-request id in
+// WorkerMessage/WorkerResponse already supports out-of-order completion.
+
+interface PoolTask {
+  id: string
+  operation: string
+  payload: any
+  pinnedTo: number | null
+  resolve: (result: any) => void
+  reject: (error: Error) => void
+  timeoutId: ReturnType<typeof setTimeout>
+}
+
+interface PoolWorker {
+  worker: Worker
+  ready: boolean
+  current: PoolTask | null
+  queue: PoolTask[]
+}
+
+const DEFAULT_OPERATION_TIMEOUT_MS = 30000
+
+// Mesh payloads (LOAD_MESH, IMPORT_MESH migrations) carry typed-array
+// views; move their buffers to the worker instead of cloning them.
+function collectPayloadTransfers(payload: any): Transferable[] {
+  const buffers: Transferable[] = []
+  const mesh = payload?.mesh
+  if (mesh) {
+    for (const key of ['vertices', 'indices', 'normals']) {
+      const view = mesh[key]
+      if (ArrayBuffer.isView(view) && !buffers.includes(view.buffer)) {
+        buffers.push(view.buffer)
+      }
+    }
+  }
+  return buffers
+}
+
+// Operations whose results should be visible on every worker.
+const BROADCAST_OPERATIONS = new Set(['CLEAR_CACHE', 'REMOVE_GEOMETRY'])
+
+export class CadmiumWorkerPool {
+  private workers: PoolWorker[] = []
+  private inflight = new Map<string, { task: PoolTask; workerIndex: number }>()
+  // geometryId -> index of the worker whose cache holds it
+  private geometryOwner = new Map<string, number>()
+  private idCounter = 0
+  private destroyed = false
+  private onReadyChange: ((ready: boolean) => void) | null = null
+
+  constructor(size?: number, onReadyChange?: (ready: boolean) => void) {
+    const hardware =
+      typeof navigator !== 'undefined' ? navigator.hardwareConcurrency || 4 : 4
+    // Leave one core for the main thread; cap so we don't hold N WASM
+    // instances on very wide machines.
+    const poolSize = Math.min(Math.max(size ?? hardware - 1, 1), 8)
+    this.onReadyChange = onReadyChange ?? null
+
+    for (let i = 0; i < poolSize; i++) {
+      this.spawnWorker(i)
+    }
+  }
+
+  get size(): number {
+    return this.workers.length
+  }
+
+  get isReady(): boolean {
+    return this.workers.some((w) => w.ready)
+  }
+
+  private spawnWorker(index: number) {
+    const worker = new Worker(
+      new URL('../workers/cadmium-worker.ts', import.meta.url),
+      { type: 'module' }
+    )
+
+    const slot: PoolWorker = { worker, ready: false, current: null, queue: [] }
+    this.workers[index] = slot
+
+    worker.onmessage = (event: MessageEvent) => {
+      const { id, result, error, type } = event.data
+
+      if (type === 'READY') {
+        const wasReady = this.isReady
+        slot.ready = true
+        if (!wasReady && this.onReadyChange) {
+          this.onReadyChange(true)
+        }
+        this.pump()
+        return
+      }
+
+      if (type === 'ERROR' && !id) {
+        console.error(`❌ Cadmium pool worker ${index} failed to initialize:`, error)
+        return
+      }
+
+      const entry = this.inflight.get(id)
+      if (!entry) return
+      this.inflight.delete(id)
+
+      const { task } = entry
+      clearTimeout(task.timeoutId)
+      slot.current = null
+
+      if (error) {
+        task.reject(new Error(error))
+      } else {
+        // Remember which worker's cache owns any geometry the result
+        // produced, so follow-up operations are pinned correctly.
+        if (result && typeof result.geometryId === 'string') {
+          this.geometryOwner.set(result.geometryId, index)
+        }
+        task.resolve(result)
+      }
+
+      this.pump()
+    }
+
+    worker.onerror = (error) => {
+      console.error(`❌ Cadmium pool worker ${index} error:`, error)
+    }
+  }
+
+  async run(
+    operation: string,
+    payload: any,
+    timeout = DEFAULT_OPERATION_TIMEOUT_MS
+  ): Promise<any> {
+    if (this.destroyed) {
+      throw new Error('Worker pool has been destroyed')
+    }
+    if (!this.isReady) {
+      throw new Error('Worker pool not ready yet')
+    }
+
+    if (BROADCAST_OPERATIONS.has(operation)) {
+      return this.broadcast(operation, payload, timeout)
+    }
+
+    const pinnedTo = await this.resolvePlacement(operation, payload, timeout)
+
+    return new Promise((resolve, reject) => {
+      const id = `pool_${this.idCounter++}`
+      const timeoutId = setTimeout(() => {
+        this.cancel(id)
+        reject(new Error(`Operation ${operation} timed out after ${timeout}ms`))
+      }, timeout)
+
+      const task: PoolTask = { id, operation, payload, pinnedTo, resolve, reject, timeoutId }
+      this.enqueue(task)
+      this.pump()
+    })
+  }
+
+  destroy() {
+    this.destroyed = true
+    for (const slot of this.workers) {
+      slot.worker.terminate()
+    }
+    for (const { task } of this.inflight.values()) {
+      clearTimeout(task.timeoutId)
+      task.reject(new Error('Worker pool destroyed'))
+    }
+    this.inflight.clear()
+    this.workers = []
+    this.geometryOwner.clear()
+  }
+
+  // ===== SCHEDULING =====
+
+  private enqueue(task: PoolTask) {
+    if (task.pinnedTo !== null) {
+      this.workers[task.pinnedTo].queue.push(task)
+      return
+    }
+
+    // Unpinned: least-loaded ready worker.
+    let best: PoolWorker | null = null
+    for (const slot of this.workers) {
+      if (!slot.ready) continue
+      if (!best || this.load(slot) < this.load(best)) {
+        best = slot
+      }
+    }
+    ;(best ?? this.workers[0]).queue.push(task)
+  }
+
+  private load(slot: PoolWorker): number {
+    return slot.queue.length + (slot.current ? 1 : 0)
+  }
+
+  private pump() {
+    for (let i = 0; i < this.workers.length; i++) {
+      const slot = this.workers[i]
+      if (!slot.ready || slot.current) continue
+
+      const task = slot.queue.shift() ?? this.steal()
+      if (!task) continue
+
+      slot.current = task
+      this.inflight.set(task.id, { task, workerIndex: i })
+      slot.worker.postMessage(
+        // sentAt lets the worker attribute queue wait in perf spans
+        { id: task.id, operation: task.operation, payload: task.payload, sentAt: Date.now() },
+        collectPayloadTransfers(task.payload)
+      )
+    }
+  }
+
+  // Take the most recently queued unpinned task from the longest queue.
+  private steal(): PoolTask | null {
+    let victim: PoolWorker | null = null
+    for (const slot of this.workers) {
+      if (slot.queue.length === 0) continue
+      if (!victim || slot.queue.length > victim.queue.length) {
+        victim = slot
+      }
+    }
+    if (!victim) return null
+
+    for (let i = victim.queue.length - 1; i >= 0; i--) {
+      if (victim.queue[i].pinnedTo === null) {
+        return victim.queue.splice(i, 1)[0]
+      }
+    }
+    return null
+  }
+
+  private cancel(id: string) {
+    const entry = this.inflight.get(id)
+    if (entry) {
+      // Already dispatched; drop the callback but let the worker finish.
+      this.inflight.delete(id)
+      this.workers[entry.workerIndex].current = null
+      this.pump()
+      return
+    }
+    for (const slot of this.workers) {
+      const index = slot.queue.findIndex((t) => t.id === id)
+      if (index >= 0) {
+        slot.queue.splice(index, 1)
+        return
+      }
+    }
+  }
+
+  // ===== PLACEMENT =====
+
+  // Decide which worker a task must run on, migrating geometry between
+  // worker caches when a binary operation's inputs live apart.
+  private async resolvePlacement(
+    operation: string,
+    payload: any,
+    timeout: number
+  ): Promise<number | null> {
+    const ids: string[] = []
+    if (typeof payload?.geometryId === 'string') ids.push(payload.geometryId)
+    if (typeof payload?.geometryId1 === 'string') ids.push(payload.geometryId1)
+    if (typeof payload?.geometryId2 === 'string') ids.push(payload.geometryId2)
+
+    if (ids.length === 0) return null
+
+    const owners = ids.map((id) => this.geometryOwner.get(id))
+    const target = owners.find((o) => o !== undefined)
+    if (target === undefined) return null
+
+    for (let i = 0; i < ids.length; i++) {
+      const owner = owners[i]
+      if (owner !== undefined && owner !== target) {
+        await this.migrate(ids[i], owner, target, timeout)
+      }
+    }
+
+    return target
+  }
+
+  private async migrate(
+    geometryId: string,
+    from: number,
+    to: number,
+    timeout: number
+  ): Promise<void> {
+    const mesh = await this.runOn(from, 'GET_MESH', { geometryId }, timeout)
+    await this.runOn(to, 'IMPORT_MESH', { geometryId, mesh }, timeout)
+    this.geometryOwner.set(geometryId, to)
+  }
+
+  private runOn(
+    workerIndex: number,
+    operation: string,
+    payload: any,
+    timeout: number
+  ): Promise<any> {
+    return new Promise((resolve, reject) => {
+      const id = `pool_${this.idCounter++}`
+      const timeoutId = setTimeout(() => {
+        this.cancel(id)
+        reject(new Error(`Operation ${operation} timed out after ${timeout}ms`))
+      }, timeout)
+
+      const task: PoolTask = {
+        id,
+        operation,
+        payload,
+        pinnedTo: workerIndex,
+        resolve,
+        reject,
+        timeoutId,
+      }
+      this.workers[workerIndex].queue.push(task)
+      this.pump()
+    })
+  }
+
+  private async broadcast(operation: string, payload: any, timeout: number): Promise<any> {
+    const results = await Promise.all(
+      this.workers
+        .map((slot, index) => (slot.ready ? this.runOn(index, operation, payload, timeout) : null))
+        .filter(Boolean)
+    )
+    if (operation === 'CLEAR_CACHE') {
+      this.geometryOwner.clear()
+    } else if (operation === 'REMOVE_GEOMETRY' && typeof payload?.geometryId === 'string') {
+      this.geometryOwner.delete(payload.geometryId)
+    }
+    return results[0]
+  }
+}
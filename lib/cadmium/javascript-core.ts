@@ -128,10 +128,127 @@ export function compute_bounding_box(mesh: Mesh) {
   };
 }
 
-export function export_stl(_mesh: Mesh, _filename: string): string {
-  throw new Error('STL export requires WASM module');
+function faceNormal(mesh: Mesh, tri: number): [number, number, number] {
+  const a = mesh.faces[tri * 3];
+  const b = mesh.faces[tri * 3 + 1];
+  const c = mesh.faces[tri * 3 + 2];
+
+  const v0 = [mesh.vertices[a * 3], mesh.vertices[a * 3 + 1], mesh.vertices[a * 3 + 2]];
+  const v1 = [mesh.vertices[b * 3], mesh.vertices[b * 3 + 1], mesh.vertices[b * 3 + 2]];
+  const v2 = [mesh.vertices[c * 3], mesh.vertices[c * 3 + 1], mesh.vertices[c * 3 + 2]];
+
+  const e1 = [v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2]];
+  const e2 = [v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2]];
+
+  const nx = e1[1] * e2[2] - e1[2] * e2[1];
+  const ny = e1[2] * e2[0] - e1[0] * e2[2];
+  const nz = e1[0] * e2[1] - e1[1] * e2[0];
+  const len = Math.sqrt(nx * nx + ny * ny + nz * nz);
+
+  return len > 0 ? [nx / len, ny / len, nz / len] : [0, 0, 1];
+}
+
+export function export_stl(mesh: Mesh, filename: string): string {
+  const lines: string[] = [`solid ${filename}`];
+
+  for (let tri = 0; tri < mesh.faces.length / 3; tri++) {
+    const [nx, ny, nz] = faceNormal(mesh, tri);
+    lines.push(`  facet normal ${nx} ${ny} ${nz}`);
+    lines.push('    outer loop');
+
+    for (let corner = 0; corner < 3; corner++) {
+      const idx = mesh.faces[tri * 3 + corner];
+      lines.push(
+        `      vertex ${mesh.vertices[idx * 3]} ${mesh.vertices[idx * 3 + 1]} ${mesh.vertices[idx * 3 + 2]}`
+      );
+    }
+
+    lines.push('    endloop');
+    lines.push('  endfacet');
+  }
+
+  lines.push('endsolid');
+  return lines.join('\n') + '\n';
+}
+
+export function export_obj(mesh: Mesh, filename: string): string {
+  const lines: string[] = ['# OBJ file exported from Cadmium (JS fallback)', `# Filename: ${filename}`, ''];
+
+  for (let i = 0; i < mesh.vertices.length; i += 3) {
+    lines.push(`v ${mesh.vertices[i]} ${mesh.vertices[i + 1]} ${mesh.vertices[i + 2]}`);
+  }
+
+  lines.push('');
+
+  // OBJ uses 1-based indexing
+  for (let i = 0; i < mesh.faces.length; i += 3) {
+    lines.push(`f ${mesh.faces[i] + 1} ${mesh.faces[i + 1] + 1} ${mesh.faces[i + 2] + 1}`);
+  }
+
+  return lines.join('\n') + '\n';
+}
+
+const STL_HEADER_LEN = 84;
+const STL_FACET_LEN = 50;
+
+export function export_stl_chunk_count(mesh: Mesh, chunkTriangles: number): number {
+  const triangles = Math.floor(mesh.faces.length / 3);
+  return Math.ceil(triangles / Math.max(chunkTriangles, 1));
+}
+
+export function export_stl_binary_chunk(
+  mesh: Mesh,
+  filename: string,
+  chunkIndex: number,
+  chunkTriangles: number
+): Uint8Array {
+  const totalTris = Math.floor(mesh.faces.length / 3);
+  const chunk = Math.max(chunkTriangles, 1);
+  const start = chunkIndex * chunk;
+  const end = Math.min(start + chunk, totalTris);
+  const count = Math.max(end - start, 0);
+
+  const headerLen = chunkIndex === 0 ? STL_HEADER_LEN : 0;
+  const out = new Uint8Array(headerLen + count * STL_FACET_LEN);
+  const view = new DataView(out.buffer);
+
+  if (chunkIndex === 0) {
+    // 80-byte label + little-endian triangle count
+    for (let i = 0; i < Math.min(filename.length, 80); i++) {
+      out[i] = filename.charCodeAt(i) & 0x7f;
+    }
+    view.setUint32(80, totalTris, true);
+  }
+
+  let offset = headerLen;
+  for (let tri = start; tri < end; tri++) {
+    const [nx, ny, nz] = faceNormal(mesh, tri);
+    view.setFloat32(offset, nx, true);
+    view.setFloat32(offset + 4, ny, true);
+    view.setFloat32(offset + 8, nz, true);
+    offset += 12;
+
+    for (let corner = 0; corner < 3; corner++) {
+      const idx = mesh.faces[tri * 3 + corner];
+      view.setFloat32(offset, mesh.vertices[idx * 3], true);
+      view.setFloat32(offset + 4, mesh.vertices[idx * 3 + 1], true);
+      view.setFloat32(offset + 8, mesh.vertices[idx * 3 + 2], true);
+      offset += 12;
+    }
+
+    view.setUint16(offset, 0, true); // attribute byte count
+    offset += 2;
+  }
+
+  return out;
+}
+
+export function export_stl_binary(mesh: Mesh, filename: string): Uint8Array {
+  const totalTris = Math.floor(mesh.faces.length / 3);
+  return export_stl_binary_chunk(mesh, filename, 0, Math.max(totalTris, 1));
 }
 
-export function export_obj(_mesh: Mesh, _filename: string): string {
-  throw new Error('OBJ export requires WASM module');
+export function export_3mf(_mesh: Mesh, _partName: string): Uint8Array {
+  // The zip container is only written by the WASM exporter
+  throw new Error('3MF export requires WASM module');
 }
@@ -9,6 +9,23 @@ export interface MeshData {
 let sceneRef: THREE.Scene | null = null;
 const meshRegistry = new Map<string, THREE.Mesh>();
 
+// When the viewport renders in the OffscreenCanvas worker there is no
+// main-thread scene; callers that stream meshes in from outside the
+// viewer (AI geometry, progressive LOD) are forwarded to the worker
+// through this bridge instead. Structural type so this module doesn't
+// depend on render-worker-client.
+export interface CanvasRenderBridge {
+  updateMesh(id: string, mesh: MeshData, color?: number): void;
+  removeMesh(id: string): void;
+  clearMeshes(): void;
+}
+
+let renderBridge: CanvasRenderBridge | null = null;
+
+export function setCanvasRenderBridge(bridge: CanvasRenderBridge | null): void {
+  renderBridge = bridge;
+}
+
 function disposeObject3D(object: THREE.Object3D): void {
   object.traverse((child) => {
     if ((child as THREE.Mesh).geometry) {
@@ -39,18 +56,14 @@ export function getCanvasScene(): THREE.Scene | null {
 }
 
 export function updateCanvasMesh(id: string, meshData: MeshData, color?: number): void {
-  if (!sceneRef) return;
-
   if (!meshData?.vertices || !meshData?.indices) {
     console.error('Invalid mesh data received:', { id, meshData });
     return;
   }
 
-  const oldMesh = meshRegistry.get(id);
-  if (oldMesh) {
-    sceneRef.remove(oldMesh);
-    disposeObject3D(oldMesh);
-    meshRegistry.delete(id);
+  if (!sceneRef) {
+    renderBridge?.updateMesh(id, meshData, color);
+    return;
   }
 
   const geometry = new THREE.BufferGeometry();
@@ -76,6 +89,20 @@ export function updateCanvasMesh(id: string, meshData: MeshData, color?: number)
 
   geometry.computeBoundingSphere();
 
+  // Progressive LOD streams refined meshes under the same id; swap the
+  // geometry buffers in place so material, scene membership and
+  // selection state survive the upgrade.
+  const existingMesh = meshRegistry.get(id);
+  if (existingMesh) {
+    existingMesh.geometry.dispose();
+    existingMesh.geometry = geometry;
+
+    if (color !== undefined) {
+      (existingMesh.material as THREE.MeshStandardMaterial).color.setHex(color);
+    }
+    return;
+  }
+
   const material = new THREE.MeshStandardMaterial({
     color: color ?? 0x0077ff,
     roughness: 0.4,
@@ -94,7 +121,10 @@ export function updateCanvasMesh(id: string, meshData: MeshData, color?: number)
 }
 
 export function removeCanvasMesh(id: string): void {
-  if (!sceneRef) return;
+  if (!sceneRef) {
+    renderBridge?.removeMesh(id);
+    return;
+  }
 
   const mesh = meshRegistry.get(id);
   if (!mesh) return;
@@ -109,7 +139,10 @@ export function getCanvasMesh(id: string): THREE.Mesh | undefined {
 }
 
 export function clearAllMeshes(): void {
-  if (!sceneRef) return;
+  if (!sceneRef) {
+    renderBridge?.clearMeshes();
+    return;
+  }
 
   meshRegistry.forEach((mesh) => {
     sceneRef!.remove(mesh);
@@ -0,0 +1,167 @@
+/**
+ * Catalog Categories - types and the lightweight category index
+ *
+ * Part data itself lives in per-category chunks under ./chunks and is
+ * loaded on demand via lib/catalog/parts; importing this module costs
+ * kilobytes, so client pages can render the category rail and filter UI
+ * without pulling the whole parts library into the bundle.
+ */
+
+export type CategoryId =
+  | 'profiles-frames'
+  | 'plates-sheets'
+  | 'fasteners'
+  | 'bearings-shafts'
+  | 'power-transmission'
+  | 'enclosures'
+  | 'fluid-process'
+  | 'thermal'
+  | 'mobility'
+  | 'electrical-iot'
+  | 'tooling';
+
+export interface CatalogCategory {
+  id: CategoryId;
+  name: string;
+  icon: string;
+  description: string;
+  unlocks: string;
+  count: number;
+}
+
+export interface CatalogPart {
+  id: string;
+  name: string;
+  category: CategoryId;
+  categoryIcon?: string;
+  description: string;
+  unlocksText: string;
+  material: string;
+  process?: string;
+  finish?: string;
+  basePrice: number;
+  leadTime?: string;
+  leadTimeDays?: number;
+  manufacturability?: number;
+  thumbnail?: string;
+  qty?: number;
+  specs?: {
+    width?: number;
+    height?: number;
+    length?: number;
+    diameter?: number;
+    wallThickness?: number;
+    sideLength?: number;
+    unitLength?: number;
+    threadSize?: string;
+    [key: string]: number | string | undefined;
+  };
+  variants?: Array<{
+    id: string;
+    name: string;
+    specs: Record<string, number | string>;
+    priceMultiplier: number;
+  }>;
+  materials?: Array<{ name: string; priceMultiplier: number }>;
+  finishes?: string[];
+}
+
+export const CATALOG_CATEGORIES: CatalogCategory[] = [
+  {
+    id: 'profiles-frames',
+    name: 'Structural Profiles & Frames',
+    icon: '🏗️',
+    description: 'High-reuse backbone of all machines',
+    unlocks: 'Frames, racks, enclosures, carts, machines',
+    count: 80,
+  },
+  {
+    id: 'plates-sheets',
+    name: 'Plates, Panels & Sheets',
+    icon: '📋',
+    description: 'Everything mounts on these',
+    unlocks: 'Assembly surfaces, structural support, aesthetics',
+    count: 60,
+  },
+  {
+    id: 'fasteners',
+    name: 'Fasteners & Joining',
+    icon: '🔩',
+    description: 'Absolutely mandatory. Highest reorder frequency',
+    unlocks: 'Assembly, structural integrity',
+    count: 70,
+  },
+  {
+    id: 'bearings-shafts',
+    name: 'Bearings, Shafts & Motion Core',
+    icon: '⚙️',
+    description: 'Enables all rotating systems',
+    unlocks: 'Rotating equipment, linear motion systems',
+    count: 50,
+  },
+  {
+    id: 'power-transmission',
+    name: 'Power Transmission',
+    icon: '🔧',
+    description: 'Motion scaling without electronics',
+    unlocks: 'Speed/torque adjustment, mechanical advantage',
+    count: 45,
+  },
+  {
+    id: 'enclosures',
+    name: 'Enclosures & Casings',
+    icon: '📦',
+    description: 'Critical for productization',
+    unlocks: 'Finished products, safety, aesthetics',
+    count: 40,
+  },
+  {
+    id: 'fluid-process',
+    name: 'Fluid & Process Hardware',
+    icon: '💧',
+    description: 'Unlocks agro-processing, water, oil, health',
+    unlocks: 'Fluid systems, agricultural equipment, water processing',
+    count: 45,
+  },
+  {
+    id: 'thermal',
+    name: 'Thermal & Energy Components',
+    icon: '🔥',
+    description: 'Low-tech but powerful',
+    unlocks: 'Thermal management, furnaces, ovens, heating systems',
+    count: 30,
+  },
+  {
+    id: 'mobility',
+    name: 'Mobility & Handling',
+    icon: '🛞',
+    description: 'Everything must move',
+    unlocks: 'Mobile equipment, carts, conveyors',
+    count: 30,
+  },
+  {
+    id: 'electrical-iot',
+    name: 'Electrical & IoT Mechanical Interfaces',
+    icon: '⚡',
+    description: 'Hardware meets electronics',
+    unlocks: 'Electromechanical integration, automation',
+    count: 25,
+  },
+  {
+    id: 'tooling',
+    name: 'Tooling & Jigs',
+    icon: '🔨',
+    description: 'These improve the platform itself',
+    unlocks: 'Faster iteration, precision manufacturing, quality improvement',
+    count: 25,
+  },
+];
+
+// Helper functions
+export function getCategoryById(id: CategoryId): CatalogCategory | undefined {
+  return CATALOG_CATEGORIES.find((cat) => cat.id === id);
+}
+
+export function getAllCategories(): CatalogCategory[] {
+  return CATALOG_CATEGORIES;
+}
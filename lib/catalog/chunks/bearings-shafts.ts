@@ -0,0 +1,6 @@
+// lib/catalog/chunks/bearings-shafts.ts
+// Bearings and shafts part data, expanded on demand by lib/catalog/parts
+
+import { generateBearingsShafts } from '../../generate-catalog-parts';
+
+export default generateBearingsShafts();
@@ -0,0 +1,6 @@
+// lib/catalog/chunks/electrical-iot.ts
+// Electrical and IoT interfaces part data, expanded on demand by lib/catalog/parts
+
+import { generateElectricalIoT } from '../../generate-catalog-parts';
+
+export default generateElectricalIoT();
@@ -0,0 +1,6 @@
+// lib/catalog/chunks/enclosures.ts
+// Enclosures and casings part data, expanded on demand by lib/catalog/parts
+
+import { generateEnclosures } from '../../generate-catalog-parts';
+
+export default generateEnclosures();
@@ -0,0 +1,6 @@
+// lib/catalog/chunks/fasteners.ts
+// Fasteners part data, expanded on demand by lib/catalog/parts
+
+import { generateFasteners } from '../../generate-catalog-parts';
+
+export default generateFasteners();
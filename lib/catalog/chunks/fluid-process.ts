@@ -0,0 +1,6 @@
+// lib/catalog/chunks/fluid-process.ts
+// Fluid and process hardware part data, expanded on demand by lib/catalog/parts
+
+import { generateFluidProcess } from '../../generate-catalog-parts';
+
+export default generateFluidProcess();
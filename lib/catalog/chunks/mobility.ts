@@ -0,0 +1,6 @@
+// lib/catalog/chunks/mobility.ts
+// Mobility and handling part data, expanded on demand by lib/catalog/parts
+
+import { generateMobility } from '../../generate-catalog-parts';
+
+export default generateMobility();
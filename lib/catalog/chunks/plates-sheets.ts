@@ -0,0 +1,6 @@
+// lib/catalog/chunks/plates-sheets.ts
+// Plates, panels and sheets part data, expanded on demand by lib/catalog/parts
+
+import { generatePlatesSheets } from '../../generate-catalog-parts';
+
+export default generatePlatesSheets();
@@ -0,0 +1,6 @@
+// lib/catalog/chunks/power-transmission.ts
+// Power transmission part data, expanded on demand by lib/catalog/parts
+
+import { generatePowerTransmission } from '../../generate-catalog-parts';
+
+export default generatePowerTransmission();
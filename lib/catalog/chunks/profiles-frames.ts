@@ -1,157 +1,7 @@
-/**
- * Catalog Data - 465 Parts Library organized into 11 categories
- * Production-ready parts for manufacturing
- */
+// lib/catalog/chunks/profiles-frames.ts
+// Structural profiles part data, loaded on demand by lib/catalog/parts
 
-export type CategoryId =
-  | 'profiles-frames'
-  | 'plates-sheets'
-  | 'fasteners'
-  | 'bearings-shafts'
-  | 'power-transmission'
-  | 'enclosures'
-  | 'fluid-process'
-  | 'thermal'
-  | 'mobility'
-  | 'electrical-iot'
-  | 'tooling';
-
-export interface CatalogCategory {
-  id: CategoryId;
-  name: string;
-  icon: string;
-  description: string;
-  unlocks: string;
-  count: number;
-}
-
-export interface CatalogPart {
-  id: string;
-  name: string;
-  category: CategoryId;
-  categoryIcon?: string;
-  description: string;
-  unlocksText: string;
-  material: string;
-  process?: string;
-  finish?: string;
-  basePrice: number;
-  leadTime?: string;
-  leadTimeDays?: number;
-  manufacturability?: number;
-  thumbnail?: string;
-  qty?: number;
-  specs?: {
-    width?: number;
-    height?: number;
-    length?: number;
-    diameter?: number;
-    wallThickness?: number;
-    sideLength?: number;
-    unitLength?: number;
-    threadSize?: string;
-    [key: string]: number | string | undefined;
-  };
-  variants?: Array<{
-    id: string;
-    name: string;
-    specs: Record<string, number | string>;
-    priceMultiplier: number;
-  }>;
-  materials?: Array<{ name: string; priceMultiplier: number }>;
-  finishes?: string[];
-}
-
-export const CATALOG_CATEGORIES: CatalogCategory[] = [
-  {
-    id: 'profiles-frames',
-    name: 'Structural Profiles & Frames',
-    icon: '🏗️',
-    description: 'High-reuse backbone of all machines',
-    unlocks: 'Frames, racks, enclosures, carts, machines',
-    count: 80,
-  },
-  {
-    id: 'plates-sheets',
-    name: 'Plates, Panels & Sheets',
-    icon: '📋',
-    description: 'Everything mounts on these',
-    unlocks: 'Assembly surfaces, structural support, aesthetics',
-    count: 60,
-  },
-  {
-    id: 'fasteners',
-    name: 'Fasteners & Joining',
-    icon: '🔩',
-    description: 'Absolutely mandatory. Highest reorder frequency',
-    unlocks: 'Assembly, structural integrity',
-    count: 70,
-  },
-  {
-    id: 'bearings-shafts',
-    name: 'Bearings, Shafts & Motion Core',
-    icon: '⚙️',
-    description: 'Enables all rotating systems',
-    unlocks: 'Rotating equipment, linear motion systems',
-    count: 50,
-  },
-  {
-    id: 'power-transmission',
-    name: 'Power Transmission',
-    icon: '🔧',
-    description: 'Motion scaling without electronics',
-    unlocks: 'Speed/torque adjustment, mechanical advantage',
-    count: 45,
-  },
-  {
-    id: 'enclosures',
-    name: 'Enclosures & Casings',
-    icon: '📦',
-    description: 'Critical for productization',
-    unlocks: 'Finished products, safety, aesthetics',
-    count: 40,
-  },
-  {
-    id: 'fluid-process',
-    name: 'Fluid & Process Hardware',
-    icon: '💧',
-    description: 'Unlocks agro-processing, water, oil, health',
-    unlocks: 'Fluid systems, agricultural equipment, water processing',
-    count: 45,
-  },
-  {
-    id: 'thermal',
-    name: 'Thermal & Energy Components',
-    icon: '🔥',
-    description: 'Low-tech but powerful',
-    unlocks: 'Thermal management, furnaces, ovens, heating systems',
-    count: 30,
-  },
-  {
-    id: 'mobility',
-    name: 'Mobility & Handling',
-    icon: '🛞',
-    description: 'Everything must move',
-    unlocks: 'Mobile equipment, carts, conveyors',
-    count: 30,
-  },
-  {
-    id: 'electrical-iot',
-    name: 'Electrical & IoT Mechanical Interfaces',
-    icon: '⚡',
-    description: 'Hardware meets electronics',
-    unlocks: 'Electromechanical integration, automation',
-    count: 25,
-  },
-  {
-    id: 'tooling',
-    name: 'Tooling & Jigs',
-    icon: '🔨',
-    description: 'These improve the platform itself',
-    unlocks: 'Faster iteration, precision manufacturing, quality improvement',
-    count: 25,
-  },
-];
+import type { CatalogPart } from '../categories';
 
 // ===========================
 // CATEGORY 1: STRUCTURAL PROFILES & FRAMES (80 parts)
@@ -1473,97 +1323,4 @@ const structuralProfiles: CatalogPart[] = [
   },
 ];
 
-// Import generated parts
-import {
-  generatePlatesSheets,
-  generateFasteners,
-  generateBearingsShafts,
-  generatePowerTransmission,
-  generateEnclosures,
-  generateFluidProcess,
-  generateThermal,
-  generateMobility,
-  generateElectricalIoT,
-  generateTooling,
-} from './generate-catalog-parts';
-
-// Combine all parts (465 total)
-export const CATALOG_PARTS: CatalogPart[] = [
-  ...structuralProfiles, // 80 parts
-  ...generatePlatesSheets(), // 60 parts
-  ...generateFasteners(), // 70 parts
-  ...generateBearingsShafts(), // 50 parts
-  ...generatePowerTransmission(), // 45 parts
-  ...generateEnclosures(), // 40 parts
-  ...generateFluidProcess(), // 45 parts
-  ...generateThermal(), // 30 parts
-  ...generateMobility(), // 30 parts
-  ...generateElectricalIoT(), // 25 parts
-  ...generateTooling(), // 25 parts
-];
-
-// Helper functions
-export function getCategoryById(id: CategoryId): CatalogCategory | undefined {
-  return CATALOG_CATEGORIES.find((cat) => cat.id === id);
-}
-
-export function getPartsByCategory(categoryId: CategoryId): CatalogPart[] {
-  return CATALOG_PARTS.filter((part) => part.category === categoryId);
-}
-
-export function getAllCategories(): CatalogCategory[] {
-  return CATALOG_CATEGORIES;
-}
-
-export function searchParts(query: string): CatalogPart[] {
-  const lowerQuery = query.toLowerCase();
-  return CATALOG_PARTS.filter(
-    (part) =>
-      part.name.toLowerCase().includes(lowerQuery) ||
-      part.description.toLowerCase().includes(lowerQuery) ||
-      part.unlocksText.toLowerCase().includes(lowerQuery),
-  );
-}
-
-export function filterParts(filters: {
-  category?: CategoryId;
-  materials?: string[];
-  processes?: string[];
-  finishes?: string[];
-  minPrice?: number;
-  maxPrice?: number;
-}): CatalogPart[] {
-  let filtered = [...CATALOG_PARTS];
-
-  if (filters.category) {
-    filtered = filtered.filter((part) => part.category === filters.category);
-  }
-
-  if (filters.materials && filters.materials.length > 0) {
-    filtered = filtered.filter((part) =>
-      filters.materials!.includes(part.material),
-    );
-  }
-
-  if (filters.processes && filters.processes.length > 0) {
-    filtered = filtered.filter(
-      (part) => part.process && filters.processes!.includes(part.process),
-    );
-  }
-
-  if (filters.finishes && filters.finishes.length > 0) {
-    filtered = filtered.filter(
-      (part) => part.finish && filters.finishes!.includes(part.finish),
-    );
-  }
-
-  if (filters.minPrice !== undefined && filters.maxPrice !== undefined) {
-    filtered = filtered.filter(
-      (part) =>
-        part.basePrice >= filters.minPrice! &&
-        part.basePrice <= filters.maxPrice!,
-    );
-  }
-
-  return filtered;
-}
+export default structuralProfiles;
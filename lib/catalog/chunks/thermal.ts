@@ -0,0 +1,6 @@
+// lib/catalog/chunks/thermal.ts
+// Thermal and energy components part data, expanded on demand by lib/catalog/parts
+
+import { generateThermal } from '../../generate-catalog-parts';
+
+export default generateThermal();
@@ -0,0 +1,6 @@
+// lib/catalog/chunks/tooling.ts
+// Tooling and jigs part data, expanded on demand by lib/catalog/parts
+
+import { generateTooling } from '../../generate-catalog-parts';
+
+export default generateTooling();
@@ -0,0 +1,77 @@
+// lib/catalog/parts.ts
+// Lazy chunked access to the parts library
+//
+// The catalog used to live in one monolithic module that every importer
+// paid for at startup. Part data is now split into per-category chunks
+// (see ./chunks) behind dynamic imports, so the bundler code-splits
+// them and a process only parses the categories it actually serves.
+// Loaded chunks are memoized for the lifetime of the process.
+
+import type { CatalogPart, CategoryId } from './categories';
+import { CATALOG_CATEGORIES } from './categories';
+
+// Dynamic imports keep each chunk out of the initial bundle; the
+// record is exhaustive over CategoryId so a new category cannot be
+// added without wiring its chunk.
+const chunkLoaders: Record<CategoryId, () => Promise<{ default: CatalogPart[] }>> = {
+  'profiles-frames': () => import('./chunks/profiles-frames'),
+  'plates-sheets': () => import('./chunks/plates-sheets'),
+  fasteners: () => import('./chunks/fasteners'),
+  'bearings-shafts': () => import('./chunks/bearings-shafts'),
+  'power-transmission': () => import('./chunks/power-transmission'),
+  enclosures: () => import('./chunks/enclosures'),
+  'fluid-process': () => import('./chunks/fluid-process'),
+  thermal: () => import('./chunks/thermal'),
+  mobility: () => import('./chunks/mobility'),
+  'electrical-iot': () => import('./chunks/electrical-iot'),
+  tooling: () => import('./chunks/tooling'),
+};
+
+const loadedChunks = new Map<CategoryId, Promise<CatalogPart[]>>();
+
+/** Load one category's parts, memoized per process */
+export function loadPartsForCategory(categoryId: CategoryId): Promise<CatalogPart[]> {
+  let chunk = loadedChunks.get(categoryId);
+  if (!chunk) {
+    chunk = chunkLoaders[categoryId]().then((m) => m.default);
+    loadedChunks.set(categoryId, chunk);
+  }
+  return chunk;
+}
+
+/**
+ * Load the full parts library (all chunks). Search and unfiltered
+ * listings need everything; category-scoped callers should prefer
+ * loadPartsForCategory so they touch one chunk.
+ */
+export async function loadAllParts(): Promise<CatalogPart[]> {
+  const chunks = await Promise.all(
+    CATALOG_CATEGORIES.map((cat) => loadPartsForCategory(cat.id))
+  );
+  return chunks.flat();
+}
+
+// id -> part index, built lazily on first lookup
+let partIndexPromise: Promise<Map<string, CatalogPart>> | null = null;
+
+/** Find one part by id, loading chunks on first use */
+export function findPartById(partId: string): Promise<CatalogPart | undefined> {
+  if (!partIndexPromise) {
+    partIndexPromise = loadAllParts().then(
+      (parts) => new Map(parts.map((part) => [part.id, part]))
+    );
+  }
+  return partIndexPromise.then((index) => index.get(partId));
+}
+
+/** Search across name, description and unlocks text */
+export async function searchParts(query: string): Promise<CatalogPart[]> {
+  const lowerQuery = query.toLowerCase();
+  const parts = await loadAllParts();
+  return parts.filter(
+    (part) =>
+      part.name.toLowerCase().includes(lowerQuery) ||
+      part.description.toLowerCase().includes(lowerQuery) ||
+      part.unlocksText.toLowerCase().includes(lowerQuery)
+  );
+}
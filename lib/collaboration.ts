@@ -1,6 +1,7 @@
 // Y.js CRDT and WebSocket provider setup for real-time collaboration
 import * as Y from "yjs"
 import { WebsocketProvider } from "y-websocket"
+import { supabase } from "./supabaseClient"
 
 interface CollaborationConfig {
   roomName: string
@@ -9,16 +10,48 @@ interface CollaborationConfig {
   awareness?: boolean
 }
 
+// How often the elected client writes a compacted snapshot. Long-lived
+// rooms accumulate tombstones in the update history; a week-old session
+// replays megabytes on join unless someone periodically rewrites the
+// state without its history.
+const SNAPSHOT_INTERVAL_MS = 5 * 60 * 1000
+
+// Snapshots travel through a text column; no Buffer in the browser
+function toBase64(bytes: Uint8Array): string {
+  let binary = ""
+  for (let i = 0; i < bytes.length; i++) {
+    binary += String.fromCharCode(bytes[i])
+  }
+  return btoa(binary)
+}
+
+function fromBase64(encoded: string): Uint8Array {
+  const binary = atob(encoded)
+  const bytes = new Uint8Array(binary.length)
+  for (let i = 0; i < binary.length; i++) {
+    bytes[i] = binary.charCodeAt(i)
+  }
+  return bytes
+}
+
 export class CollaborationManager {
   private ydoc: Y.Doc
   private provider: WebsocketProvider | null = null
   private ymap: Y.Map<any>
   private yarray: Y.Array<any>
+  // objectId -> subdocument. Each workspace object lives in its own
+  // Y.Doc so joining clients sync only what the viewport shows; the
+  // rest stays an unloaded stub until loadObject is called.
+  private yobjects: Y.Map<Y.Doc>
+  private snapshotTimer: ReturnType<typeof setInterval> | null = null
+  private roomName: string
 
   constructor(config: CollaborationConfig) {
     this.ydoc = new Y.Doc()
+    this.roomName = config.roomName
     this.ymap = this.ydoc.getMap("workspace")
     this.yarray = this.ydoc.getArray("operations")
+    this.yobjects = this.ydoc.getMap("objects")
 
     const wsUrl = process.env.NEXT_PUBLIC_WS_URL || "ws://localhost:3002"
 
@@ -36,6 +69,10 @@ export class CollaborationManager {
         color: this.getRandomColor(),
       })
     }
+
+    this.snapshotTimer = setInterval(() => {
+      void this.maybePersistSnapshot()
+    }, SNAPSHOT_INTERVAL_MS)
   }
 
   private getRandomColor(): string {
@@ -63,6 +100,109 @@ export class CollaborationManager {
     this.yarray.observe(callback)
   }
 
+  // ===== SUBDOCUMENTS =====
+
+  /**
+   * Get (or create) the subdocument holding one workspace object.
+   * Subdocs are not auto-loaded: creation registers the stub in the
+   * shared map, but its content only syncs after loadObject.
+   */
+  public getObjectDoc(objectId: string): Y.Doc {
+    let subdoc = this.yobjects.get(objectId)
+    if (!subdoc) {
+      subdoc = new Y.Doc({ autoLoad: false })
+      this.yobjects.set(objectId, subdoc)
+    }
+    return subdoc
+  }
+
+  /** Start syncing one object's subdocument (viewport entered) */
+  public loadObject(objectId: string) {
+    this.getObjectDoc(objectId).load()
+  }
+
+  /** Release an object's content from memory (viewport left). The stub
+   * stays registered, so loading again resyncs from peers. */
+  public unloadObject(objectId: string) {
+    this.yobjects.get(objectId)?.destroy()
+  }
+
+  /** Ids of every object registered in the room, loaded or not */
+  public getObjectIds(): string[] {
+    return Array.from(this.yobjects.keys())
+  }
+
+  // ===== SNAPSHOT COMPACTION =====
+
+  /**
+   * Serialize the current workspace state into a fresh document,
+   * discarding tombstones and update history. Joining from this blob
+   * replays one compact update instead of the room's whole life.
+   */
+  public encodeCompactSnapshot(): Uint8Array {
+    const fresh = new Y.Doc()
+    fresh.transact(() => {
+      const map = fresh.getMap("workspace")
+      this.ymap.forEach((value, key) => map.set(key, value))
+      const array = fresh.getArray("operations")
+      array.push(this.yarray.toArray())
+      // Subdoc stubs are re-registered; their content compacts in their
+      // own rooms, not here
+      const objects = fresh.getMap("objects")
+      this.yobjects.forEach((_doc, key) => objects.set(key, new Y.Doc({ autoLoad: false })))
+    })
+    const snapshot = Y.encodeStateAsUpdate(fresh)
+    fresh.destroy()
+    return snapshot
+  }
+
+  /** Apply a persisted snapshot (used to warm a fresh join before the
+   * websocket sync completes) */
+  public applySnapshot(snapshot: Uint8Array) {
+    Y.applyUpdate(this.ydoc, snapshot)
+  }
+
+  /**
+   * Write a compacted snapshot to the realtime tables, but only from
+   * one client: the lowest awareness clientID acts as the compactor so
+   * N collaborators do not race N identical writes.
+   */
+  private async maybePersistSnapshot() {
+    const awareness = this.provider?.awareness
+    if (!awareness) return
+    const clientIds = Array.from(awareness.getStates().keys())
+    if (clientIds.length > 0 && Math.min(...clientIds) !== this.ydoc.clientID) return
+
+    try {
+      const snapshot = this.encodeCompactSnapshot()
+      await supabase.from("collaboration_snapshots").upsert(
+        {
+          room_name: this.roomName,
+          snapshot: toBase64(snapshot),
+          updated_at: new Date().toISOString(),
+        },
+        { onConflict: "room_name" }
+      )
+    } catch (error) {
+      console.warn("Snapshot compaction failed (will retry next interval):", error)
+    }
+  }
+
+  /** Fetch the latest compacted snapshot for a room, if any */
+  public static async fetchSnapshot(roomName: string): Promise<Uint8Array | null> {
+    try {
+      const { data, error } = await supabase
+        .from("collaboration_snapshots")
+        .select("snapshot")
+        .eq("room_name", roomName)
+        .single()
+      if (error || !data?.snapshot) return null
+      return fromBase64(data.snapshot)
+    } catch {
+      return null
+    }
+  }
+
   public updateCursor(position: { x: number; y: number }) {
     if (this.provider?.awareness) {
       const state = this.provider.awareness.getLocalState()
@@ -84,6 +224,10 @@ export class CollaborationManager {
   }
 
   public destroy() {
+    if (this.snapshotTimer) {
+      clearInterval(this.snapshotTimer)
+      this.snapshotTimer = null
+    }
     this.provider?.destroy()
     this.ydoc.destroy()
   }
@@ -104,6 +104,85 @@ Example inputs and outputs:
 If you cannot parse the intent, respond with an error object:
 {"error": "Unable to parse design intent", "message": "Specific reason why parsing failed"}`
 
+// ===== PARTIAL JSON PARSING =====
+
+// Closes an unfinished JSON prefix: terminates an open string, strips a
+// dangling comma, and appends the missing closers. Returns null when the
+// prefix ends mid-value (e.g. after a colon) and cannot be completed.
+function closePartialJson(prefix: string): string | null {
+  const stack: string[] = []
+  let inString = false
+  let escaped = false
+
+  for (let i = 0; i < prefix.length; i++) {
+    const ch = prefix[i]
+    if (inString) {
+      if (escaped) {
+        escaped = false
+      } else if (ch === '\\') {
+        escaped = true
+      } else if (ch === '"') {
+        inString = false
+      }
+      continue
+    }
+    if (ch === '"') inString = true
+    else if (ch === '{') stack.push('}')
+    else if (ch === '[') stack.push(']')
+    else if (ch === '}' || ch === ']') stack.pop()
+  }
+
+  let completed = prefix
+  if (inString) {
+    if (escaped) completed = completed.slice(0, -1)
+    completed += '"'
+  }
+
+  const trimmed = completed.trimEnd()
+  if (trimmed.endsWith(':')) return null
+  completed = trimmed.endsWith(',') ? trimmed.slice(0, -1) : trimmed
+
+  return completed + stack.reverse().join('')
+}
+
+/**
+ * Parses the longest valid JSON object out of a streaming prefix.
+ *
+ * Completed nodes in the partial response parse immediately; the
+ * trailing unfinished token is truncated back to the last comma or
+ * opening bracket until the prefix closes cleanly. Returns null while
+ * no object boundary has streamed in yet.
+ */
+export function parsePartialJson(raw: string): any | null {
+  const start = raw.indexOf('{')
+  if (start < 0) return null
+
+  let candidate = raw.slice(start)
+  // Each pass strictly shortens the candidate, so this terminates fast
+  for (let attempt = 0; attempt < 32 && candidate.length > 1; attempt++) {
+    const completed = closePartialJson(candidate)
+    if (completed) {
+      try {
+        return JSON.parse(completed)
+      } catch {
+        // Fall through to truncate the trailing partial token
+      }
+    }
+
+    const lastComma = candidate.lastIndexOf(',')
+    const lastOpen = Math.max(candidate.lastIndexOf('{'), candidate.lastIndexOf('['))
+    if (lastOpen > lastComma && lastOpen > 0) {
+      candidate = candidate.slice(0, lastOpen + 1)
+    } else if (lastComma > 0) {
+      candidate = candidate.slice(0, lastComma)
+    } else {
+      return null
+    }
+  }
+
+  return null
+}
+
 export class DeepseekClient {
   private config: DeepseekConfig
 
@@ -150,6 +229,87 @@ export class DeepseekClient {
     }
   }
 
+  // Streams a chat completion, invoking onContent with the accumulated
+  // text after every delta. Resolves with the full response content.
+  private async makeStreamingRequest(
+    messages: DeepseekMessage[],
+    onContent: (content: string) => void,
+    maxTokens?: number
+  ): Promise<string> {
+    const controller = new AbortController()
+    const timeoutId = setTimeout(() => controller.abort(), this.config.timeout)
+
+    try {
+      const response = await fetch(`${this.config.baseUrl}/chat/completions`, {
+        method: 'POST',
+        headers: {
+          'Content-Type': 'application/json',
+          'Authorization': `Bearer ${this.config.apiKey}`,
+        },
+        body: JSON.stringify({
+          model: this.config.model,
+          messages,
+          max_tokens: maxTokens ?? 2048,
+          temperature: 0.1,
+          stream: true,
+        }),
+        signal: controller.signal,
+      })
+
+      if (!response.ok) {
+        const errorText = await response.text()
+        throw new Error(`Deepseek API error (${response.status}): ${errorText}`)
+      }
+      if (!response.body) {
+        throw new Error('Deepseek API returned no response body for stream')
+      }
+
+      const reader = response.body.getReader()
+      const decoder = new TextDecoder()
+      let buffer = ''
+      let content = ''
+
+      while (true) {
+        const { done, value } = await reader.read()
+        if (done) break
+
+        buffer += decoder.decode(value, { stream: true })
+
+        // SSE frames are newline-delimited; a frame split across reads
+        // stays in the buffer until its newline arrives
+        let newline: number
+        while ((newline = buffer.indexOf('\n')) >= 0) {
+          const line = buffer.slice(0, newline).trim()
+          buffer = buffer.slice(newline + 1)
+
+          if (!line.startsWith('data:')) continue
+          const data = line.slice(5).trim()
+          if (data === '[DONE]') continue
+
+          try {
+            const chunk = JSON.parse(data)
+            const delta = chunk.choices?.[0]?.delta?.content
+            if (delta) {
+              content += delta
+              onContent(content)
+            }
+          } catch {
+            // Malformed frame; skip it rather than aborting the stream
+          }
+        }
+      }
+
+      clearTimeout(timeoutId)
+      return content
+    } catch (error) {
+      clearTimeout(timeoutId)
+      if (error instanceof Error && error.name === 'AbortError') {
+        throw new Error('Deepseek API request timed out')
+      }
+      throw error
+    }
+  }
+
   private parseJsonResponse(content: string): any {
     // Try to extract JSON from the response
     const jsonMatch = content.match(/\{[\s\S]*\}/)
@@ -217,6 +377,72 @@ export class DeepseekClient {
     }
   }
 
+  /**
+   * Streaming variant of generateGeometry.
+   *
+   * Tokens are consumed as the model writes; whenever the partial JSON
+   * yields a new parsable intent snapshot, onPartialIntent fires with
+   * the normalized intent so the caller can speculatively compile it.
+   * Resolves with the same validated response as generateGeometry.
+   */
+  async generateGeometryStream(
+    userIntent: string,
+    onPartialIntent: (intent: GeometryIntent) => void,
+    conversationHistory?: DeepseekMessage[]
+  ): Promise<DeepseekResponse> {
+    const messages: DeepseekMessage[] = [
+      { role: 'system', content: GEOMETRY_SYSTEM_PROMPT },
+    ]
+
+    if (conversationHistory && conversationHistory.length > 0) {
+      messages.push(...conversationHistory.slice(-5))
+    }
+
+    messages.push({ role: 'user', content: userIntent })
+
+    let lastEmitted = ''
+
+    try {
+      const responseContent = await this.makeStreamingRequest(messages, (partial) => {
+        const parsed = parsePartialJson(partial)
+        // The model may wrap the spec in an "intent" envelope
+        const candidate = parsed?.intent ?? parsed
+        if (!candidate || typeof candidate !== 'object' || !candidate.type) return
+
+        const normalized = this.validateAndNormalizeIntent(candidate)
+        const key = JSON.stringify(normalized)
+        if (key === lastEmitted) return
+
+        lastEmitted = key
+        onPartialIntent(normalized)
+      })
+
+      const parsedResponse = this.parseJsonResponse(responseContent)
+
+      if (parsedResponse.error) {
+        return {
+          intent: this.createDefaultIntent(userIntent),
+          error: parsedResponse.error,
+        }
+      }
+
+      const validatedIntent = this.validateAndNormalizeIntent(parsedResponse.intent ?? parsedResponse)
+
+      return {
+        intent: validatedIntent,
+        conversationHistory: [
+          ...(messages.slice(1) as DeepseekMessage[]),
+          { role: 'assistant', content: JSON.stringify(validatedIntent) },
+        ],
+      }
+    } catch (error) {
+      return {
+        intent: this.createDefaultIntent(userIntent),
+        error: error instanceof Error ? error.message : 'Unknown error',
+      }
+    }
+  }
+
   async refineGeometry(
     currentIntent: GeometryIntent,
     refinementRequest: string,
@@ -426,6 +652,15 @@ export async function generateGeometryFromIntent(
   return client.generateGeometry(userIntent, conversationHistory)
 }
 
+export async function streamGeometryFromIntent(
+  userIntent: string,
+  onPartialIntent: (intent: GeometryIntent) => void,
+  conversationHistory?: DeepseekMessage[]
+): Promise<DeepseekResponse> {
+  const client = getDeepseekClient()
+  return client.generateGeometryStream(userIntent, onPartialIntent, conversationHistory)
+}
+
 export async function refineGeometryWithIntent(
   currentIntent: GeometryIntent,
   refinementRequest: string,
@@ -3,7 +3,7 @@
  * This creates the full 465-part library
  */
 
-import type { CatalogPart, CategoryId } from './catalog-data';
+import type { CatalogPart, CategoryId } from './catalog/categories';
 
 // ===========================
 // CATEGORY 2: PLATES, PANELS & SHEETS (60 parts)
@@ -0,0 +1,100 @@
+// Shared BufferGeometry pool keyed by mesh content hash
+//
+// Every workspace object used to hold its own copy of identical vertex
+// buffers — a catalog bracket placed 30 times kept 30 uploads of the
+// same geometry on the GPU. The pool deduplicates: meshes acquire a
+// geometry by content key and share the same BufferGeometry instance;
+// refcounting disposes the buffers only when the last user releases.
+//
+// Materials stay per-mesh: selection and hover mutate material state in
+// place, so they cannot be shared.
+
+import * as THREE from 'three';
+
+interface PoolEntry {
+  geometry: THREE.BufferGeometry;
+  refCount: number;
+}
+
+const pool = new Map<string, PoolEntry>();
+
+/**
+ * Content hash (FNV-1a) over raw mesh buffers
+ * @param vertices Vertex positions
+ * @param indices Triangle indices
+ * @param normals Optional vertex normals
+ * @returns Hex digest stable for identical mesh content
+ */
+export function hashMeshData(
+  vertices: Float32Array | number[],
+  indices: Uint32Array | number[],
+  normals?: Float32Array | number[]
+): string {
+  let hash = 0x811c9dc5;
+
+  const mix = (bytes: Uint8Array) => {
+    for (let i = 0; i < bytes.length; i++) {
+      hash ^= bytes[i];
+      hash = Math.imul(hash, 0x01000193);
+    }
+  };
+
+  const view = (data: Float32Array | Uint32Array | number[]) => {
+    if (ArrayBuffer.isView(data)) {
+      return new Uint8Array(data.buffer, data.byteOffset, data.byteLength);
+    }
+    return new Uint8Array(new Float64Array(data).buffer);
+  };
+
+  mix(view(vertices));
+  mix(view(indices));
+  if (normals) mix(view(normals));
+
+  return (hash >>> 0).toString(16);
+}
+
+/**
+ * Gets the pooled geometry for a content key, building it on first use
+ * @param key Content key (mesh hash or parametric signature)
+ * @param build Factory invoked only when the key is not pooled yet
+ * @returns Shared BufferGeometry; call releaseGeometry when done with it
+ */
+export function acquireGeometry(key: string, build: () => THREE.BufferGeometry): THREE.BufferGeometry {
+  const existing = pool.get(key);
+  if (existing) {
+    existing.refCount++;
+    return existing.geometry;
+  }
+
+  const geometry = build();
+  pool.set(key, { geometry, refCount: 1 });
+  return geometry;
+}
+
+/**
+ * Releases one reference to a pooled geometry, disposing GPU buffers
+ * when the last reference drops
+ * @param key Content key the geometry was acquired under
+ */
+export function releaseGeometry(key: string): void {
+  const entry = pool.get(key);
+  if (!entry) return;
+
+  entry.refCount--;
+  if (entry.refCount <= 0) {
+    entry.geometry.dispose();
+    pool.delete(key);
+  }
+}
+
+/**
+ * Pool introspection for perf overlays and tests
+ * @returns Entry count and total references across the pool
+ */
+export function getGeometryPoolStats(): { entries: number; references: number } {
+  let references = 0;
+  pool.forEach((entry) => {
+    references += entry.refCount;
+  });
+  return { entries: pool.size, references };
+}
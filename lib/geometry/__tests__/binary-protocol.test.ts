@@ -0,0 +1,183 @@
+import { describe, it, expect } from 'vitest'
+import { encodeGeometryIR, decodeCompileResult, PROTOCOL_VERSION } from '../binary-protocol'
+import type { GeometryIR } from '../intent-ast'
+
+const sampleIR: GeometryIR = {
+  part: 'bracket',
+  operations: [
+    {
+      id: 'box1',
+      type: 'box',
+      parameters: { width: 10, height: 5, depth: 2.5 },
+      transform: {
+        position: [1, 2, 3],
+        rotation: [0, 0, 0],
+        scale: [1, 1, 1],
+      },
+      timestamp: 1234.5,
+    },
+    {
+      id: 'hole1',
+      type: 'hole',
+      target: 'box1',
+      parameters: { diameter: 3, axis: 'z' },
+      timestamp: 1240,
+    },
+  ],
+  constraints: [{ type: 'min_wall_thickness', value: 1.5 }],
+  hash: 'abc123',
+}
+
+// Builds a binary CompileResult the way protocol.rs does, so the
+// decoder can be exercised without a WASM build
+function buildResponse(opts: {
+  status: number
+  hash: string
+  error?: { code: string; message: string }
+  mesh?: { vertices: number[]; indices: number[]; normals: number[] }
+}): Uint8Array {
+  const parts: number[] = [0x51, 0x43, 0x52, PROTOCOL_VERSION, opts.status]
+  const pushU32 = (v: number) => {
+    const b = new Uint8Array(4)
+    new DataView(b.buffer).setUint32(0, v, true)
+    parts.push(...b)
+  }
+  const pushString = (s: string) => {
+    const bytes = new TextEncoder().encode(s)
+    pushU32(bytes.length)
+    parts.push(...bytes)
+  }
+  const pushF32s = (values: number[]) => {
+    pushU32(values.length)
+    for (const v of values) {
+      const b = new Uint8Array(4)
+      new DataView(b.buffer).setFloat32(0, v, true)
+      parts.push(...b)
+    }
+  }
+
+  pushString(opts.hash)
+
+  if (opts.error) {
+    parts.push(1)
+    pushString(opts.error.code)
+    pushString(opts.error.message)
+  } else {
+    parts.push(0)
+  }
+
+  if (opts.mesh) {
+    parts.push(1)
+    pushF32s(opts.mesh.vertices)
+    pushU32(opts.mesh.indices.length)
+    for (const i of opts.mesh.indices) pushU32(i)
+    pushF32s(opts.mesh.normals)
+  } else {
+    parts.push(0)
+  }
+
+  parts.push(0) // no extras
+  return new Uint8Array(parts)
+}
+
+describe('binary-protocol', () => {
+  describe('encodeGeometryIR', () => {
+    it('emits the request magic and version header', () => {
+      const bytes = encodeGeometryIR(sampleIR)
+
+      expect(Array.from(bytes.subarray(0, 3))).toEqual([0x51, 0x49, 0x52]) // "QIR"
+      expect(bytes[3]).toBe(PROTOCOL_VERSION)
+    })
+
+    it('encodes the part name after the header', () => {
+      const bytes = encodeGeometryIR(sampleIR)
+      const view = new DataView(bytes.buffer)
+
+      const partLength = view.getUint32(4, true)
+      expect(partLength).toBe('bracket'.length)
+      expect(new TextDecoder().decode(bytes.subarray(8, 8 + partLength))).toBe('bracket')
+    })
+
+    it('is deterministic regardless of parameter insertion order', () => {
+      const reordered: GeometryIR = {
+        ...sampleIR,
+        operations: [
+          {
+            ...sampleIR.operations[0],
+            parameters: { depth: 2.5, width: 10, height: 5 },
+          } as any,
+          sampleIR.operations[1],
+        ],
+      }
+
+      expect(encodeGeometryIR(reordered)).toEqual(encodeGeometryIR(sampleIR))
+    })
+
+    it('rejects intents outside the binary schema', () => {
+      const extrusion: GeometryIR = {
+        ...sampleIR,
+        operations: [
+          { id: 'e1', type: 'extrusion', parameters: { depth: 5 }, timestamp: 0 },
+        ],
+      }
+
+      expect(() => encodeGeometryIR(extrusion)).toThrow(/no binary encoding/)
+    })
+  })
+
+  describe('decodeCompileResult', () => {
+    it('decodes a compiled result with mesh buffers', () => {
+      const bytes = buildResponse({
+        status: 0,
+        hash: 'deadbeef',
+        mesh: {
+          vertices: [0, 1, 2, 3, 4, 5],
+          indices: [0, 1, 0],
+          normals: [0, 0, 1, 0, 0, 1],
+        },
+      })
+
+      const result = decodeCompileResult(bytes)
+
+      expect(result.status).toBe('compiled')
+      expect(result.intentHash).toBe('deadbeef')
+      expect(result.error).toBeNull()
+      expect(result.mesh).not.toBeNull()
+      expect(Array.from(result.mesh!.vertices)).toEqual([0, 1, 2, 3, 4, 5])
+      expect(Array.from(result.mesh!.indices)).toEqual([0, 1, 0])
+      expect(result.mesh!.vertices).toBeInstanceOf(Float32Array)
+      expect(result.mesh!.indices).toBeInstanceOf(Uint32Array)
+    })
+
+    it('decodes an error result', () => {
+      const bytes = buildResponse({
+        status: 3,
+        hash: '',
+        error: { code: 'INVALID_INTENT', message: 'no operations' },
+      })
+
+      const result = decodeCompileResult(bytes)
+
+      expect(result.status).toBe('error')
+      expect(result.error).toEqual({ code: 'INVALID_INTENT', message: 'no operations' })
+      expect(result.mesh).toBeNull()
+    })
+
+    it('rejects a payload with the wrong magic', () => {
+      const bytes = buildResponse({ status: 0, hash: 'x' })
+      bytes[0] = 0x58
+
+      expect(() => decodeCompileResult(bytes)).toThrow(/magic/)
+    })
+
+    it('rejects truncated payloads', () => {
+      const bytes = buildResponse({
+        status: 0,
+        hash: 'deadbeef',
+        mesh: { vertices: [0, 1, 2], indices: [0], normals: [0, 0, 1] },
+      })
+
+      expect(() => decodeCompileResult(bytes.subarray(0, bytes.length - 8))).toThrow(/truncated/)
+    })
+  })
+})
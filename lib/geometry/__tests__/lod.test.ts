@@ -0,0 +1,92 @@
+import { describe, it, expect } from 'vitest'
+import {
+  projectedScreenSize,
+  segmentsForScreenSize,
+  boundingRadiusForOperation,
+  refinedSegmentTargets,
+  coarseSegmentTargets,
+  COARSE_SEGMENTS,
+  type LodContext,
+} from '../lod'
+
+const context: LodContext = {
+  cameraDistance: 500,
+  fovDegrees: 50,
+  viewportHeight: 1080,
+}
+
+describe('projectedScreenSize', () => {
+  it('grows as the object approaches the camera', () => {
+    const far = projectedScreenSize(50, { ...context, cameraDistance: 2000 })
+    const near = projectedScreenSize(50, { ...context, cameraDistance: 200 })
+
+    expect(near).toBeGreaterThan(far)
+  })
+
+  it('returns zero for degenerate inputs', () => {
+    expect(projectedScreenSize(0, context)).toBe(0)
+    expect(projectedScreenSize(50, { ...context, cameraDistance: 0 })).toBe(0)
+  })
+})
+
+describe('segmentsForScreenSize', () => {
+  it('keeps tiny on-screen objects coarse', () => {
+    expect(segmentsForScreenSize(10)).toBe(16)
+  })
+
+  it('refines objects filling the viewport to the top level', () => {
+    expect(segmentsForScreenSize(1080)).toBe(128)
+  })
+
+  it('steps monotonically with projected size', () => {
+    expect(segmentsForScreenSize(50)).toBeGreaterThanOrEqual(segmentsForScreenSize(10))
+    expect(segmentsForScreenSize(500)).toBeGreaterThanOrEqual(segmentsForScreenSize(50))
+  })
+})
+
+describe('boundingRadiusForOperation', () => {
+  it('computes the half-diagonal for boxes', () => {
+    const radius = boundingRadiusForOperation('CREATE_BOX', {
+      width: 2,
+      height: 2,
+      depth: 1,
+    })
+    expect(radius).toBeCloseTo(1.5)
+  })
+
+  it('includes the tube for tori', () => {
+    expect(
+      boundingRadiusForOperation('CREATE_TORUS', { majorRadius: 100, minorRadius: 30 })
+    ).toBe(130)
+  })
+
+  it('returns zero for unknown operations', () => {
+    expect(boundingRadiusForOperation('BOOLEAN_UNION', {})).toBe(0)
+  })
+})
+
+describe('segment targets', () => {
+  it('coarse pass clamps curved primitives', () => {
+    expect(coarseSegmentTargets('CREATE_SPHERE')).toEqual({
+      segmentsLat: COARSE_SEGMENTS,
+      segmentsLon: COARSE_SEGMENTS,
+    })
+    expect(coarseSegmentTargets('CREATE_BOX')).toBeNull()
+  })
+
+  it('falls back to requested segments without a LOD context', () => {
+    expect(refinedSegmentTargets('CREATE_CYLINDER', { segments: 48 })).toEqual({
+      segments: 48,
+    })
+  })
+
+  it('uses screen-space error when a context is provided', () => {
+    // Torus at close range fills the screen: expect the top level
+    const targets = refinedSegmentTargets(
+      'CREATE_TORUS',
+      { majorRadius: 100, minorRadius: 30 },
+      { cameraDistance: 300, fovDegrees: 50, viewportHeight: 1080 }
+    )
+    expect(targets?.segmentsMajor).toBe(128)
+  })
+})
@@ -0,0 +1,335 @@
+import { GeometryIR, Intent, PrimitiveIntent, OperationIntent } from './intent-ast'
+
+/**
+ * Compact binary protocol for the WASM boundary
+ *
+ * Mirrors `wasm/geometry-kernel/src/protocol.rs` byte for byte. The JSON
+ * interface stringifies every intent and parses every result; for small
+ * parameter edits that serialization rivals tessellation time. This
+ * encoding is little-endian, carried as Uint8Array, and returns mesh
+ * buffers as raw f32/u32 words so decoding is a typed-array view instead
+ * of JSON.parse.
+ *
+ * Keep the tag tables in sync with the Rust side — the version byte
+ * exists so either end can reject a mismatched peer cleanly.
+ */
+
+export const PROTOCOL_VERSION = 1
+
+const REQUEST_MAGIC = [0x51, 0x49, 0x52] // "QIR"
+const RESPONSE_MAGIC = [0x51, 0x43, 0x52] // "QCR"
+
+const PRIMITIVE_TAGS: Record<string, number> = {
+  box: 0,
+  cylinder: 1,
+  sphere: 2,
+  cone: 3,
+  torus: 4,
+}
+
+const OPERATION_TAGS: Record<string, number> = {
+  union: 0,
+  subtract: 1,
+  intersect: 2,
+  fillet: 3,
+  hole: 4,
+  chamfer: 5,
+}
+
+const CONSTRAINT_TAGS: Record<string, number> = {
+  min_wall_thickness: 0,
+  tool_diameter: 1,
+  max_overhang: 2,
+  process: 3,
+  material: 4,
+}
+
+const STATUS_NAMES = ['compiled', 'cached', 'fallback', 'error'] as const
+
+// Transform presence bits
+const HAS_POSITION = 1
+const HAS_ROTATION = 1 << 1
+const HAS_SCALE = 1 << 2
+
+// Operation parameter value kinds
+const PARAM_NUMBER = 0
+const PARAM_JSON = 1
+
+const textEncoder = new TextEncoder()
+const textDecoder = new TextDecoder()
+
+// ===== WRITER =====
+
+class BinaryWriter {
+  private buf = new Uint8Array(1024)
+  private view = new DataView(this.buf.buffer)
+  private length = 0
+
+  private ensure(extra: number) {
+    if (this.length + extra <= this.buf.length) return
+    let capacity = this.buf.length * 2
+    while (capacity < this.length + extra) capacity *= 2
+    const next = new Uint8Array(capacity)
+    next.set(this.buf.subarray(0, this.length))
+    this.buf = next
+    this.view = new DataView(next.buffer)
+  }
+
+  u8(v: number) {
+    this.ensure(1)
+    this.buf[this.length] = v
+    this.length += 1
+  }
+
+  u32(v: number) {
+    this.ensure(4)
+    this.view.setUint32(this.length, v, true)
+    this.length += 4
+  }
+
+  f64(v: number) {
+    this.ensure(8)
+    this.view.setFloat64(this.length, v, true)
+    this.length += 8
+  }
+
+  string(s: string) {
+    const bytes = textEncoder.encode(s)
+    this.u32(bytes.length)
+    this.ensure(bytes.length)
+    this.buf.set(bytes, this.length)
+    this.length += bytes.length
+  }
+
+  bytes(raw: number[]) {
+    this.ensure(raw.length)
+    this.buf.set(raw, this.length)
+    this.length += raw.length
+  }
+
+  finish(): Uint8Array {
+    return this.buf.slice(0, this.length)
+  }
+}
+
+// ===== READER =====
+
+class BinaryReader {
+  private view: DataView
+  private pos = 0
+
+  constructor(private buf: Uint8Array) {
+    this.view = new DataView(buf.buffer, buf.byteOffset, buf.byteLength)
+  }
+
+  private take(n: number): number {
+    if (this.pos + n > this.buf.byteLength) {
+      throw new Error(`Binary payload truncated at offset ${this.pos}`)
+    }
+    const at = this.pos
+    this.pos += n
+    return at
+  }
+
+  u8(): number {
+    return this.view.getUint8(this.take(1))
+  }
+
+  u32(): number {
+    return this.view.getUint32(this.take(4), true)
+  }
+
+  string(): string {
+    const len = this.u32()
+    const at = this.take(len)
+    return textDecoder.decode(this.buf.subarray(at, at + len))
+  }
+
+  // Copies via slice: the payload offset is not guaranteed to be
+  // 4-byte aligned, so a direct typed-array view would throw
+  f32Array(): Float32Array {
+    const len = this.u32()
+    const at = this.take(len * 4)
+    return new Float32Array(this.buf.slice(at, at + len * 4).buffer)
+  }
+
+  u32Array(): Uint32Array {
+    const len = this.u32()
+    const at = this.take(len * 4)
+    return new Uint32Array(this.buf.slice(at, at + len * 4).buffer)
+  }
+}
+
+// ===== REQUEST ENCODING =====
+
+function isPrimitive(intent: Intent): intent is PrimitiveIntent {
+  return !('target' in intent)
+}
+
+function encodePrimitive(w: BinaryWriter, p: PrimitiveIntent) {
+  const tag = PRIMITIVE_TAGS[p.type]
+  if (tag === undefined) {
+    throw new Error(`Primitive type '${p.type}' has no binary encoding`)
+  }
+
+  w.string(p.id)
+  w.u8(tag)
+  w.f64(p.timestamp)
+
+  let flags = 0
+  if (p.transform?.position) flags |= HAS_POSITION
+  if (p.transform?.rotation) flags |= HAS_ROTATION
+  if (p.transform?.scale) flags |= HAS_SCALE
+  w.u8(flags)
+  for (const field of [p.transform?.position, p.transform?.rotation, p.transform?.scale]) {
+    if (!field) continue
+    w.f64(field[0])
+    w.f64(field[1])
+    w.f64(field[2])
+  }
+
+  // Sorted for deterministic output, matching the Rust encoder
+  const keys = Object.keys(p.parameters).sort()
+  w.u32(keys.length)
+  for (const key of keys) {
+    w.string(key)
+    w.f64(p.parameters[key])
+  }
+}
+
+function encodeOperation(w: BinaryWriter, o: OperationIntent) {
+  const tag = OPERATION_TAGS[o.type]
+  if (tag === undefined) {
+    throw new Error(`Operation type '${o.type}' has no binary encoding`)
+  }
+
+  w.string(o.id)
+  w.u8(tag)
+  w.string(o.target)
+  if (o.operand !== undefined) {
+    w.u8(1)
+    w.string(o.operand)
+  } else {
+    w.u8(0)
+  }
+  w.f64(o.timestamp)
+
+  const keys = Object.keys(o.parameters).sort()
+  w.u32(keys.length)
+  for (const key of keys) {
+    w.string(key)
+    const value = o.parameters[key]
+    if (typeof value === 'number') {
+      w.u8(PARAM_NUMBER)
+      w.f64(value)
+    } else {
+      w.u8(PARAM_JSON)
+      w.string(JSON.stringify(value))
+    }
+  }
+}
+
+/**
+ * Encode a GeometryIR into the binary request format.
+ *
+ * Throws when the intent uses a type the protocol cannot represent
+ * (e.g. 'extrusion' primitives) — callers fall back to the JSON path.
+ */
+export function encodeGeometryIR(ir: GeometryIR): Uint8Array {
+  const w = new BinaryWriter()
+  w.bytes(REQUEST_MAGIC)
+  w.u8(PROTOCOL_VERSION)
+  w.string(ir.part)
+
+  w.u32(ir.operations.length)
+  for (const op of ir.operations) {
+    if (isPrimitive(op)) {
+      w.u8(0)
+      encodePrimitive(w, op)
+    } else {
+      w.u8(1)
+      encodeOperation(w, op)
+    }
+  }
+
+  w.u32(ir.constraints.length)
+  for (const c of ir.constraints) {
+    const tag = CONSTRAINT_TAGS[c.type]
+    if (tag === undefined) {
+      throw new Error(`Constraint type '${c.type}' has no binary encoding`)
+    }
+    w.u8(tag)
+    w.string(JSON.stringify(c.value))
+  }
+
+  return w.finish()
+}
+
+// ===== RESPONSE DECODING =====
+
+export interface DecodedCompileResult {
+  status: 'compiled' | 'cached' | 'fallback' | 'error'
+  intentHash: string
+  error: { code: string; message: string } | null
+  mesh: {
+    vertices: Float32Array
+    indices: Uint32Array
+    normals: Float32Array
+  } | null
+  step: any | null
+  topology: any | null
+  mfgReport: any | null
+}
+
+/**
+ * Decode the binary CompileResult format produced by
+ * `GeometryKernel.compile_intent_binary`.
+ */
+export function decodeCompileResult(bytes: Uint8Array): DecodedCompileResult {
+  const r = new BinaryReader(bytes)
+
+  for (const expected of RESPONSE_MAGIC) {
+    if (r.u8() !== expected) {
+      throw new Error('Bad binary response magic')
+    }
+  }
+  const version = r.u8()
+  if (version !== PROTOCOL_VERSION) {
+    throw new Error(`Unsupported binary protocol version ${version}`)
+  }
+
+  const statusTag = r.u8()
+  const status = STATUS_NAMES[statusTag]
+  if (!status) {
+    throw new Error(`Unknown status tag ${statusTag}`)
+  }
+
+  const intentHash = r.string()
+
+  let error: DecodedCompileResult['error'] = null
+  if (r.u8() !== 0) {
+    error = { code: r.string(), message: r.string() }
+  }
+
+  let mesh: DecodedCompileResult['mesh'] = null
+  if (r.u8() !== 0) {
+    mesh = {
+      vertices: r.f32Array(),
+      indices: r.u32Array(),
+      normals: r.f32Array(),
+    }
+  }
+
+  // Cold-path fields ride along as one JSON blob when present
+  let step = null
+  let topology = null
+  let mfgReport = null
+  if (r.u8() !== 0) {
+    const extras = JSON.parse(r.string())
+    step = extras.step ?? null
+    topology = extras.topology ?? null
+    mfgReport = extras.mfg_report ?? null
+  }
+
+  return { status, intentHash, error, mesh, step, topology, mfgReport }
+}
@@ -1,6 +1,13 @@
-// Execution Engine - Orchestrates geometry operations through the Cadmium worker
+// Execution Engine - Orchestrates geometry operations through the Cadmium worker pool
 
 import type { GeometryOperation } from './operation-sequencer'
+import {
+  coarseSegmentTargets,
+  refinedSegmentTargets,
+  type LodContext,
+  type SegmentTargets,
+} from './lod'
+import { CadmiumWorkerPool } from '../cadmium-worker-pool'
 import * as THREE from 'three'
 
 export interface ExecutionProgress {
@@ -21,11 +28,21 @@ export interface MeshData {
   normals: Float32Array | number[]
 }
 
+// One node of the operation dependency DAG built from the sequencer
+interface DagNode {
+  operation: GeometryOperation
+  inputs: string[]
+  dependents: string[]
+  remaining: number
+}
+
 export class ExecutionEngine {
-  private worker: Worker | null = null
-  private pendingRequests = new Map<string, { resolve: (value: any) => void; reject: (error: Error) => void }>()
+  private pool: CadmiumWorkerPool | null = null
   private isReady = false
   private geometryCache = new Map<string, any>()
+  // Rendering id -> worker id of its refined (full-quality) geometry.
+  // Exports must use the refined mesh, not the coarse interaction one.
+  private refinedIds = new Map<string, string>()
   private initPromise: Promise<void> | null = null
   private initTimeoutId: ReturnType<typeof setTimeout> | null = null
   private useFallbackMode = false
@@ -59,48 +76,21 @@ export class ExecutionEngine {
   private async initWorker(): Promise<void> {
     return new Promise((resolve, reject) => {
       try {
-        this.worker = new Worker('/workers/cadmium-worker.js', {
-          type: 'module',
-          name: 'cadmium-worker'
-        })
-
-        // Set up message handler first, before worker sends READY
-        this.worker.onmessage = (event) => {
-          const { id, type, result, error } = event.data
-
-          if (type === 'READY') {
-            this.isReady = true
-            console.log('✅ Execution engine worker ready')
-            
-            // Clear initialization timeout
-            if (this.initTimeoutId) {
-              clearTimeout(this.initTimeoutId)
-              this.initTimeoutId = null
-            }
-            
-            resolve()  // Resolve the initialization promise
-            return
-          }
-
-          const pending = this.pendingRequests.get(id)
-          if (!pending) {
-            console.warn('Received response for unknown request:', id)
-            return
+        // One pool shared by every sequence; independent DAG branches
+        // land on separate workers and genuinely run concurrently.
+        this.pool = new CadmiumWorkerPool(undefined, (ready) => {
+          if (!ready) return
+          this.isReady = true
+          console.log('✅ Execution engine worker pool ready')
+
+          // Clear initialization timeout
+          if (this.initTimeoutId) {
+            clearTimeout(this.initTimeoutId)
+            this.initTimeoutId = null
           }
 
-          this.pendingRequests.delete(id)
-
-          if (type === 'ERROR' || error) {
-            pending.reject(new Error(error || 'Unknown worker error'))
-          } else {
-            pending.resolve(result)
-          }
-        }
-
-        this.worker.onerror = (error) => {
-          console.error('Worker error:', error)
-          reject(error)
-        }
+          resolve()  // Resolve the initialization promise
+        })
 
         // Set initialization timeout (10 seconds)
         this.initTimeoutId = setTimeout(() => {
@@ -109,7 +99,7 @@ export class ExecutionEngine {
         }, 10000)
 
       } catch (error) {
-        console.error('Failed to initialize execution engine worker:', error)
+        console.error('Failed to initialize execution engine worker pool:', error)
         reject(error)
       }
     })
@@ -165,11 +155,12 @@ export class ExecutionEngine {
         throw new Error(`Unknown geometry type: ${type}`)
     }
     
-    // Convert to our mesh format
-    const meshData = {
-      vertices: Array.from(geometry.attributes.position.array),
-      indices: geometry.index ? Array.from(geometry.index.array) : [],
-      normals: Array.from(geometry.attributes.normal.array)
+    // Convert to our mesh format; keep the typed-array views so they
+    // feed THREE.BufferAttribute without copying.
+    const meshData: MeshData = {
+      vertices: new Float32Array(geometry.attributes.position.array),
+      indices: geometry.index ? new Uint32Array(geometry.index.array) : new Uint32Array(0),
+      normals: new Float32Array(geometry.attributes.normal.array)
     }
     
     return {
@@ -179,70 +170,255 @@ export class ExecutionEngine {
   }
 
   /**
-   * Executes a sequence of geometry operations
+   * Executes a sequence of geometry operations as a dependency DAG
+   *
+   * Operations whose inputs are already available dispatch immediately,
+   * so independent branches — two unrelated bodies, or the primitives
+   * feeding a later boolean — compile concurrently across the worker
+   * pool, and each geometry streams through the mesh callback the
+   * moment it completes rather than after the last sequential step.
+   *
+   * When a mesh callback is provided, streaming create operations run
+   * at coarse tessellation first so the user sees geometry while still
+   * dragging; a background refinement pass then re-runs the sequence at
+   * the screen-space-error target and streams the refined mesh through
+   * the same callback under the same geometry id.
    */
   async executeSequence(
     operations: GeometryOperation[],
     onProgress?: ProgressCallback,
-    onMeshUpdate?: MeshCallback
+    onMeshUpdate?: MeshCallback,
+    lodContext?: LodContext
   ): Promise<string> {
     if (!this.isReady && !this.useFallbackMode) {
       throw new Error('Execution engine not ready')
     }
+    if (operations.length === 0) {
+      return ''
+    }
+
+    const nodes = this.buildDag(operations)
+    const results = new Map<string, any>()
+    const total = operations.length
+    let completed = 0
+    let needsRefinement = false
+
+    await new Promise<void>((resolve, reject) => {
+      let failed = false
+
+      const dispatch = (node: DagNode) => {
+        let operation = node.operation
+
+        // Coarse first pass: only when progressive delivery is possible,
+        // so one-shot callers still get full quality directly.
+        if (onMeshUpdate && !this.useFallbackMode && operation.streaming) {
+          const coarse = coarseSegmentTargets(operation.operation)
+          if (coarse) {
+            operation = this.withSegmentTargets(operation, coarse)
+            needsRefinement = true
+          }
+        }
+
+        // Input geometry comes from this node's own dependency, not a
+        // shared "last result" — parallel branches carry separate lineages
+        const inputGeometryId = node.inputs.reduce(
+          (id, inputOpId) => results.get(inputOpId)?.geometryId ?? id,
+          ''
+        )
+
+        onProgress?.({
+          current: completed,
+          total,
+          operation,
+          status: 'running',
+        })
+
+        this.executeOperation(operation, inputGeometryId)
+          .then((result) => {
+            if (failed) return
+            completed++
+            results.set(node.operation.id, result)
+
+            onProgress?.({
+              current: completed,
+              total,
+              operation,
+              status: 'complete',
+              result,
+            })
+
+            // If operation produces a geometry, cache it and notify
+            if (result?.geometryId) {
+              this.geometryCache.set(result.geometryId, result)
+
+              if (result.mesh && onMeshUpdate) {
+                onMeshUpdate(result.geometryId, result.mesh)
+              }
+            }
+
+            // Unlock dependents whose inputs are now all available
+            for (const dependentId of node.dependents) {
+              const dependent = nodes.get(dependentId)!
+              dependent.remaining--
+              if (dependent.remaining === 0) {
+                dispatch(dependent)
+              }
+            }
+
+            if (completed === total) {
+              resolve()
+            }
+          })
+          .catch((error) => {
+            if (failed) return
+            failed = true
+
+            onProgress?.({
+              current: completed + 1,
+              total,
+              operation,
+              status: 'error',
+              error: error instanceof Error ? error.message : String(error),
+            })
+
+            reject(error instanceof Error ? error : new Error(String(error)))
+          })
+      }
+
+      // All roots start at once; everything else fires as inputs land
+      const ready = Array.from(nodes.values()).filter((node) => node.remaining === 0)
+      if (ready.length === 0) {
+        reject(new Error('Operation graph has no executable roots (circular dependencies?)'))
+        return
+      }
+      for (const node of ready) {
+        dispatch(node)
+      }
+    })
 
+    // Deterministic final id regardless of completion order: the last
+    // operation in sequence order that produced geometry, matching the
+    // old sequential semantics.
     let lastGeometryId = ''
+    for (const operation of operations) {
+      const geometryId = results.get(operation.id)?.geometryId
+      if (geometryId) {
+        lastGeometryId = geometryId
+      }
+    }
+
+    // Refine in the background; interaction continues on the coarse mesh
+    if (needsRefinement && lastGeometryId && onMeshUpdate) {
+      void this.refineSequence(operations, lastGeometryId, onMeshUpdate, lodContext)
+    }
+
+    return lastGeometryId
+  }
 
-    for (let i = 0; i < operations.length; i++) {
-      const operation = operations[i]
+  /**
+   * Builds the dependency DAG for a sequence
+   *
+   * The sequencer records only structural dependencies (every feature
+   * depends on the base geometry). Feature, modify and boolean
+   * operations consume their input and produce a replacement, so two
+   * features on the same body are chained here even though the
+   * sequencer lists them as siblings; operations on genuinely
+   * independent lineages share no edges and dispatch in parallel.
+   */
+  private buildDag(operations: GeometryOperation[]): Map<string, DagNode> {
+    const nodes = new Map<string, DagNode>()
+    // Operation id -> id of the operation holding the latest version of
+    // that operation's geometry lineage
+    const lineageTail = new Map<string, string>()
+
+    for (const operation of operations) {
+      const inputs: string[] = []
+      for (const depId of operation.dependsOn) {
+        const tail = lineageTail.get(depId) ?? depId
+        if (nodes.has(tail) && !inputs.includes(tail)) {
+          inputs.push(tail)
+        }
+      }
 
-      onProgress?.({
-        current: i,
-        total: operations.length,
+      nodes.set(operation.id, {
         operation,
-        status: 'running',
+        inputs,
+        dependents: [],
+        remaining: inputs.length,
       })
 
-      try {
-        let result: any
-        
-        // Use fallback for basic shapes if in fallback mode
-        if (this.useFallbackMode) {
-          result = await this.executeFallbackOperation(operation, lastGeometryId)
-        } else {
-          result = await this.executeOperation(operation, lastGeometryId)
+      if (operation.type === 'FEATURE' || operation.type === 'MODIFY' || operation.type === 'BOOLEAN') {
+        for (const depId of operation.dependsOn) {
+          lineageTail.set(depId, operation.id)
         }
+      }
+    }
 
-        onProgress?.({
-          current: i + 1,
-          total: operations.length,
-          operation,
-          status: 'complete',
-          result,
-        })
+    for (const node of nodes.values()) {
+      for (const inputId of node.inputs) {
+        nodes.get(inputId)!.dependents.push(node.operation.id)
+      }
+    }
 
-        // If operation produces a geometry, cache it and notify
-        if (result?.geometryId) {
-          lastGeometryId = result.geometryId
-          this.geometryCache.set(result.geometryId, result)
+    return nodes
+  }
 
-          if (result.mesh && onMeshUpdate) {
-            onMeshUpdate(result.geometryId, result.mesh)
-          }
-        }
-      } catch (error) {
-        onProgress?.({
-          current: i + 1,
-          total: operations.length,
-          operation,
-          status: 'error',
-          error: error instanceof Error ? error.message : String(error),
-        })
+  /**
+   * Re-runs a sequence at refined tessellation and streams the result
+   * under the original rendering id, so the renderer swaps buffers in
+   * place rather than tracking a second geometry.
+   */
+  private async refineSequence(
+    operations: GeometryOperation[],
+    renderGeometryId: string,
+    onMeshUpdate: MeshCallback,
+    lodContext?: LodContext
+  ): Promise<void> {
+    try {
+      let lastGeometryId = ''
+      let lastResult: any = null
+
+      for (const operation of operations) {
+        const refined = refinedSegmentTargets(
+          operation.operation,
+          operation.parameters,
+          lodContext
+        )
+        const refinedOperation = refined
+          ? this.withSegmentTargets(operation, refined)
+          : operation
 
-        throw error
+        lastResult = await this.executeOperation(refinedOperation, lastGeometryId)
+
+        if (lastResult?.geometryId) {
+          lastGeometryId = lastResult.geometryId
+        }
       }
+
+      if (!lastResult?.mesh || !lastGeometryId) return
+
+      this.refinedIds.set(renderGeometryId, lastGeometryId)
+      this.geometryCache.set(renderGeometryId, { ...lastResult, geometryId: renderGeometryId })
+
+      onMeshUpdate(renderGeometryId, lastResult.mesh)
+    } catch (error) {
+      // The coarse mesh is already on screen; a failed refinement only
+      // leaves the object at interaction quality.
+      console.warn('⚠️ LOD refinement failed, keeping coarse mesh:', error)
     }
+  }
 
-    return lastGeometryId
+  /**
+   * Clones an operation with segment parameters overridden
+   */
+  private withSegmentTargets(
+    operation: GeometryOperation,
+    targets: SegmentTargets
+  ): GeometryOperation {
+    return {
+      ...operation,
+      parameters: { ...operation.parameters, ...targets },
+    }
   }
 
   /**
@@ -292,8 +468,8 @@ export class ExecutionEngine {
    * Executes a single geometry operation
    */
   private async executeOperation(operation: GeometryOperation, currentGeometryId: string): Promise<any> {
-    if (!this.worker && !this.useFallbackMode) {
-      throw new Error('Worker not initialized')
+    if (!this.pool && !this.useFallbackMode) {
+      throw new Error('Worker pool not initialized')
     }
 
     // If in fallback mode, use fallback operation
@@ -301,44 +477,10 @@ export class ExecutionEngine {
       return this.executeFallbackOperation(operation, currentGeometryId)
     }
 
-    const requestId = this.generateRequestId()
-    
-    // Map operation to worker message format
+    // Map operation to worker message format. The pool handles worker
+    // placement, geometry pinning and the per-operation timeout.
     const payload = this.mapOperationToPayload(operation, currentGeometryId)
-
-    return new Promise((resolve, reject) => {
-      this.pendingRequests.set(requestId, { resolve, reject })
-
-      this.worker!.postMessage({
-        id: requestId,
-        operation: operation.operation,
-        payload,
-      })
-
-      // Timeout after 30 seconds
-      const timeoutId = setTimeout(() => {
-        if (this.pendingRequests.has(requestId)) {
-          this.pendingRequests.delete(requestId)
-          reject(new Error(`Operation ${operation.operation} timed out`))
-        }
-      }, 30000)
-
-      // Store timeout for cleanup
-      const pending = this.pendingRequests.get(requestId)
-      if (pending) {
-        // Override pending to include timeout cleanup
-        this.pendingRequests.set(requestId, {
-          resolve: (value) => {
-            clearTimeout(timeoutId)
-            resolve(value)
-          },
-          reject: (error) => {
-            clearTimeout(timeoutId)
-            reject(error)
-          }
-        })
-      }
-    })
+    return this.pool!.run(operation.operation, payload)
   }
 
   /**
@@ -419,6 +561,12 @@ export class ExecutionEngine {
           geometryId2: params.toolGeometryId,
         }
 
+      case 'ANALYZE_DFM':
+        return {
+          geometryId: currentGeometryId,
+          options: params.options,
+        }
+
       case 'EXPORT_STL':
         return {
           geometryId: currentGeometryId,
@@ -443,12 +591,23 @@ export class ExecutionEngine {
     return this.geometryCache.get(geometryId)
   }
 
+  /**
+   * True when operations run in the worker rather than the THREE.js fallback
+   */
+  isWorkerReady(): boolean {
+    return this.isReady && !this.useFallbackMode
+  }
+
   /**
    * Exports geometry to file format
    */
   async exportGeometry(geometryId: string, format: 'stl' | 'obj'): Promise<string> {
     const operation = format === 'stl' ? 'EXPORT_STL' : 'EXPORT_OBJ'
-    
+
+    // Export the refined geometry when one exists; the rendering id may
+    // point at the coarse interaction mesh.
+    const exportId = this.refinedIds.get(geometryId) ?? geometryId
+
     const result = await this.executeOperation(
       {
         id: this.generateRequestId(),
@@ -459,25 +618,99 @@ export class ExecutionEngine {
         streaming: false,
         description: `Export as ${format.toUpperCase()}`,
       },
-      geometryId
+      exportId
     )
 
     return result.content
   }
 
+  /**
+   * Exports geometry as a binary stream
+   *
+   * Binary STL chunks (and the 3MF package) are pulled from the worker
+   * one at a time, so export memory stays flat regardless of part size
+   * and a download can start with the first chunk.
+   */
+  exportGeometryBinaryStream(
+    geometryId: string,
+    format: 'stl' | '3mf',
+    filename = `model.${format}`,
+    chunkTriangles = 16384
+  ): ReadableStream<Uint8Array> {
+    const exportId = this.refinedIds.get(geometryId) ?? geometryId
+
+    if (format === '3mf') {
+      return new ReadableStream<Uint8Array>({
+        start: async (controller) => {
+          try {
+            const result = await this.runExportOperation('EXPORT_3MF', {
+              geometryId: exportId,
+              filename,
+            })
+            controller.enqueue(result.buffer)
+            controller.close()
+          } catch (error) {
+            controller.error(error)
+          }
+        },
+      })
+    }
+
+    let chunkIndex = 0
+    let totalChunks = Number.POSITIVE_INFINITY
+
+    return new ReadableStream<Uint8Array>({
+      pull: async (controller) => {
+        try {
+          const result = await this.runExportOperation('EXPORT_STL_CHUNK', {
+            geometryId: exportId,
+            filename,
+            chunkIndex,
+            chunkTriangles,
+          })
+
+          totalChunks = result.totalChunks
+          controller.enqueue(result.chunk)
+          chunkIndex++
+
+          if (chunkIndex >= totalChunks) {
+            controller.close()
+          }
+        } catch (error) {
+          controller.error(error)
+        }
+      },
+    })
+  }
+
+  /**
+   * Runs a worker export operation outside a sequence
+   */
+  private runExportOperation(operation: string, parameters: any): Promise<any> {
+    return this.executeOperation(
+      {
+        id: this.generateRequestId(),
+        type: 'EXPORT',
+        operation,
+        parameters,
+        dependsOn: [],
+        streaming: false,
+        description: `Export (${operation})`,
+      },
+      parameters.geometryId
+    )
+  }
+
   /**
    * Clears geometry cache
    */
   clearCache() {
     this.geometryCache.clear()
-    
-    if (this.worker) {
-      const requestId = this.generateRequestId()
-      this.worker.postMessage({
-        id: requestId,
-        operation: 'CLEAR_CACHE',
-        payload: {},
-      })
+    this.refinedIds.clear()
+
+    if (this.pool?.isReady) {
+      // Broadcast: every pool worker drops its geometry cache
+      void this.pool.run('CLEAR_CACHE', {})
     }
   }
 
@@ -489,14 +722,14 @@ export class ExecutionEngine {
   }
 
   /**
-   * Terminates the worker
+   * Terminates the worker pool
    */
   dispose() {
-    if (this.worker) {
-      this.worker.terminate()
-      this.worker = null
+    if (this.pool) {
+      this.pool.destroy()
+      this.pool = null
     }
-    this.pendingRequests.clear()
     this.geometryCache.clear()
+    this.refinedIds.clear()
   }
 }
@@ -1,9 +1,13 @@
 import { GeometryIR } from './intent-ast'
+import { encodeGeometryIR, decodeCompileResult } from './binary-protocol'
+import { getPersistentMeshCache } from './mesh-cache'
 
 /**
  * Enhanced bridge to Rust geometry kernel (WASM)
  * Handles both legacy Intent IR and new Semantic IR systems
  */
+const MAX_PERF_SPANS = 512
+
 export class KernelBridge {
   private kernel: any = null  // Will be the WASM kernel instance
   private isReady = false
@@ -11,6 +15,9 @@ export class KernelBridge {
   private semanticIREnabled = true
   private analysisCache = new Map<string, any>()
   private validationCache = new Map<string, ValidationResult>()
+  // Ring buffer of pipeline timing spans (kernel + bridge) for the
+  // studio perf HUD; always on, bounded, drained by getPerfSpans()
+  private perfSpans: PerfSpan[] = []
 
   /**
    * Initialize WASM kernel
@@ -59,6 +66,19 @@ export class KernelBridge {
    * Compile legacy Intent IR (backward compatibility)
    */
   async compileIntent(ir: GeometryIR): Promise<KernelResult> {
+    // Content-addressed lookup first: the intent hash is canonical, so
+    // a persisted mesh is valid across sessions and skips the kernel
+    // entirely (this is what makes reopening a job near-instant).
+    const persistentCache = getPersistentMeshCache()
+    const cachedMesh = await persistentCache.get(ir.hash)
+    if (cachedMesh) {
+      return {
+        status: 'cached',
+        intentHash: ir.hash,
+        mesh: cachedMesh,
+      }
+    }
+
     if (!this.isReady || !this.kernel) {
       console.warn('Kernel not ready, returning fallback')
       return {
@@ -69,10 +89,25 @@ export class KernelBridge {
       }
     }
 
+    // Prefer the binary protocol when this kernel build exposes it:
+    // no stringify/parse on the hot edit path, and mesh buffers come
+    // back as raw typed-array words
+    if (typeof this.kernel.compile_intent_binary === 'function') {
+      try {
+        return await this.compileIntentBinary(ir)
+      } catch (binaryError) {
+        // Intents outside the binary schema (e.g. extrusion primitives)
+        // take the JSON path below
+        console.warn('Binary protocol unavailable for this intent, using JSON:', binaryError)
+      }
+    }
+
     try {
+      const t0 = performance.now()
       const intentJson = JSON.stringify(ir)
       const resultJson = this.kernel.compile_intent(intentJson)
       const result = JSON.parse(resultJson)
+      this.recordSpan('compile_intent_json', t0)
 
       // Check if result contains an error
       if (result.code === 'COMPILE_ERROR' || result.message) {
@@ -84,14 +119,21 @@ export class KernelBridge {
         }
       }
 
+      const mesh = result.mesh ? {
+        vertices: new Float32Array(result.mesh.vertices),
+        indices: new Uint32Array(result.mesh.indices),
+        normals: new Float32Array(result.mesh.normals),
+      } : null
+
+      // Persist for future sessions, addressed by the canonical hash.
+      if (mesh) {
+        void persistentCache.put(result.intent_hash || ir.hash, mesh)
+      }
+
       return {
         status: result.status,
         intentHash: result.intent_hash,
-        mesh: result.mesh ? {
-          vertices: new Float32Array(result.mesh.vertices),
-          indices: new Uint32Array(result.mesh.indices),
-          normals: new Float32Array(result.mesh.normals),
-        } : null,
+        mesh,
         step: result.step,
         topology: result.topology,
       }
@@ -106,6 +148,145 @@ export class KernelBridge {
     }
   }
 
+  /**
+   * Hot-path compile via the binary protocol (see binary-protocol.ts)
+   */
+  private async compileIntentBinary(ir: GeometryIR): Promise<KernelResult> {
+    const t0 = performance.now()
+    const intentBytes = encodeGeometryIR(ir)
+    const resultBytes: Uint8Array = this.kernel.compile_intent_binary(intentBytes)
+    const result = decodeCompileResult(resultBytes)
+    this.recordSpan('compile_intent_binary', t0)
+
+    if (result.status === 'error') {
+      return {
+        status: 'error',
+        intentHash: ir.hash,
+        mesh: null,
+        error: result.error?.message || 'Compilation error'
+      }
+    }
+
+    // Persist for future sessions, addressed by the canonical hash.
+    if (result.mesh) {
+      void getPersistentMeshCache().put(result.intentHash || ir.hash, result.mesh)
+    }
+
+    return {
+      status: result.status,
+      intentHash: result.intentHash,
+      mesh: result.mesh,
+      step: result.step ?? undefined,
+      topology: result.topology ?? undefined,
+    }
+  }
+
+  /**
+   * Analyze a batch of intents in one WASM call.
+   *
+   * Returns mesh-derived volume, surface area, center of mass and AABB
+   * for every intent, in input order. The kernel compiles through its
+   * shared content-hash cache, so unchanged parts cost a cache hit
+   * rather than a re-tessellation — this is how quoting and the
+   * manufacturability panel get true volumes for N parts without N
+   * boundary crossings. A bad intent yields an error entry for that
+   * item only.
+   */
+  async analyzeBatch(irs: GeometryIR[]): Promise<BatchAnalysisEntry[]> {
+    if (irs.length === 0) return []
+
+    if (!this.isReady || !this.kernel || typeof this.kernel.analyze_batch !== 'function') {
+      console.warn('Kernel not ready, batch analysis unavailable')
+      return irs.map((ir) => ({
+        intentHash: ir.hash,
+        status: 'error' as const,
+        error: 'Kernel not initialized - using fallback mode',
+      }))
+    }
+
+    try {
+      const t0 = performance.now()
+      const resultJson = this.kernel.analyze_batch(JSON.stringify({ intents: irs }))
+      const result = JSON.parse(resultJson)
+      this.recordSpan('analyze_batch', t0)
+
+      if (!Array.isArray(result.results)) {
+        throw new Error(result.error?.message || 'Malformed batch analysis result')
+      }
+
+      return result.results.map((entry: any, index: number) => {
+        if (entry.status !== 'ok') {
+          return {
+            intentHash: entry.intent_hash || irs[index].hash,
+            status: 'error' as const,
+            error: entry.error?.message || 'Analysis error',
+          }
+        }
+        return {
+          intentHash: entry.intent_hash,
+          status: 'ok' as const,
+          volume: entry.volume,
+          surfaceArea: entry.surface_area,
+          centerOfMass: entry.center_of_mass,
+          bboxMin: entry.bbox_min,
+          bboxMax: entry.bbox_max,
+        }
+      })
+    } catch (error) {
+      console.error('Batch analysis error:', error)
+      const message = error instanceof Error ? error.message : 'Unknown error'
+      return irs.map((ir) => ({
+        intentHash: ir.hash,
+        status: 'error' as const,
+        error: message,
+      }))
+    }
+  }
+
+  /**
+   * Derive mesh-driven toolpath metrics for an intent.
+   *
+   * The kernel compiles the intent (cache-hit for unchanged parts),
+   * builds a height-field spatial index over the tessellated mesh and
+   * returns removal volume, silhouette perimeter, projected area,
+   * overhang area and pocket depth in one call — the real numbers the
+   * toolpath strategies need instead of parametric guesses. Returns
+   * null when the kernel is unavailable so callers keep their
+   * parametric fallbacks.
+   */
+  async computeToolpathMetrics(ir: GeometryIR): Promise<ToolpathMeshMetrics | null> {
+    if (!this.isReady || !this.kernel || typeof this.kernel.estimate_toolpath !== 'function') {
+      return null
+    }
+
+    try {
+      const t0 = performance.now()
+      const resultJson = this.kernel.estimate_toolpath(JSON.stringify(ir))
+      const result = JSON.parse(resultJson)
+      this.recordSpan('toolpath_metrics', t0)
+
+      if (result.status !== 'ok' || !result.metrics) {
+        console.warn('Toolpath metrics unavailable:', result.error?.message)
+        return null
+      }
+
+      const m = result.metrics
+      return {
+        partVolumeMm3: m.part_volume,
+        stockVolumeMm3: m.stock_volume,
+        removalVolumeMm3: m.removal_volume,
+        projectedAreaMm2: m.projected_area,
+        perimeterMm: m.perimeter,
+        surfaceAreaMm2: m.surface_area,
+        overhangAreaMm2: m.overhang_area,
+        maxPocketDepthMm: m.max_pocket_depth,
+      }
+    } catch (error) {
+      console.error('Toolpath metrics error:', error)
+      return null
+    }
+  }
+
   /**
    * Compile semantic IR (enhanced system)
    */
@@ -123,9 +304,11 @@ export class KernelBridge {
     }
 
     try {
+      const t0 = performance.now()
       const semanticJson = JSON.stringify(semanticIR)
       const resultJson = this.kernel.compile_semantic_ir(semanticJson)
       const result = JSON.parse(resultJson)
+      this.recordSpan('compile_semantic_ir', t0)
 
       if (result.status === 'error') {
         return {
@@ -277,25 +460,35 @@ export class KernelBridge {
    * Get cache statistics for performance monitoring
    */
   async getCacheStats(): Promise<CacheStats> {
+    const persistent = await getPersistentMeshCache().stats()
+    const persistentStats = {
+      persistent_cache_entries: persistent.entries,
+      persistent_cache_bytes: persistent.bytes,
+      persistent_cache_hits: persistent.hits,
+      persistent_cache_misses: persistent.misses,
+    }
+
     if (!this.isReady || !this.kernel) {
       return {
         compiler_cache_size: 0,
         analyzer_cache_total: 0,
         analyzer_cache_fresh: 0,
-        ir_graph_nodes: 0
+        ir_graph_nodes: 0,
+        ...persistentStats
       }
     }
 
     try {
       const resultJson = this.kernel.get_cache_stats()
-      return JSON.parse(resultJson)
+      return { ...JSON.parse(resultJson), ...persistentStats }
     } catch (error) {
       console.error('Get cache stats error:', error)
       return {
         compiler_cache_size: 0,
         analyzer_cache_total: 0,
         analyzer_cache_fresh: 0,
-        ir_graph_nodes: 0
+        ir_graph_nodes: 0,
+        ...persistentStats
       }
     }
   }
@@ -309,6 +502,7 @@ export class KernelBridge {
     }
     this.analysisCache.clear()
     this.validationCache.clear()
+    await getPersistentMeshCache().clear()
   }
 
   /**
@@ -357,6 +551,105 @@ export class KernelBridge {
   isKernelReady(): boolean {
     return this.isReady && this.kernel !== null
   }
+
+  private recordSpan(name: string, startMs: number, source: PerfSpan['source'] = 'bridge') {
+    if (this.perfSpans.length >= MAX_PERF_SPANS) {
+      this.perfSpans.shift()
+    }
+    this.perfSpans.push({
+      name,
+      source,
+      startMs,
+      durationMs: performance.now() - startMs,
+    })
+  }
+
+  /**
+   * Pull the kernel's internal spans (parse/evaluate/tessellate etc.)
+   * into the bridge ring buffer. The kernel drains on read, so each
+   * span is merged exactly once.
+   */
+  private drainKernelSpans() {
+    if (!this.kernel || typeof this.kernel.take_perf_spans !== 'function') return
+
+    try {
+      const spans = JSON.parse(this.kernel.take_perf_spans())
+      for (const span of spans) {
+        if (this.perfSpans.length >= MAX_PERF_SPANS) {
+          this.perfSpans.shift()
+        }
+        this.perfSpans.push({
+          name: span.name,
+          source: 'kernel',
+          startMs: span.start_ms,
+          durationMs: span.duration_ms,
+        })
+      }
+    } catch {
+      // Older kernel builds without spans: nothing to merge
+    }
+  }
+
+  /**
+   * Drain recorded perf spans (oldest first) for the perf overlay.
+   * Each call returns only spans recorded since the previous one.
+   */
+  getPerfSpans(): PerfSpan[] {
+    this.drainKernelSpans()
+    return this.perfSpans.splice(0, this.perfSpans.length)
+  }
+
+  clearPerfSpans(): void {
+    this.perfSpans = []
+    if (this.kernel && typeof this.kernel.take_perf_spans === 'function') {
+      this.kernel.take_perf_spans()
+    }
+  }
+}
+
+/**
+ * One timed pipeline stage for the perf HUD. Kernel spans come from
+ * inside the WASM compile pipeline; bridge spans cover the boundary
+ * crossing around it. Worker-side spans (queue wait, cache lookup,
+ * transfer) are polled separately via the GET_PERF_SPANS operation.
+ */
+export interface PerfSpan {
+  name: string
+  source: 'kernel' | 'bridge'
+  startMs: number
+  durationMs: number
+}
+
+/**
+ * One item of a KernelBridge.analyzeBatch result. Volumes are in mm³,
+ * areas in mm², coordinates in mm (model space).
+ */
+export interface BatchAnalysisEntry {
+  intentHash: string
+  status: 'ok' | 'error'
+  volume?: number
+  surfaceArea?: number
+  centerOfMass?: [number, number, number]
+  bboxMin?: [number, number, number]
+  bboxMax?: [number, number, number]
+  error?: string
+}
+
+/**
+ * Mesh-derived toolpath quantities from KernelBridge.computeToolpathMetrics.
+ * Removal volume models 3-axis milling from the top; perimeter is the
+ * laser cut length of the part silhouette; overhang area drives
+ * 3D-printing support estimation.
+ */
+export interface ToolpathMeshMetrics {
+  partVolumeMm3: number
+  stockVolumeMm3: number
+  removalVolumeMm3: number
+  projectedAreaMm2: number
+  perimeterMm: number
+  surfaceAreaMm2: number
+  overhangAreaMm2: number
+  maxPocketDepthMm: number
 }
 
 export interface KernelResult {
@@ -496,6 +789,10 @@ export interface CacheStats {
   analyzer_cache_total: number
   analyzer_cache_fresh: number
   ir_graph_nodes: number
+  persistent_cache_entries: number
+  persistent_cache_bytes: number
+  persistent_cache_hits: number
+  persistent_cache_misses: number
 }
 
 export interface KernelInfo {
@@ -0,0 +1,162 @@
+// Screen-space-error driven level-of-detail policy
+//
+// Tessellation density is chosen per object from its projected size on
+// screen, not from a single global subdivision knob: a torus filling
+// the viewport gets 128 segments while an off-screen bracket stays at
+// 16. The execution engine uses these targets for its refinement pass;
+// the coarse pass always runs at COARSE_SEGMENTS so the first mesh
+// appears while the user is still dragging.
+
+import type * as THREE from 'three'
+
+export interface LodContext {
+  /** Distance from the camera to the object (world units) */
+  cameraDistance: number
+  /** Vertical field of view in degrees */
+  fovDegrees: number
+  /** Viewport height in pixels */
+  viewportHeight: number
+}
+
+export interface SegmentTargets {
+  segments?: number
+  segmentsLat?: number
+  segmentsLon?: number
+  segmentsMajor?: number
+  segmentsMinor?: number
+}
+
+// First-pass tessellation: cheap enough to keep interaction at full
+// frame rate even with many objects.
+export const COARSE_SEGMENTS = 12
+export const COARSE_SEGMENTS_MINOR = 8
+
+// Refinement levels, coarse to fine. Doubling steps keep the number of
+// distinct cache entries per object small.
+const SEGMENT_LEVELS = [16, 32, 64, 128]
+
+// Projected-size thresholds (pixels) for stepping up a level.
+const PIXEL_THRESHOLDS = [32, 96, 256]
+
+/**
+ * Projected diameter of a bounding sphere on screen, in pixels
+ */
+export function projectedScreenSize(boundingRadius: number, context: LodContext): number {
+  if (boundingRadius <= 0 || context.cameraDistance <= 0) return 0
+
+  const fovRadians = (context.fovDegrees * Math.PI) / 180
+  const viewHeightAtDistance = 2 * context.cameraDistance * Math.tan(fovRadians / 2)
+  if (viewHeightAtDistance <= 0) return 0
+
+  return ((2 * boundingRadius) / viewHeightAtDistance) * context.viewportHeight
+}
+
+/**
+ * Segment count for a given projected size
+ */
+export function segmentsForScreenSize(pixels: number): number {
+  for (let i = 0; i < PIXEL_THRESHOLDS.length; i++) {
+    if (pixels < PIXEL_THRESHOLDS[i]) return SEGMENT_LEVELS[i]
+  }
+  return SEGMENT_LEVELS[SEGMENT_LEVELS.length - 1]
+}
+
+/**
+ * Estimated bounding-sphere radius of a primitive create operation
+ */
+export function boundingRadiusForOperation(operation: string, params: any): number {
+  const radius = params?.radius ?? (params?.diameter ? params.diameter / 2 : 0)
+
+  switch (operation) {
+    case 'CREATE_BOX': {
+      const w = params?.width ?? 0
+      const h = params?.height ?? 0
+      const d = params?.depth ?? 0
+      return Math.sqrt(w * w + h * h + d * d) / 2
+    }
+    case 'CREATE_CYLINDER':
+    case 'CREATE_CONE': {
+      const h = params?.height ?? 0
+      return Math.sqrt(radius * radius + (h / 2) * (h / 2))
+    }
+    case 'CREATE_SPHERE':
+      return radius
+    case 'CREATE_TORUS':
+      return (params?.majorRadius ?? 0) + (params?.minorRadius ?? 0)
+    default:
+      return 0
+  }
+}
+
+/**
+ * Segment targets for the refinement pass of a create operation
+ *
+ * Without a LOD context (no camera wired up yet) this falls back to the
+ * segment counts the operation asked for, so refinement still restores
+ * the requested quality after the coarse pass.
+ */
+export function refinedSegmentTargets(
+  operation: string,
+  params: any,
+  context?: LodContext
+): SegmentTargets | null {
+  let target: number | null = null
+
+  if (context) {
+    const radius = boundingRadiusForOperation(operation, params)
+    if (radius > 0) {
+      target = segmentsForScreenSize(projectedScreenSize(radius, context))
+    }
+  }
+
+  switch (operation) {
+    case 'CREATE_CYLINDER':
+    case 'CREATE_CONE':
+      return { segments: target ?? params?.segments ?? 32 }
+    case 'CREATE_SPHERE':
+      return {
+        segmentsLat: target ?? params?.segmentsLat ?? 32,
+        segmentsLon: target ?? params?.segmentsLon ?? 32,
+      }
+    case 'CREATE_TORUS':
+      return {
+        segmentsMajor: target ?? params?.segmentsMajor ?? 32,
+        segmentsMinor: target ? Math.max(target / 2, COARSE_SEGMENTS_MINOR) : params?.segmentsMinor ?? 16,
+      }
+    default:
+      // Boxes and booleans have no tessellation knob
+      return null
+  }
+}
+
+/**
+ * Coarse first-pass segment targets for a create operation
+ */
+export function coarseSegmentTargets(operation: string): SegmentTargets | null {
+  switch (operation) {
+    case 'CREATE_CYLINDER':
+    case 'CREATE_CONE':
+      return { segments: COARSE_SEGMENTS }
+    case 'CREATE_SPHERE':
+      return { segmentsLat: COARSE_SEGMENTS, segmentsLon: COARSE_SEGMENTS }
+    case 'CREATE_TORUS':
+      return { segmentsMajor: COARSE_SEGMENTS, segmentsMinor: COARSE_SEGMENTS_MINOR }
+    default:
+      return null
+  }
+}
+
+/**
+ * Build a LOD context from the scene camera
+ */
+export function lodContextFromCamera(
+  camera: THREE.PerspectiveCamera,
+  objectPosition: THREE.Vector3,
+  viewportHeight: number
+): LodContext {
+  return {
+    cameraDistance: camera.position.distanceTo(objectPosition),
+    fovDegrees: camera.fov,
+    viewportHeight,
+  }
+}
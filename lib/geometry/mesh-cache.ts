@@ -0,0 +1,214 @@
+// Persistent content-addressed mesh cache
+//
+// Compiled meshes are stored in IndexedDB keyed by the canonical blake3
+// intent hash the kernel computes (hashing.rs), so reopening a job
+// rehydrates geometry without re-running a single compile. The
+// in-memory LRU inside the cadmium worker dies with the tab; this layer
+// survives it. Entries are pruned least-recently-used once the store
+// exceeds its byte budget.
+
+export interface CachedMesh {
+  vertices: Float32Array
+  indices: Uint32Array
+  normals: Float32Array
+}
+
+export interface PersistentCacheStats {
+  entries: number
+  bytes: number
+  hits: number
+  misses: number
+}
+
+interface CachedMeshRecord {
+  hash: string
+  vertices: ArrayBuffer
+  indices: ArrayBuffer
+  normals: ArrayBuffer
+  bytes: number
+  lastAccessed: number
+}
+
+const DB_NAME = 'qutlas-mesh-cache'
+const DB_VERSION = 1
+const STORE_NAME = 'meshes'
+const MAX_CACHE_BYTES = 256 * 1024 * 1024
+
+export class PersistentMeshCache {
+  private dbPromise: Promise<IDBDatabase | null> | null = null
+  private hits = 0
+  private misses = 0
+
+  private openDb(): Promise<IDBDatabase | null> {
+    if (this.dbPromise) return this.dbPromise
+
+    this.dbPromise = new Promise((resolve) => {
+      if (typeof indexedDB === 'undefined') {
+        // SSR or a locked-down browser context; behave as a cache that
+        // never hits.
+        resolve(null)
+        return
+      }
+
+      const request = indexedDB.open(DB_NAME, DB_VERSION)
+
+      request.onupgradeneeded = () => {
+        const db = request.result
+        if (!db.objectStoreNames.contains(STORE_NAME)) {
+          const store = db.createObjectStore(STORE_NAME, { keyPath: 'hash' })
+          store.createIndex('lastAccessed', 'lastAccessed')
+        }
+      }
+
+      request.onsuccess = () => resolve(request.result)
+      request.onerror = () => {
+        console.warn('Persistent mesh cache unavailable:', request.error)
+        resolve(null)
+      }
+    })
+
+    return this.dbPromise
+  }
+
+  async get(hash: string): Promise<CachedMesh | null> {
+    const db = await this.openDb()
+    if (!db) {
+      this.misses++
+      return null
+    }
+
+    const record = await new Promise<CachedMeshRecord | undefined>((resolve) => {
+      const tx = db.transaction(STORE_NAME, 'readonly')
+      const request = tx.objectStore(STORE_NAME).get(hash)
+      request.onsuccess = () => resolve(request.result)
+      request.onerror = () => resolve(undefined)
+    })
+
+    if (!record) {
+      this.misses++
+      return null
+    }
+
+    this.hits++
+    this.touch(db, record)
+
+    return {
+      vertices: new Float32Array(record.vertices),
+      indices: new Uint32Array(record.indices),
+      normals: new Float32Array(record.normals),
+    }
+  }
+
+  async put(hash: string, mesh: CachedMesh): Promise<void> {
+    const db = await this.openDb()
+    if (!db) return
+
+    // Copy into standalone buffers: the caller's views may be slices of
+    // a larger (or transferred) ArrayBuffer.
+    const record: CachedMeshRecord = {
+      hash,
+      vertices: new Float32Array(mesh.vertices).buffer,
+      indices: new Uint32Array(mesh.indices).buffer,
+      normals: new Float32Array(mesh.normals).buffer,
+      bytes:
+        mesh.vertices.byteLength + mesh.indices.byteLength + mesh.normals.byteLength,
+      lastAccessed: Date.now(),
+    }
+
+    await new Promise<void>((resolve) => {
+      const tx = db.transaction(STORE_NAME, 'readwrite')
+      tx.objectStore(STORE_NAME).put(record)
+      tx.oncomplete = () => resolve()
+      tx.onerror = () => resolve()
+    })
+
+    void this.prune(db)
+  }
+
+  async clear(): Promise<void> {
+    const db = await this.openDb()
+    if (!db) return
+
+    await new Promise<void>((resolve) => {
+      const tx = db.transaction(STORE_NAME, 'readwrite')
+      tx.objectStore(STORE_NAME).clear()
+      tx.oncomplete = () => resolve()
+      tx.onerror = () => resolve()
+    })
+  }
+
+  async stats(): Promise<PersistentCacheStats> {
+    const db = await this.openDb()
+    if (!db) {
+      return { entries: 0, bytes: 0, hits: this.hits, misses: this.misses }
+    }
+
+    return new Promise((resolve) => {
+      const tx = db.transaction(STORE_NAME, 'readonly')
+      const store = tx.objectStore(STORE_NAME)
+      let entries = 0
+      let bytes = 0
+
+      const cursorRequest = store.openCursor()
+      cursorRequest.onsuccess = () => {
+        const cursor = cursorRequest.result
+        if (cursor) {
+          const record = cursor.value as CachedMeshRecord
+          entries++
+          bytes += record.bytes
+          cursor.continue()
+        } else {
+          resolve({ entries, bytes, hits: this.hits, misses: this.misses })
+        }
+      }
+      cursorRequest.onerror = () =>
+        resolve({ entries: 0, bytes: 0, hits: this.hits, misses: this.misses })
+    })
+  }
+
+  // Bump lastAccessed without blocking the read path.
+  private touch(db: IDBDatabase, record: CachedMeshRecord) {
+    try {
+      const tx = db.transaction(STORE_NAME, 'readwrite')
+      tx.objectStore(STORE_NAME).put({ ...record, lastAccessed: Date.now() })
+    } catch {
+      // Best-effort; a failed touch only weakens eviction ordering.
+    }
+  }
+
+  // Evict least-recently-used entries until under the byte budget.
+  private async prune(db: IDBDatabase): Promise<void> {
+    const { bytes } = await this.stats()
+    if (bytes <= MAX_CACHE_BYTES) return
+
+    let excess = bytes - MAX_CACHE_BYTES
+
+    await new Promise<void>((resolve) => {
+      const tx = db.transaction(STORE_NAME, 'readwrite')
+      const index = tx.objectStore(STORE_NAME).index('lastAccessed')
+      const cursorRequest = index.openCursor()
+
+      cursorRequest.onsuccess = () => {
+        const cursor = cursorRequest.result
+        if (cursor && excess > 0) {
+          const record = cursor.value as CachedMeshRecord
+          excess -= record.bytes
+          cursor.delete()
+          cursor.continue()
+        } else {
+          resolve()
+        }
+      }
+      cursorRequest.onerror = () => resolve()
+    })
+  }
+}
+
+let sharedCache: PersistentMeshCache | null = null
+
+export function getPersistentMeshCache(): PersistentMeshCache {
+  if (!sharedCache) {
+    sharedCache = new PersistentMeshCache()
+  }
+  return sharedCache
+}
@@ -0,0 +1,75 @@
+import { describe, it, expect } from 'vitest'
+import { HubIndex, haversineKm, type HubRecord } from '../hub-index'
+
+function hub(id: string, lat: number, lng: number, capabilities = ['cnc machining']): HubRecord {
+  return {
+    id,
+    name: id,
+    capabilities,
+    materials: ['aluminum'],
+    location: { lat, lng },
+  }
+}
+
+describe('haversineKm', () => {
+  it('is zero for identical points and symmetric', () => {
+    expect(haversineKm(48.8, 2.3, 48.8, 2.3)).toBe(0)
+    expect(haversineKm(0, 0, 10, 10)).toBeCloseTo(haversineKm(10, 10, 0, 0))
+  })
+})
+
+describe('HubIndex.match', () => {
+  it('ring 0 finds a hub in the origin cell when a limit is set', () => {
+    // 'near' shares the origin's grid cell; 'far' is on the other side
+    // of the planet. With limit set, the walk must not need extra rings
+    // (or a full scan) to see the origin's own cell.
+    const near = hub('near', 1, 1)
+    const far = hub('far', 1, 178)
+    const index = new HubIndex([far, near])
+
+    const matches = index.match({ origin: { lat: 0, lng: 0 }, limit: 1 })
+
+    expect(matches).toHaveLength(1)
+    expect(matches[0].hub.id).toBe('near')
+    expect(matches[0].distanceKm).toBeLessThan(500)
+  })
+
+  it('wraps longitude rings across the antimeridian', () => {
+    const west = hub('west', 0, -179)
+    const index = new HubIndex([west])
+
+    const matches = index.match({ origin: { lat: 0, lng: 179 }, limit: 1 })
+
+    expect(matches).toHaveLength(1)
+    expect(matches[0].hub.id).toBe('west')
+    // ~2° apart across the date line, not ~358° the long way round
+    expect(matches[0].distanceKm).toBeLessThan(300)
+  })
+
+  it('ranks candidates by great-circle distance', () => {
+    const index = new HubIndex([
+      hub('farther', 20, 20),
+      hub('nearer', 2, 2),
+    ])
+
+    const matches = index.match({ origin: { lat: 0, lng: 0 } })
+
+    expect(matches.map((m) => m.hub.id)).toEqual(['nearer', 'farther'])
+  })
+
+  it('filters by capability before the spatial walk', () => {
+    const index = new HubIndex([
+      hub('mill', 1, 1, ['cnc milling']),
+      hub('print', 1, 1, ['3d printing']),
+    ])
+
+    const matches = index.match({
+      process: 'cnc',
+      origin: { lat: 0, lng: 0 },
+      limit: 5,
+    })
+
+    expect(matches).toHaveLength(1)
+    expect(matches[0].hub.id).toBe('mill')
+  })
+})
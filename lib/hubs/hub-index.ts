@@ -0,0 +1,246 @@
+// lib/hubs/hub-index.ts
+// In-memory geospatial + capability index over the hub network
+//
+// Hub matching sits on the critical path of every checkout. Instead of
+// a linear scan with per-hub lowercase substring checks, the index is
+// built once per hub set and kept warm across requests:
+// - capabilities and materials are interned into bitsets, so a filter
+//   is one bigint AND per hub instead of nested string scans
+// - hubs are bucketed into a lat/lng grid; nearest-hub queries expand
+//   rings outward from the origin cell and only haversine the
+//   candidates that survive the bitset filter
+
+export interface HubLocation {
+  lat: number
+  lng: number
+  city?: string
+  country?: string
+}
+
+export interface HubRecord {
+  id: string
+  name: string
+  capabilities?: string[]
+  materials?: string[]
+  rating?: number
+  currentLoad?: number
+  location?: HubLocation | string
+  basePrice?: number
+  avgLeadTime?: number
+  certified?: boolean
+  completedJobs?: number
+}
+
+export interface HubMatch {
+  hub: HubRecord
+  /** Great-circle distance from the query origin, null without one */
+  distanceKm: number | null
+}
+
+// ~5° cells (~550 km at the equator): coarse enough that a ring holds
+// a useful candidate set, fine enough to skip the far side of the world
+const CELL_DEGREES = 5
+
+// Longitude cell indices run Math.floor(-180 / CELL_DEGREES) ..
+// Math.floor(179.99 / CELL_DEGREES); ring walks wrap within this range
+const LNG_CELLS = 360 / CELL_DEGREES
+const MIN_LNG_CELL = Math.floor(-180 / CELL_DEGREES)
+
+const EARTH_RADIUS_KM = 6371
+
+/** Great-circle distance between two coordinates in kilometers */
+export function haversineKm(lat1: number, lng1: number, lat2: number, lng2: number): number {
+  const toRad = (deg: number) => (deg * Math.PI) / 180
+  const dLat = toRad(lat2 - lat1)
+  const dLng = toRad(lng2 - lng1)
+  const a =
+    Math.sin(dLat / 2) ** 2 +
+    Math.cos(toRad(lat1)) * Math.cos(toRad(lat2)) * Math.sin(dLng / 2) ** 2
+  return 2 * EARTH_RADIUS_KM * Math.asin(Math.sqrt(a))
+}
+
+function coords(hub: HubRecord): HubLocation | null {
+  const loc = hub.location
+  if (!loc || typeof loc === 'string') return null
+  if (typeof loc.lat !== 'number' || typeof loc.lng !== 'number') return null
+  return loc
+}
+
+export class HubIndex {
+  private hubs: HubRecord[]
+  private capabilityBits = new Map<string, bigint>()
+  private materialBits = new Map<string, bigint>()
+  private capabilityMasks: bigint[]
+  private materialMasks: bigint[]
+  // "cellLat:cellLng" -> hub indices in that cell
+  private cells = new Map<string, number[]>()
+
+  constructor(hubs: HubRecord[]) {
+    this.hubs = hubs
+    this.capabilityMasks = new Array(hubs.length)
+    this.materialMasks = new Array(hubs.length)
+
+    for (let i = 0; i < hubs.length; i++) {
+      this.capabilityMasks[i] = this.internAll(this.capabilityBits, hubs[i].capabilities)
+      this.materialMasks[i] = this.internAll(this.materialBits, hubs[i].materials)
+
+      const loc = coords(hubs[i])
+      if (loc) {
+        const key = this.cellKey(loc.lat, loc.lng)
+        const bucket = this.cells.get(key)
+        if (bucket) bucket.push(i)
+        else this.cells.set(key, [i])
+      }
+    }
+  }
+
+  get size(): number {
+    return this.hubs.length
+  }
+
+  private internAll(bits: Map<string, bigint>, tokens?: string[]): bigint {
+    let mask = 0n
+    for (const token of tokens ?? []) {
+      const normalized = token.toLowerCase()
+      let bit = bits.get(normalized)
+      if (bit === undefined) {
+        bit = 1n << BigInt(bits.size)
+        bits.set(normalized, bit)
+      }
+      mask |= bit
+    }
+    return mask
+  }
+
+  // OR of every interned token containing the term, preserving the
+  // substring semantics the linear scan had ("cnc" matches "cnc milling")
+  private termMask(bits: Map<string, bigint>, term: string): bigint {
+    const normalized = term.toLowerCase()
+    let mask = 0n
+    bits.forEach((bit, token) => {
+      if (token.includes(normalized)) mask |= bit
+    })
+    return mask
+  }
+
+  private cellKey(lat: number, lng: number): string {
+    return `${Math.floor(lat / CELL_DEGREES)}:${Math.floor(lng / CELL_DEGREES)}`
+  }
+
+  /**
+   * Matches hubs against capability filters and an optional origin.
+   *
+   * Bitset filters run first; the spatial walk only sees hubs that can
+   * do the job. With an origin, grid rings expand outward until enough
+   * candidates are found, then survivors sort by haversine distance.
+   */
+  match(options: {
+    process?: string
+    material?: string
+    origin?: { lat: number; lng: number }
+    limit?: number
+  }): HubMatch[] {
+    const { process, material, origin } = options
+    const limit = options.limit ?? this.hubs.length
+
+    const capMask = process ? this.termMask(this.capabilityBits, process) : null
+    const matMask = material ? this.termMask(this.materialBits, material) : null
+
+    // A requested capability no hub has: nothing can match
+    if ((capMask !== null && capMask === 0n) || (matMask !== null && matMask === 0n)) {
+      return []
+    }
+
+    const passes = (i: number): boolean => {
+      if (capMask !== null && (this.capabilityMasks[i] & capMask) === 0n) return false
+      if (matMask !== null && (this.materialMasks[i] & matMask) === 0n) return false
+      return true
+    }
+
+    if (!origin) {
+      const matches: HubMatch[] = []
+      for (let i = 0; i < this.hubs.length && matches.length < limit; i++) {
+        if (passes(i)) matches.push({ hub: this.hubs[i], distanceKm: null })
+      }
+      return matches
+    }
+
+    // Ring expansion from the origin cell. One extra ring after the
+    // limit is reached, because the true nearest hub can sit just
+    // across a cell boundary.
+    const originLatCell = Math.floor(origin.lat / CELL_DEGREES)
+    const originLngCell = Math.floor(origin.lng / CELL_DEGREES)
+    const maxRing = Math.ceil(180 / CELL_DEGREES)
+    const candidates: number[] = []
+    const seen = new Set<number>()
+
+    let satisfiedAtRing = -1
+    for (let ring = 0; ring <= maxRing; ring++) {
+      for (let dLat = -ring; dLat <= ring; dLat++) {
+        for (let dLng = -ring; dLng <= ring; dLng++) {
+          if (Math.max(Math.abs(dLat), Math.abs(dLng)) !== ring) continue
+          // Longitude cells wrap around the antimeridian. Shift by
+          // -MIN_LNG_CELL into the non-negative range before the
+          // modulo so the wrapped index stays congruent to the raw one
+          // (and ring 0 lands in the origin's own cell).
+          const lngCell =
+            ((((originLngCell + dLng - MIN_LNG_CELL) % LNG_CELLS) + LNG_CELLS) %
+              LNG_CELLS) +
+            MIN_LNG_CELL
+          const bucket = this.cells.get(`${originLatCell + dLat}:${lngCell}`)
+          if (!bucket) continue
+          for (const i of bucket) {
+            if (seen.has(i)) continue
+            seen.add(i)
+            if (passes(i)) candidates.push(i)
+          }
+        }
+      }
+      if (satisfiedAtRing >= 0 && ring > satisfiedAtRing) break
+      if (candidates.length >= limit && satisfiedAtRing < 0) satisfiedAtRing = ring
+    }
+
+    // Hubs without coordinates still match capability-wise; they rank
+    // after everything with a distance
+    const locless: HubMatch[] = []
+    for (let i = 0; i < this.hubs.length; i++) {
+      if (!coords(this.hubs[i]) && passes(i)) {
+        locless.push({ hub: this.hubs[i], distanceKm: null })
+      }
+    }
+
+    const ranked = candidates
+      .map((i) => {
+        const loc = coords(this.hubs[i])!
+        return {
+          hub: this.hubs[i],
+          distanceKm: haversineKm(origin.lat, origin.lng, loc.lat, loc.lng),
+        }
+      })
+      .sort((a, b) => (a.distanceKm as number) - (b.distanceKm as number))
+
+    return [...ranked, ...locless].slice(0, limit)
+  }
+}
+
+// Warm index cache: rebuilt only when the hub set changes. The
+// fingerprint is cheap (source tag, count, boundary ids) — hub rows are
+// effectively append-only between deploys.
+let cachedIndex: HubIndex | null = null
+let cachedFingerprint = ''
+
+function fingerprint(hubs: HubRecord[], sourceKey: string): string {
+  const first = hubs[0]?.id ?? ''
+  const last = hubs[hubs.length - 1]?.id ?? ''
+  return `${sourceKey}|${hubs.length}|${first}|${last}`
+}
+
+/** Gets the warm index for a hub set, rebuilding only when it changed */
+export function getHubIndex(hubs: HubRecord[], sourceKey: string): HubIndex {
+  const print = fingerprint(hubs, sourceKey)
+  if (!cachedIndex || cachedFingerprint !== print) {
+    cachedIndex = new HubIndex(hubs)
+    cachedFingerprint = print
+  }
+  return cachedIndex
+}
@@ -92,6 +92,77 @@ export interface SaveJobOptions {
 const JOBS_BUCKET = 'jobs'
 const VERSIONS_BUCKET = 'job-versions'
 
+// The first version of every interval is a full base snapshot; the
+// ones in between store only the objects that changed. Keeps version
+// uploads proportional to the edit while bounding how many deltas a
+// load has to replay. Anchoring on the FIRST version of the interval
+// (v1, v11, ...) matters: version numbering starts at 1, so anchoring
+// on multiples of the interval would leave v1-v9 chained to a v0 that
+// is never written.
+export const VERSION_COMPACTION_INTERVAL = 10
+
+// Object-level diff between two workspace states. Autosave uploads this
+// instead of the full workspace, so the payload scales with the edit.
+export interface WorkspaceDelta {
+  changed: Record<string, WorkspaceObject>
+  removed: string[]
+  selectedObjectId: string | null
+  activeTool: string
+}
+
+// Diff two workspace states at object granularity. Returns null when
+// nothing changed (including selection and tool).
+export function diffWorkspace(
+  previous: Job['workspace'],
+  current: Job['workspace']
+): WorkspaceDelta | null {
+  const changed: Record<string, WorkspaceObject> = {}
+  const removed: string[] = []
+
+  for (const [id, obj] of Object.entries(current.objects)) {
+    const prev = previous.objects[id]
+    if (!prev || JSON.stringify(prev) !== JSON.stringify(obj)) {
+      changed[id] = obj
+    }
+  }
+  for (const id of Object.keys(previous.objects)) {
+    if (!(id in current.objects)) {
+      removed.push(id)
+    }
+  }
+
+  const metaChanged =
+    previous.selectedObjectId !== current.selectedObjectId ||
+    previous.activeTool !== current.activeTool
+
+  if (Object.keys(changed).length === 0 && removed.length === 0 && !metaChanged) {
+    return null
+  }
+
+  return {
+    changed,
+    removed,
+    selectedObjectId: current.selectedObjectId,
+    activeTool: current.activeTool,
+  }
+}
+
+// Apply a delta on top of a base workspace state
+export function applyWorkspaceDelta(
+  base: Job['workspace'],
+  delta: WorkspaceDelta
+): Job['workspace'] {
+  const objects = { ...base.objects, ...delta.changed }
+  for (const id of delta.removed) {
+    delete objects[id]
+  }
+  return {
+    objects,
+    selectedObjectId: delta.selectedObjectId,
+    activeTool: delta.activeTool,
+  }
+}
+
 // Generate unique job ID
 export function generateJobId(): string {
   const timestamp = Date.now().toString(36)
@@ -135,12 +206,13 @@ export async function saveJob(
     const jobContent = JSON.stringify(job, null, 2)
     const jobKey = `${userId}/${jobId}.json`
 
-    // Upload job file
+    // Upload job file (gzipped; large meshData blobs compress well)
     await uploadObject({
       bucket: JOBS_BUCKET,
       key: jobKey,
       body: jobContent,
       contentType: 'application/json',
+      compress: true,
     })
 
     // Save metadata to Supabase database (if needed for listing)
@@ -157,24 +229,50 @@ export async function saveJob(
   }
 }
 
-// Save job version
+// Save job version. When previousWorkspace is given and the version
+// number is not a compaction anchor, only the object-level delta is
+// stored; otherwise a full base snapshot is written. Loading replays
+// deltas forward from the nearest base.
 export async function saveJobVersion(
   userId: string,
   jobId: string,
   workspace: Job['workspace'],
-  versionNumber: number
+  versionNumber: number,
+  previousWorkspace?: Job['workspace']
 ): Promise<{ success: boolean; versionNumber: number; error?: string }> {
   try {
     const versionKey = `${userId}/${jobId}/versions/v${versionNumber}.json`
+    const isBase =
+      !previousWorkspace || versionNumber % VERSION_COMPACTION_INTERVAL === 1
+
+    let body: string
+    if (isBase) {
+      body = JSON.stringify({
+        workspace,
+        timestamp: new Date().toISOString(),
+      }, null, 2)
+    } else {
+      // An empty delta is still written so the replay chain back to the
+      // base has no gaps
+      const delta = diffWorkspace(previousWorkspace, workspace) || {
+        changed: {},
+        removed: [],
+        selectedObjectId: workspace.selectedObjectId,
+        activeTool: workspace.activeTool,
+      }
+      body = JSON.stringify({
+        delta,
+        baseVersion: versionNumber - 1,
+        timestamp: new Date().toISOString(),
+      }, null, 2)
+    }
 
     await uploadObject({
       bucket: VERSIONS_BUCKET,
       key: versionKey,
-      body: JSON.stringify({
-        workspace,
-        timestamp: new Date().toISOString(),
-      }, null, 2),
+      body,
       contentType: 'application/json',
+      compress: true,
     })
 
     return { success: true, versionNumber }
@@ -213,23 +311,64 @@ export async function loadJob(
   }
 }
 
-// Load job version
+// Load job version. Delta versions walk back to the nearest base
+// snapshot, then replay deltas forward; the compaction interval bounds
+// the chain length. Chains whose base is missing (legacy versions
+// written before bases anchored on the first version of the interval)
+// fall back to the main job blob rather than failing the restore.
 export async function loadJobVersion(
   userId: string,
   jobId: string,
   versionNumber: number
 ): Promise<{ success: boolean; workspace?: Job['workspace']; error?: string }> {
   try {
-    const versionKey = `${userId}/${jobId}/versions/v${versionNumber}.json`
-    const url = getDownloadUrl({ bucket: VERSIONS_BUCKET, key: versionKey })
+    const deltas: WorkspaceDelta[] = []
+    let version = versionNumber
+    let base: Job['workspace'] | undefined
+
+    const fallbackToJobBlob = async (): Promise<Job['workspace']> => {
+      const { job } = await loadJob(userId, jobId)
+      if (!job?.workspace) {
+        throw new Error(`Version chain for v${versionNumber} has no base snapshot`)
+      }
+      return job.workspace
+    }
 
-    const response = await fetch(url)
-    if (!response.ok) {
-      throw new Error(`Failed to load version: ${response.status}`)
+    while (base === undefined) {
+      if (version < 1) {
+        base = await fallbackToJobBlob()
+        break
+      }
+
+      const versionKey = `${userId}/${jobId}/versions/v${version}.json`
+      const url = getDownloadUrl({ bucket: VERSIONS_BUCKET, key: versionKey })
+
+      const response = await fetch(url)
+      if (!response.ok) {
+        if (response.status === 404) {
+          base = await fallbackToJobBlob()
+          break
+        }
+        throw new Error(`Failed to load version: ${response.status}`)
+      }
+
+      const data = await response.json()
+      if (data.workspace) {
+        base = data.workspace
+      } else if (data.delta) {
+        deltas.unshift(data.delta)
+        version = data.baseVersion ?? version - 1
+      } else {
+        throw new Error(`Version v${version} has neither workspace nor delta`)
+      }
+    }
+
+    let workspace = base
+    for (const delta of deltas) {
+      workspace = applyWorkspaceDelta(workspace, delta)
     }
 
-    const data = await response.json()
-    return { success: true, workspace: data.workspace }
+    return { success: true, workspace }
   } catch (error) {
     console.error('Failed to load job version:', error)
     return {
@@ -239,7 +378,9 @@ export async function loadJobVersion(
   }
 }
 
-// Get presigned URL for download
+// Get presigned URL for download. Job artifacts are stored gzipped
+// with Content-Encoding metadata, so the URL is decompression-aware:
+// browsers and fetch inflate the payload transparently.
 export async function getJobDownloadUrl(
   userId: string,
   jobId: string
@@ -361,6 +502,53 @@ export async function duplicateJob(
   }
 }
 
+// Serializes the tessellated workspace objects to ASCII STL. The
+// payload compresses 4-6x under gzip, which uploadObject applies
+// before the (multipart, for large exports) upload.
+function workspaceToStl(objects: Record<string, WorkspaceObject>): string {
+  const lines: string[] = ['solid qutlas_export']
+
+  for (const object of Object.values(objects)) {
+    const mesh = (object as any).meshData
+    if (!mesh?.vertices || !mesh?.indices) continue
+
+    const vertices: number[] = mesh.vertices
+    const indices: number[] = mesh.indices
+
+    for (let i = 0; i + 2 < indices.length; i += 3) {
+      const a = indices[i] * 3
+      const b = indices[i + 1] * 3
+      const c = indices[i + 2] * 3
+
+      // Facet normal from the triangle edges
+      const ux = vertices[b] - vertices[a]
+      const uy = vertices[b + 1] - vertices[a + 1]
+      const uz = vertices[b + 2] - vertices[a + 2]
+      const vx = vertices[c] - vertices[a]
+      const vy = vertices[c + 1] - vertices[a + 1]
+      const vz = vertices[c + 2] - vertices[a + 2]
+      let nx = uy * vz - uz * vy
+      let ny = uz * vx - ux * vz
+      let nz = ux * vy - uy * vx
+      const len = Math.sqrt(nx * nx + ny * ny + nz * nz) || 1
+      nx /= len
+      ny /= len
+      nz /= len
+
+      lines.push(`  facet normal ${nx} ${ny} ${nz}`)
+      lines.push('    outer loop')
+      lines.push(`      vertex ${vertices[a]} ${vertices[a + 1]} ${vertices[a + 2]}`)
+      lines.push(`      vertex ${vertices[b]} ${vertices[b + 1]} ${vertices[b + 2]}`)
+      lines.push(`      vertex ${vertices[c]} ${vertices[c + 1]} ${vertices[c + 2]}`)
+      lines.push('    endloop')
+      lines.push('  endfacet')
+    }
+  }
+
+  lines.push('endsolid qutlas_export')
+  return lines.join('\n')
+}
+
 // Export job to format
 export async function exportJob(
   userId: string,
@@ -368,13 +556,30 @@ export async function exportJob(
   format: 'stl' | 'step' | 'obj'
 ): Promise<{ success: boolean; url?: string; error?: string }> {
   try {
-    // In a real implementation, this would:
-    // 1. Generate the 3D model in the requested format
-    // 2. Upload to S3
-    // 3. Return presigned URL
-    
-    console.log(`Exporting job ${jobId} as ${format}`)
-    return { success: false, error: 'Export not yet implemented' }
+    if (format !== 'stl') {
+      return { success: false, error: `Export to ${format} not yet implemented` }
+    }
+
+    const { job } = await loadJob(userId, jobId)
+    if (!job) {
+      throw new Error('Job not found')
+    }
+
+    const stl = workspaceToStl(job.workspace.objects || {})
+    const exportKey = `${userId}/${jobId}/exports/model.stl`
+
+    // Stored gzipped with Content-Encoding: gzip; the presigned URL
+    // below decompresses transparently in browsers and fetch
+    await uploadObject({
+      bucket: JOBS_BUCKET,
+      key: exportKey,
+      body: stl,
+      contentType: 'model/stl',
+      compress: true,
+    })
+
+    const url = getDownloadUrl({ bucket: JOBS_BUCKET, key: exportKey, expiresInSeconds: 3600 })
+    return { success: true, url }
   } catch (error) {
     return {
       success: false,
@@ -1,16 +1,40 @@
 // lib/manufacturability/assess.ts
 // Complete manufacturability assessment engine
 
-import { 
-  ALL_CONSTRAINT_CHECKS, 
-  type ConstraintCheck, 
+import {
+  ALL_CONSTRAINT_CHECKS,
+  type ConstraintCheck,
   type ConstraintParams,
   type ConstraintViolation,
-  type Severity 
+  type Severity
 } from './constraints'
+import {
+  getMinWallThickness,
+  getMinFeatureSize,
+  getDraftAngleRequirement,
+} from './rules'
 
 export { type ConstraintViolation, type Severity }
 
+// Mesh-level report from the geometry kernel's ANALYZE_DFM worker
+// operation (field names follow the Rust serialization)
+export interface DetectedHole {
+  diameter: number
+  center: [number, number, number]
+}
+
+export interface MeshDfmReport {
+  min_wall_thickness: number
+  thin_wall_area_fraction: number
+  wall_samples: number
+  min_draft_angle_deg: number
+  undrafted_area_fraction: number
+  holes: DetectedHole[]
+  min_hole_diameter: number
+  is_closed: boolean
+  triangle_count: number
+}
+
 export interface ManufacturabilityIssue {
   id: string
   severity: Severity
@@ -38,6 +62,9 @@ export interface ManufacturabilityAssessmentInput {
   material: string
   process: string
   quantity?: number
+  /** Mesh measurements from the worker's ANALYZE_DFM operation;
+   *  when present, real geometry overrides parametric estimates */
+  meshReport?: MeshDfmReport
 }
 
 // Severity weights for score calculation
@@ -95,6 +122,96 @@ function estimateCostImpact(
   return baseCost * impactMultiplier
 }
 
+/**
+ * Builds the threshold options for the worker's ANALYZE_DFM
+ * operation from the material/process rules, so the kernel flags
+ * the same limits the parametric checks enforce.
+ */
+export function meshDfmOptionsFor(material: string, process: string) {
+  return {
+    min_wall_thickness: getMinWallThickness(material, process),
+    min_draft_angle_deg: getDraftAngleRequirement(process, material),
+  }
+}
+
+// Number of mesh-level checks contributing to passed/total counts
+const MESH_CHECK_COUNT = 3
+
+/**
+ * Converts a mesh analysis report into violations. These carry
+ * measured values from the actual tessellation, so they catch thin
+ * walls and undersized holes in CSG-composed or imported geometry
+ * that the parametric checks cannot see.
+ */
+export function meshReportToIssues(
+  report: MeshDfmReport,
+  material: string,
+  process: string
+): ManufacturabilityIssue[] {
+  const issues: ManufacturabilityIssue[] = []
+
+  // Wall thickness: measured by ray-casting, so it reflects the real
+  // part even when the dimensions describe only the bounding stock
+  const minWall = getMinWallThickness(material, process)
+  if (report.wall_samples > 0 && report.min_wall_thickness < minWall) {
+    // Widespread thinness means the part will likely fail, not just
+    // one local spot that could be reworked
+    const widespread = report.thin_wall_area_fraction > 0.1
+    issues.push({
+      id: 'mesh_wall_thickness',
+      severity: widespread ? 'critical' : 'error',
+      category: 'Geometry',
+      message: `Measured wall thickness ${report.min_wall_thickness.toFixed(2)}mm is below minimum required (${minWall}mm for ${process})`,
+      fix: `Thicken walls to at least ${minWall}mm`,
+      currentValue: report.min_wall_thickness,
+      recommendedValue: minWall,
+    })
+  }
+
+  // Draft: only processes that pull the part from a tool care
+  const requiredDraft = getDraftAngleRequirement(process, material)
+  if (requiredDraft > 0 && report.undrafted_area_fraction > 0.05) {
+    issues.push({
+      id: 'mesh_draft_angle',
+      severity: 'warning',
+      category: 'Geometry',
+      message: `${(report.undrafted_area_fraction * 100).toFixed(0)}% of side walls have less than ${requiredDraft}° draft`,
+      fix: `Add at least ${requiredDraft}° of draft to vertical walls`,
+      currentValue: report.min_draft_angle_deg,
+      recommendedValue: requiredDraft,
+    })
+  }
+
+  // Holes: diameters come from circular edge loops in the topology,
+  // not from feature parameters
+  const minHoleSize = getMinFeatureSize(material, process) * 1.5
+  if (report.min_hole_diameter > 0 && report.min_hole_diameter < minHoleSize) {
+    issues.push({
+      id: 'mesh_hole_diameter',
+      severity: 'error',
+      category: 'Features',
+      message: `Detected hole Ø${report.min_hole_diameter.toFixed(2)}mm is below minimum machinable size (${minHoleSize.toFixed(2)}mm)`,
+      fix: `Enlarge holes to at least Ø${minHoleSize.toFixed(2)}mm`,
+      currentValue: report.min_hole_diameter,
+      recommendedValue: minHoleSize,
+    })
+  }
+
+  // A non-watertight mesh cannot be measured reliably; surface the
+  // fact rather than silently reporting partial numbers
+  if (!report.is_closed) {
+    issues.push({
+      id: 'mesh_not_watertight',
+      severity: 'warning',
+      category: 'Geometry',
+      message: 'Mesh is not watertight - hole detection was skipped and thickness values may be incomplete',
+      fix: 'Repair the mesh so all edges are shared by exactly two faces',
+    })
+  }
+
+  return issues
+}
+
 export function assessManufacturability(
   input: ManufacturabilityAssessmentInput
 ): ManufacturabilityResult {
@@ -128,6 +245,17 @@ export function assessManufacturability(
     }
   }
   
+  // Merge mesh-level measurements when the caller ran ANALYZE_DFM
+  if (input.meshReport) {
+    const meshIssues = meshReportToIssues(input.meshReport, material, process)
+    violations.push(...meshIssues)
+    totalChecks += MESH_CHECK_COUNT
+    passedChecks += Math.max(
+      0,
+      MESH_CHECK_COUNT - meshIssues.filter(i => i.severity !== 'warning' && i.severity !== 'info').length
+    )
+  }
+
   // Sort violations by severity
   const severityOrder: Record<Severity, number> = {
     critical: 0,
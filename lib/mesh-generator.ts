@@ -1,5 +1,6 @@
 import * as THREE from 'three';
 import type { WorkspaceObject } from '@/hooks/use-workspace';
+import { acquireGeometry, releaseGeometry, hashMeshData } from './geometry-pool';
 
 export interface MeshGeneratorInput {
   type: string;
@@ -20,85 +21,124 @@ export interface MeshGeneratorInput {
 }
 
 /**
- * Generates a THREE.js mesh from geometry metadata
- * @param input Geometry metadata including type, dimensions, and optional meshData
- * @returns THREE.Mesh ready to be added to the scene
+ * Builds a BufferGeometry from raw mesh data
+ * @param meshData Vertex, index and optional normal buffers
+ * @returns THREE.BufferGeometry with attributes assigned
  */
-export function generateMesh(input: MeshGeneratorInput): THREE.Mesh {
-  const { type, dimensions, selected, color, meshData } = input;
+function buildGeometryFromMeshData(meshData: NonNullable<MeshGeneratorInput['meshData']>): THREE.BufferGeometry {
+  const geometry = new THREE.BufferGeometry();
 
-  let geometry: THREE.BufferGeometry;
+  const vertices = meshData.vertices instanceof Float32Array
+    ? meshData.vertices
+    : new Float32Array(meshData.vertices);
 
-  // If pre-generated mesh data is provided (e.g. from Cadmium), use it
-  if (meshData && meshData.vertices && meshData.indices) {
-    geometry = new THREE.BufferGeometry();
-    
-    const vertices = meshData.vertices instanceof Float32Array 
-      ? meshData.vertices 
-      : new Float32Array(meshData.vertices);
-      
-    const indices = meshData.indices instanceof Uint32Array 
-      ? meshData.indices 
-      : new Uint32Array(meshData.indices);
-      
-    geometry.setAttribute('position', new THREE.BufferAttribute(vertices, 3));
-    geometry.setIndex(new THREE.BufferAttribute(indices, 1));
-    
-    if (meshData.normals) {
-      const normals = meshData.normals instanceof Float32Array 
-        ? meshData.normals 
-        : new Float32Array(meshData.normals);
-      geometry.setAttribute('normal', new THREE.BufferAttribute(normals, 3));
-    } else {
-      geometry.computeVertexNormals();
-    }
+  const indices = meshData.indices instanceof Uint32Array
+    ? meshData.indices
+    : new Uint32Array(meshData.indices);
+
+  geometry.setAttribute('position', new THREE.BufferAttribute(vertices, 3));
+  geometry.setIndex(new THREE.BufferAttribute(indices, 1));
+
+  if (meshData.normals) {
+    const normals = meshData.normals instanceof Float32Array
+      ? meshData.normals
+      : new Float32Array(meshData.normals);
+    geometry.setAttribute('normal', new THREE.BufferAttribute(normals, 3));
   } else {
-    // Generate geometry using THREE.js primitives as fallback
-    switch (type) {
-      case 'box': {
-        const width = dimensions.width || dimensions.length || 100;
-        const height = dimensions.height || 100;
-        const depth = dimensions.depth || dimensions.width || 100;
-        geometry = new THREE.BoxGeometry(width, height, depth);
-        break;
-      }
+    geometry.computeVertexNormals();
+  }
 
-      case 'cylinder': {
-        const radius = dimensions.radius || (dimensions.diameter ? dimensions.diameter / 2 : 50);
-        const height = dimensions.height || 100;
-        geometry = new THREE.CylinderGeometry(radius, radius, height, 32);
-        break;
-      }
+  return geometry;
+}
 
-      case 'sphere': {
-        const radius = dimensions.radius || (dimensions.diameter ? dimensions.diameter / 2 : 50);
-        geometry = new THREE.SphereGeometry(radius, 32, 32);
-        break;
-      }
+/**
+ * Builds a THREE.js primitive geometry for objects without mesh data
+ * @param type Primitive type name
+ * @param dimensions Dimension map
+ * @returns THREE.BufferGeometry built from primitive parameters
+ */
+function buildPrimitiveGeometry(type: string, dimensions: Record<string, number>): THREE.BufferGeometry {
+  switch (type) {
+    case 'box': {
+      const width = dimensions.width || dimensions.length || 100;
+      const height = dimensions.height || 100;
+      const depth = dimensions.depth || dimensions.width || 100;
+      return new THREE.BoxGeometry(width, height, depth);
+    }
 
-      case 'cone': {
-        const radius = dimensions.radius || (dimensions.diameter ? dimensions.diameter / 2 : 50);
-        const height = dimensions.height || 100;
-        geometry = new THREE.ConeGeometry(radius, height, 32);
-        break;
-      }
+    case 'cylinder': {
+      const radius = dimensions.radius || (dimensions.diameter ? dimensions.diameter / 2 : 50);
+      const height = dimensions.height || 100;
+      return new THREE.CylinderGeometry(radius, radius, height, 32);
+    }
 
-      case 'torus': {
-        const majorRadius = dimensions.majorRadius || dimensions.radius || 100;
-        const minorRadius = dimensions.minorRadius || dimensions.tube || 30;
-        geometry = new THREE.TorusGeometry(majorRadius, minorRadius, 16, 48);
-        break;
-      }
+    case 'sphere': {
+      const radius = dimensions.radius || (dimensions.diameter ? dimensions.diameter / 2 : 50);
+      return new THREE.SphereGeometry(radius, 32, 32);
+    }
 
-      default: {
-        const width = dimensions.width || dimensions.length || 100;
-        const height = dimensions.height || 100;
-        const depth = dimensions.depth || dimensions.width || 100;
-        geometry = new THREE.BoxGeometry(width, height, depth);
-        break;
-      }
+    case 'cone': {
+      const radius = dimensions.radius || (dimensions.diameter ? dimensions.diameter / 2 : 50);
+      const height = dimensions.height || 100;
+      return new THREE.ConeGeometry(radius, height, 32);
+    }
+
+    case 'torus': {
+      const majorRadius = dimensions.majorRadius || dimensions.radius || 100;
+      const minorRadius = dimensions.minorRadius || dimensions.tube || 30;
+      return new THREE.TorusGeometry(majorRadius, minorRadius, 16, 48);
+    }
+
+    default: {
+      const width = dimensions.width || dimensions.length || 100;
+      const height = dimensions.height || 100;
+      const depth = dimensions.depth || dimensions.width || 100;
+      return new THREE.BoxGeometry(width, height, depth);
     }
   }
+}
+
+/**
+ * Computes the geometry pool key for an input: content hash for raw
+ * mesh data, parametric signature for primitive fallbacks
+ * @param input Geometry metadata
+ * @returns Stable key identical inputs share
+ */
+function geometryPoolKey(input: MeshGeneratorInput): string {
+  const { type, dimensions, meshData } = input;
+
+  if (meshData && meshData.vertices && meshData.indices) {
+    return `mesh:${hashMeshData(meshData.vertices, meshData.indices, meshData.normals)}`;
+  }
+
+  const dims = Object.keys(dimensions)
+    .sort()
+    .map((k) => `${k}:${dimensions[k]}`)
+    .join('|');
+  return `param:${type}|${dims}`;
+}
+
+/**
+ * Generates a THREE.js mesh from geometry metadata
+ *
+ * Geometry comes from the shared pool: identical inputs (same catalog
+ * part placed many times, or the same primitive parameters) share one
+ * BufferGeometry and one set of GPU buffers. Dispose generated meshes
+ * through disposeGeneratedMesh so the pool refcount stays correct.
+ *
+ * @param input Geometry metadata including type, dimensions, and optional meshData
+ * @returns THREE.Mesh ready to be added to the scene
+ */
+export function generateMesh(input: MeshGeneratorInput): THREE.Mesh {
+  const { type, dimensions, selected, color, meshData } = input;
+
+  const poolKey = geometryPoolKey(input);
+  const geometry = acquireGeometry(poolKey, () => {
+    if (meshData && meshData.vertices && meshData.indices) {
+      return buildGeometryFromMeshData(meshData);
+    }
+    return buildPrimitiveGeometry(type, dimensions);
+  });
 
   // Create material with appropriate color
   const materialColor = selected ? 0xff8800 : (color ? parseInt(color.replace('#', '0x')) : 0x0077ff);
@@ -113,6 +153,8 @@ export function generateMesh(input: MeshGeneratorInput): THREE.Mesh {
   mesh.visible = input.visible !== false;
   mesh.castShadow = true;
   mesh.receiveShadow = true;
+  mesh.userData.meshData = meshData;
+  mesh.userData.geometryPoolKey = poolKey;
 
   return mesh;
 }
@@ -126,6 +168,25 @@ export function updateMesh(mesh: THREE.Mesh, input: MeshGeneratorInput): void {
   // Update visibility
   mesh.visible = input.visible !== false;
 
+  // Rebind geometry when new mesh data arrives (e.g. a refined LOD
+  // streamed for the same object); material and transform stay
+  // untouched. If the content is already pooled — another object shows
+  // the same part — this is a pointer swap, not a buffer rebuild.
+  if (input.meshData && input.meshData !== mesh.userData.meshData) {
+    const meshData = input.meshData;
+    const nextKey = geometryPoolKey(input);
+
+    if (nextKey !== mesh.userData.geometryPoolKey) {
+      // Acquire before releasing so matching content never drops to zero
+      mesh.geometry = acquireGeometry(nextKey, () => buildGeometryFromMeshData(meshData));
+      if (mesh.userData.geometryPoolKey) {
+        releaseGeometry(mesh.userData.geometryPoolKey);
+      }
+      mesh.userData.geometryPoolKey = nextKey;
+    }
+    mesh.userData.meshData = input.meshData;
+  }
+
   // Update material color
   const material = mesh.material as THREE.MeshStandardMaterial;
   const materialColor = input.selected ? 0xff8800 : (input.color ? parseInt(input.color.replace('#', '0x')) : 0x0077ff);
@@ -133,6 +194,39 @@ export function updateMesh(mesh: THREE.Mesh, input: MeshGeneratorInput): void {
   material.emissive.setHex(input.selected ? 0x442200 : 0x000000);
 }
 
+/**
+ * Disposes a mesh created by generateMesh
+ *
+ * Pooled geometry is released (and only disposed when the last sharing
+ * mesh goes away); unpooled geometry on children — selection edge
+ * overlays, sketch helpers — is disposed directly, along with materials.
+ *
+ * @param mesh Mesh previously returned by generateMesh
+ */
+export function disposeGeneratedMesh(mesh: THREE.Mesh): void {
+  mesh.traverse((child) => {
+    const childMesh = child as THREE.Mesh;
+
+    if (childMesh.geometry) {
+      const poolKey = childMesh.userData.geometryPoolKey as string | undefined;
+      if (poolKey) {
+        releaseGeometry(poolKey);
+      } else {
+        childMesh.geometry.dispose();
+      }
+    }
+
+    const material = childMesh.material;
+    if (!material) return;
+
+    if (Array.isArray(material)) {
+      material.forEach((m) => m.dispose());
+    } else {
+      material.dispose();
+    }
+  });
+}
+
 /**
  * Converts a WorkspaceObject to MeshGeneratorInput
  * @param obj WorkspaceObject from workspace context
@@ -0,0 +1,262 @@
+import type { CatalogPart } from '../catalog/categories'
+import { loadAllParts } from '../catalog/parts'
+import { ExecutionEngine, ExecutionProgress } from '../geometry/execution-engine'
+import { GeometryOperation } from '../geometry/operation-sequencer'
+
+/**
+ * Worker round-trip benchmark harness
+ *
+ * Drives the cadmium worker through representative workloads built from
+ * the parts catalog and reports per-operation latency percentiles, so
+ * pipeline performance claims are measured rather than anecdotal and
+ * regressions show up before a release.
+ *
+ * This is browser-side tooling (the worker only exists there); run it
+ * from a dev console or a perf page:
+ *
+ *   const report = await new WorkerBenchmark().run({ iterations: 20 })
+ *   console.table(report.stats)
+ *
+ * Timings cover the full round trip: payload mapping, structured-clone
+ * transfer, WASM execution, and mesh transfer back. The Rust-side cost
+ * in isolation is covered by the criterion benches in each wasm crate.
+ */
+
+export interface OperationStats {
+  operation: string
+  samples: number
+  p50Ms: number
+  p95Ms: number
+  meanMs: number
+  minMs: number
+  maxMs: number
+}
+
+export interface BenchmarkReport {
+  startedAt: string
+  totalDurationMs: number
+  iterations: number
+  workloads: number
+  fallbackMode: boolean
+  stats: OperationStats[]
+}
+
+export interface BenchmarkWorkload {
+  name: string
+  operations: GeometryOperation[]
+}
+
+export interface BenchmarkOptions {
+  /** Timed passes over every workload (default 10) */
+  iterations?: number
+  /** Untimed passes to warm caches and JIT before measuring (default 2) */
+  warmupIterations?: number
+  /** Catalog parts sampled per category (default 2) */
+  partsPerCategory?: number
+}
+
+/** Nearest-rank percentile over an unsorted sample set */
+export function percentile(samples: number[], p: number): number {
+  if (samples.length === 0) return 0
+  const sorted = [...samples].sort((a, b) => a - b)
+  const rank = Math.ceil((p / 100) * sorted.length)
+  return sorted[Math.min(Math.max(rank - 1, 0), sorted.length - 1)]
+}
+
+let workloadCounter = 0
+
+function nextOpId(): string {
+  workloadCounter += 1
+  return `bench_op_${workloadCounter}`
+}
+
+function createOp(operation: string, parameters: Record<string, any>, description: string): GeometryOperation {
+  return {
+    id: nextOpId(),
+    type: 'CREATE',
+    operation,
+    parameters,
+    dependsOn: [],
+    streaming: false, // benchmarks measure full-quality tessellation, not the coarse LOD pass
+    description,
+  }
+}
+
+function featureOp(operation: string, parameters: Record<string, any>, dependsOn: string, description: string): GeometryOperation {
+  return {
+    id: nextOpId(),
+    type: 'FEATURE',
+    operation,
+    parameters,
+    dependsOn: [dependsOn],
+    streaming: false,
+    description,
+  }
+}
+
+/**
+ * Maps a catalog part's specs onto the operations the worker would run
+ * when the part is placed. Round parts become cylinders, everything
+ * with planar dimensions becomes a box; parts without usable specs are
+ * skipped rather than benchmarked as a meaningless default.
+ */
+export function workloadForPart(part: CatalogPart): BenchmarkWorkload | null {
+  const specs = part.specs
+  if (!specs) return null
+
+  const length = (specs.length as number) || (specs.unitLength as number) || 100
+
+  if (typeof specs.diameter === 'number') {
+    const create = createOp(
+      'CREATE_CYLINDER',
+      { radius: specs.diameter / 2, height: length, segments: 64 },
+      `Benchmark: ${part.name}`
+    )
+    return { name: part.id, operations: [create] }
+  }
+
+  const width = (specs.width as number) || (specs.sideLength as number)
+  const height = (specs.height as number) || (specs.sideLength as number) || (specs.wallThickness as number)
+  if (typeof width === 'number' && typeof height === 'number') {
+    const create = createOp(
+      'CREATE_BOX',
+      { width, height, depth: length },
+      `Benchmark: ${part.name}`
+    )
+    const operations: GeometryOperation[] = [create]
+
+    // Plates and profiles routinely get mounting holes; include one so
+    // the boolean-backed feature path is part of the workload
+    if (width >= 20 && length >= 20) {
+      operations.push(
+        featureOp(
+          'ADD_HOLE',
+          { position: { x: 0, y: 0, z: 0 }, diameter: Math.min(width / 4, 10), depth: height },
+          create.id,
+          `Benchmark hole: ${part.name}`
+        )
+      )
+    }
+
+    return { name: part.id, operations }
+  }
+
+  return null
+}
+
+/** Samples catalog parts evenly across categories into workloads */
+export async function buildCatalogWorkloads(partsPerCategory = 2): Promise<BenchmarkWorkload[]> {
+  const byCategory = new Map<string, CatalogPart[]>()
+  for (const part of await loadAllParts()) {
+    const bucket = byCategory.get(part.category) ?? []
+    bucket.push(part)
+    byCategory.set(part.category, bucket)
+  }
+
+  const workloads: BenchmarkWorkload[] = []
+  for (const parts of byCategory.values()) {
+    let taken = 0
+    for (const part of parts) {
+      if (taken >= partsPerCategory) break
+      const workload = workloadForPart(part)
+      if (workload) {
+        workloads.push(workload)
+        taken += 1
+      }
+    }
+  }
+  return workloads
+}
+
+export class WorkerBenchmark {
+  private engine: ExecutionEngine
+
+  constructor(engine?: ExecutionEngine) {
+    this.engine = engine ?? new ExecutionEngine()
+  }
+
+  async run(options: BenchmarkOptions = {}): Promise<BenchmarkReport> {
+    const iterations = options.iterations ?? 10
+    const warmupIterations = options.warmupIterations ?? 2
+    const workloads = await buildCatalogWorkloads(options.partsPerCategory ?? 2)
+
+    await this.engine.ensureReady()
+
+    // Warmup: fills the worker geometry cache code paths and JIT tiers
+    // without polluting the samples
+    for (let i = 0; i < warmupIterations; i++) {
+      for (const workload of workloads) {
+        await this.runWorkload(workload, null)
+      }
+    }
+
+    const samplesByOperation = new Map<string, number[]>()
+    const startedAt = new Date().toISOString()
+    const t0 = performance.now()
+
+    for (let i = 0; i < iterations; i++) {
+      for (const workload of workloads) {
+        await this.runWorkload(workload, samplesByOperation)
+      }
+    }
+
+    const totalDurationMs = performance.now() - t0
+
+    const stats: OperationStats[] = []
+    for (const [operation, samples] of samplesByOperation) {
+      stats.push({
+        operation,
+        samples: samples.length,
+        p50Ms: percentile(samples, 50),
+        p95Ms: percentile(samples, 95),
+        meanMs: samples.reduce((a, b) => a + b, 0) / samples.length,
+        minMs: Math.min(...samples),
+        maxMs: Math.max(...samples),
+      })
+    }
+    stats.sort((a, b) => b.p95Ms - a.p95Ms)
+
+    return {
+      startedAt,
+      totalDurationMs,
+      iterations,
+      workloads: workloads.length,
+      fallbackMode: !this.engine.isWorkerReady(),
+      stats,
+    }
+  }
+
+  /**
+   * Runs one workload, attributing wall time to each operation via the
+   * progress callback ('running' → 'complete'/'error' transitions)
+   */
+  private async runWorkload(
+    workload: BenchmarkWorkload,
+    samplesByOperation: Map<string, number[]> | null
+  ): Promise<void> {
+    const startTimes = new Map<string, number>()
+
+    const onProgress = (progress: ExecutionProgress) => {
+      if (!samplesByOperation) return
+      const key = progress.operation.operation
+      if (progress.status === 'running') {
+        startTimes.set(progress.operation.id, performance.now())
+      } else if (progress.status === 'complete' || progress.status === 'error') {
+        const start = startTimes.get(progress.operation.id)
+        if (start !== undefined) {
+          const bucket = samplesByOperation.get(key) ?? []
+          bucket.push(performance.now() - start)
+          samplesByOperation.set(key, bucket)
+        }
+      }
+    }
+
+    try {
+      await this.engine.executeSequence(workload.operations, onProgress)
+    } catch (error) {
+      // A failing workload should not abort the whole run; it shows up
+      // as missing samples for its operations
+      console.warn(`⚠️ Benchmark workload ${workload.name} failed:`, error)
+    }
+  }
+}
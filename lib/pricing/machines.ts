@@ -163,14 +163,24 @@ export const MACHINE_RATES: MachineRate[] = [
   },
 ]
 
+// Precomputed id -> machine index plus a memo of per-process rate
+// lists. The process match is a substring scan, so memoizing on the
+// normalized process string keeps repeated quoting off the full table.
+const MACHINE_INDEX = new Map(MACHINE_RATES.map(m => [m.id, m]))
+const PROCESS_RATE_CACHE = new Map<string, MachineRate[]>()
+
 export function getMachineRate(machineId: string): MachineRate | null {
-  return MACHINE_RATES.find(m => m.id === machineId) || null
+  return MACHINE_INDEX.get(machineId) || null
 }
 
 export function getMachineRatesForProcess(process: string): MachineRate[] {
-  return MACHINE_RATES.filter(m => 
-    m.process.toLowerCase().includes(process.toLowerCase())
-  )
+  const key = process.toLowerCase()
+  let rates = PROCESS_RATE_CACHE.get(key)
+  if (!rates) {
+    rates = MACHINE_RATES.filter(m => m.process.toLowerCase().includes(key))
+    PROCESS_RATE_CACHE.set(key, rates)
+  }
+  return rates
 }
 
 export function getDefaultMachineForProcess(process: string): MachineRate | null {
@@ -170,8 +170,12 @@ export const MATERIAL_PRICES: MaterialPrice[] = [
   },
 ]
 
+// Precomputed id -> material index. Batch quoting looks materials up
+// once per item, so a linear scan per lookup adds up on catalog pages.
+const MATERIAL_INDEX = new Map(MATERIAL_PRICES.map(m => [m.id, m]))
+
 export function getMaterialPrice(materialId: string): MaterialPrice | null {
-  return MATERIAL_PRICES.find(m => m.id === materialId) || null
+  return MATERIAL_INDEX.get(materialId) || null
 }
 
 export function calculateMaterialCost(
@@ -0,0 +1,100 @@
+// lib/quote/catalog-quote.ts
+// Shared catalog quote math for the single and batch quote endpoints
+//
+// Catalog browsing quotes dozens of parts per page, so the pricing here
+// is backed by the lazy catalog part index and a memo cache keyed on the
+// (partId, material, quantity) tuple. Pricing inputs are static tables,
+// so cached quotes stay valid for the cache TTL.
+
+import { findPartById } from '../catalog/parts'
+
+export interface CatalogQuoteMaterial {
+  name?: string
+  priceMultiplier?: number
+}
+
+export interface CatalogQuoteItem {
+  partId: string
+  quantity?: number
+  material?: CatalogQuoteMaterial
+}
+
+export interface CatalogQuote {
+  partId: string
+  quantity: number
+  material: string
+  unitPrice: number
+  totalPrice: number
+  leadTimeDays: number
+  validUntil: string
+  breakdown: {
+    baseCost: number
+    materialCost: number
+    volumeDiscount: number
+  }
+}
+
+// Memoized quotes. Bounded so a crawler enumerating tuples cannot grow
+// the cache without limit; insertion order makes Map eviction FIFO.
+const QUOTE_CACHE_TTL_MS = 5 * 60 * 1000
+const QUOTE_CACHE_MAX_ENTRIES = 1000
+const quoteCache = new Map<string, { quote: CatalogQuote; expiresAt: number }>()
+
+export async function quoteCatalogPart(item: CatalogQuoteItem): Promise<CatalogQuote> {
+  const quantity = Math.max(1, Math.floor(item.quantity ?? 1))
+  const materialName = item.material?.name || 'Aluminum 6061-T6'
+  const materialMultiplier = item.material?.priceMultiplier || 1.0
+
+  const cacheKey = `${item.partId}|${materialName}|${materialMultiplier}|${quantity}`
+  const cached = quoteCache.get(cacheKey)
+  if (cached && cached.expiresAt > Date.now()) {
+    return cached.quote
+  }
+
+  // Lazy chunked catalog lookup, memoized per process
+  const basePrice = (await findPartById(item.partId))?.basePrice ?? 32
+
+  // Volume-based pricing
+  let volumeDiscount = 1.0
+  if (quantity >= 10) volumeDiscount = 0.9
+  if (quantity >= 50) volumeDiscount = 0.8
+  if (quantity >= 100) volumeDiscount = 0.7
+
+  const unitPrice = basePrice * materialMultiplier * volumeDiscount
+  const totalPrice = unitPrice * quantity
+
+  // Lead time calculation
+  let leadTimeDays = 3
+  if (quantity > 10) leadTimeDays = 5
+  if (quantity > 50) leadTimeDays = 7
+
+  const quote: CatalogQuote = {
+    partId: item.partId,
+    quantity,
+    material: materialName,
+    unitPrice: Math.round(unitPrice * 100) / 100,
+    totalPrice: Math.round(totalPrice * 100) / 100,
+    leadTimeDays,
+    validUntil: new Date(Date.now() + 7 * 24 * 60 * 60 * 1000).toISOString(),
+    breakdown: {
+      baseCost: basePrice * quantity,
+      materialCost: basePrice * quantity * (materialMultiplier - 1),
+      volumeDiscount: basePrice * quantity * (1 - volumeDiscount),
+    },
+  }
+
+  if (quoteCache.size >= QUOTE_CACHE_MAX_ENTRIES) {
+    const oldest = quoteCache.keys().next().value
+    if (oldest !== undefined) quoteCache.delete(oldest)
+  }
+  quoteCache.set(cacheKey, { quote, expiresAt: Date.now() + QUOTE_CACHE_TTL_MS })
+
+  return quote
+}
+
+// Quote a list of (partId, material, quantity) tuples in one pass.
+// Shares the part index and memo cache across items, so a catalog page
+// of 50 cards costs one call and at most 50 cold computations.
+export function quoteCatalogParts(items: CatalogQuoteItem[]): Promise<CatalogQuote[]> {
+  return Promise.all(items.map(quoteCatalogPart))
+}
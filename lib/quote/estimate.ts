@@ -27,6 +27,12 @@ export interface QuoteInput {
   quantity: number;
   finish?: FinishType;
   features?: Array<{ type: string; parameters: Record<string, unknown> }>;
+  /**
+   * Mesh-derived volume from KernelBridge.analyzeBatch (mm³). When
+   * present it overrides the parametric estimate below, so quotes for
+   * parts with holes/fillets price the actual material removed.
+   */
+  measuredVolumeMm3?: number;
 }
 
 export interface QuoteBreakdown {
@@ -158,13 +164,18 @@ export function generateQuote(input: QuoteInput): DetailedQuoteResult {
     quantity,
     finish,
     features = [],
+    measuredVolumeMm3,
   } = input;
 
   // Generate job ID
   const jobId = `job_${Date.now()}_${Math.random().toString(36).substr(2, 9)}`;
 
-  // Calculate volume
-  const volumeMm3 = calculateVolume(geometryParams);
+  // Prefer the mesh-derived volume when the caller measured one;
+  // otherwise fall back to the parametric estimate
+  const volumeMm3 =
+    measuredVolumeMm3 && measuredVolumeMm3 > 0
+      ? measuredVolumeMm3
+      : calculateVolume(geometryParams);
   const volumeCm3 = volumeMm3 / 1000;
 
   // Get material pricing
@@ -1,5 +1,10 @@
 // lib/quote/pdf-export.ts
 // PDF export utilities for quotes using browser-native methods
+//
+// Document layout runs in workers/pdf-worker.ts so the export click
+// never blocks the main thread; the worker streams finished pages into
+// byte chunks and the result downloads as a Blob. The print-window
+// path is kept as a fallback for environments without Worker support.
 
 import { DetailedQuoteResult, formatPriceNGN } from './estimate'
 
@@ -10,9 +15,53 @@ export interface PDFExportOptions {
   companyLogo?: string
 }
 
+// ===== PDF WORKER TRANSPORT =====
+
+let pdfWorker: Worker | null = null
+let requestCounter = 0
+const pendingRequests = new Map<string, { resolve: (value: any) => void; reject: (error: Error) => void }>()
+
+function getPdfWorker(): Worker {
+  if (pdfWorker) return pdfWorker
+
+  pdfWorker = new Worker(new URL('../../workers/pdf-worker.ts', import.meta.url), {
+    type: 'module',
+  })
+
+  pdfWorker.onmessage = (event: MessageEvent) => {
+    const { id, result, error, type } = event.data
+    if (type === 'READY' || !id) return
+
+    const pending = pendingRequests.get(id)
+    if (!pending) return
+    pendingRequests.delete(id)
+
+    if (error) pending.reject(new Error(error))
+    else pending.resolve(result)
+  }
+
+  pdfWorker.onerror = (event) => {
+    console.error('❌ PDF worker error:', event)
+    pendingRequests.forEach(({ reject }) => reject(new Error('PDF worker failed')))
+    pendingRequests.clear()
+    pdfWorker?.terminate()
+    pdfWorker = null
+  }
+
+  return pdfWorker
+}
+
+function runPdfWorker(operation: string, payload: any): Promise<any> {
+  return new Promise((resolve, reject) => {
+    const id = `pdf_${++requestCounter}`
+    pendingRequests.set(id, { resolve, reject })
+    getPdfWorker().postMessage({ id, operation, payload })
+  })
+}
+
 /**
- * Generate a quote PDF using browser-native methods (canvas + download)
- * This avoids external dependencies while providing clean PDF output
+ * Generate a quote PDF off the main thread and download it as a Blob.
+ * Falls back to the print-window flow when workers are unavailable.
  */
 export async function exportQuoteAsPDF(
   quote: DetailedQuoteResult,
@@ -24,17 +73,49 @@ export async function exportQuoteAsPDF(
     companyName = 'Qutlas',
   } = options
 
-  // Create a printable HTML document
+  if (typeof Worker !== 'undefined') {
+    try {
+      const result = await runPdfWorker('GENERATE_QUOTE_PDF', {
+        quote,
+        includeBreakdown,
+        includeNotes,
+        companyName,
+      })
+
+      const blob = new Blob([result.pdf], { type: 'application/pdf' })
+      const url = URL.createObjectURL(blob)
+      const link = document.createElement('a')
+      link.href = url
+      link.download = `quote-${quote.jobId ?? Date.now()}.pdf`
+      link.click()
+      URL.revokeObjectURL(url)
+      return
+    } catch (error) {
+      console.warn('⚠️ PDF worker export failed, falling back to print window:', error)
+    }
+  }
+
+  exportQuoteViaPrintWindow(quote, { includeBreakdown, includeNotes, companyName })
+}
+
+/**
+ * Fallback: render the quote as printable HTML in a popup and open the
+ * browser's print dialog
+ */
+function exportQuoteViaPrintWindow(
+  quote: DetailedQuoteResult,
+  options: {
+    includeBreakdown: boolean
+    includeNotes: boolean
+    companyName: string
+  }
+): void {
   const printWindow = window.open('', '_blank')
   if (!printWindow) {
     throw new Error('Please allow popups to export PDF')
   }
 
-  const html = generateQuoteHTML(quote, {
-    includeBreakdown,
-    includeNotes,
-    companyName,
-  })
+  const html = generateQuoteHTML(quote, options)
 
   printWindow.document.write(html)
   printWindow.document.close()
@@ -0,0 +1,206 @@
+// Render Worker Client - Main-thread wrapper around the OffscreenCanvas
+// render worker (workers/render-worker.ts).
+//
+// The viewer transfers its canvas here once; afterwards the client
+// exposes two message styles matching how the worker consumes them:
+//
+// - post(): fire-and-forget, no id, no reply. Used for per-frame camera
+//   poses and scene mutations where waiting on an ack would just add a
+//   round trip.
+// - run(): request/response with timeout, same id-correlation scheme as
+//   CadmiumWorkerPool. Used where the caller needs an answer (picking,
+//   fit-view bounds).
+
+const DEFAULT_OPERATION_TIMEOUT_MS = 10000
+
+interface PendingRequest {
+  resolve: (result: any) => void
+  reject: (error: Error) => void
+  timeoutId: ReturnType<typeof setTimeout>
+}
+
+export interface RenderWorkerInitOptions {
+  width: number
+  height: number
+  pixelRatio: number
+  showGrid: boolean
+  isMobile: boolean
+}
+
+/** Serialized workspace object the worker rebuilds a mesh from */
+export interface RenderObjectRecord {
+  id: string
+  geometryKey: string
+  input: any
+  visible: boolean
+  selected: boolean
+  color?: string
+}
+
+export function isRenderWorkerSupported(): boolean {
+  return (
+    typeof window !== 'undefined' &&
+    typeof Worker !== 'undefined' &&
+    typeof OffscreenCanvas !== 'undefined' &&
+    typeof HTMLCanvasElement !== 'undefined' &&
+    'transferControlToOffscreen' in HTMLCanvasElement.prototype
+  )
+}
+
+export class RenderWorkerClient {
+  private worker: Worker
+  private pending = new Map<string, PendingRequest>()
+  private idCounter = 0
+  private ready = false
+  private destroyed = false
+
+  constructor() {
+    this.worker = new Worker(
+      new URL('../workers/render-worker.ts', import.meta.url),
+      { type: 'module' }
+    )
+
+    this.worker.onmessage = (event: MessageEvent) => {
+      const { id, result, error, type } = event.data
+
+      if (type === 'READY') {
+        this.ready = true
+        return
+      }
+
+      const entry = this.pending.get(id)
+      if (!entry) return
+      this.pending.delete(id)
+      clearTimeout(entry.timeoutId)
+
+      if (error) {
+        entry.reject(new Error(error))
+      } else {
+        entry.resolve(result)
+      }
+    }
+
+    this.worker.onerror = (error) => {
+      console.error('❌ Render worker error:', error)
+    }
+  }
+
+  get isReady(): boolean {
+    return this.ready
+  }
+
+  /** Fire-and-forget: no reply is sent for messages without an id */
+  post(operation: string, payload: any, transfers: Transferable[] = []): void {
+    if (this.destroyed) return
+    this.worker.postMessage({ operation, payload }, transfers)
+  }
+
+  run(
+    operation: string,
+    payload: any,
+    transfers: Transferable[] = [],
+    timeout = DEFAULT_OPERATION_TIMEOUT_MS
+  ): Promise<any> {
+    if (this.destroyed) {
+      return Promise.reject(new Error('Render worker has been destroyed'))
+    }
+
+    const id = `render_${++this.idCounter}`
+
+    return new Promise((resolve, reject) => {
+      const timeoutId = setTimeout(() => {
+        this.pending.delete(id)
+        reject(new Error(`Render operation ${operation} timed out after ${timeout}ms`))
+      }, timeout)
+
+      this.pending.set(id, { resolve, reject, timeoutId })
+      this.worker.postMessage({ id, operation, payload }, transfers)
+    })
+  }
+
+  /** Transfers the canvas to the worker; the element is unusable for
+   *  main-thread rendering afterwards */
+  init(canvas: HTMLCanvasElement, options: RenderWorkerInitOptions): Promise<void> {
+    const offscreen = canvas.transferControlToOffscreen()
+    return this.run('INIT', { canvas: offscreen, ...options }, [offscreen])
+  }
+
+  resize(width: number, height: number, pixelRatio: number): void {
+    this.post('RESIZE', { width, height, pixelRatio })
+  }
+
+  setCamera(
+    position: [number, number, number],
+    quaternion: [number, number, number, number],
+    zoom: number
+  ): void {
+    this.post('SET_CAMERA', { position, quaternion, zoom })
+  }
+
+  syncObjects(objects: RenderObjectRecord[], hoveredId: string | null): void {
+    this.post('SYNC_OBJECTS', { objects, hoveredId })
+  }
+
+  setVisual(hoveredId: string | null): void {
+    this.post('SET_VISUAL', { hoveredId })
+  }
+
+  setGrid(visible: boolean): void {
+    this.post('SET_GRID', { visible })
+  }
+
+  /** x/y in normalized device coordinates (-1..1) */
+  pick(x: number, y: number): Promise<string | null> {
+    return this.run('PICK', { x, y })
+  }
+
+  fitView(): Promise<{ center: [number, number, number]; maxDim: number } | null> {
+    return this.run('FIT_VIEW', {})
+  }
+
+  // Canvas-utils bridge: mirrors updateCanvasMesh / removeCanvasMesh /
+  // clearAllMeshes for callers that stream meshes into the viewport
+  // from outside the viewer (AI geometry, progressive LOD)
+
+  updateMesh(
+    id: string,
+    mesh: {
+      vertices: Float32Array | number[]
+      indices: Uint32Array | number[]
+      normals?: Float32Array | number[]
+    },
+    color?: number
+  ): void {
+    this.post('UPDATE_MESH', { id, mesh, color })
+  }
+
+  removeMesh(id: string): void {
+    this.post('REMOVE_MESH', { id })
+  }
+
+  clearMeshes(): void {
+    this.post('CLEAR_MESHES', {})
+  }
+
+  addSketchLine(from: [number, number, number], to: [number, number, number]): void {
+    this.post('ADD_SKETCH_LINE', { from, to })
+  }
+
+  clearSketch(): void {
+    this.post('CLEAR_SKETCH', {})
+  }
+
+  destroy(): void {
+    if (this.destroyed) return
+    this.post('DISPOSE', {})
+    this.destroyed = true
+
+    this.pending.forEach((entry) => {
+      clearTimeout(entry.timeoutId)
+      entry.reject(new Error('Render worker has been destroyed'))
+    })
+    this.pending.clear()
+
+    this.worker.terminate()
+  }
+}
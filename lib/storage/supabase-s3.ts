@@ -1,4 +1,5 @@
 import crypto from "node:crypto"
+import { gzipSync } from "node:zlib"
 
 export interface SupabaseS3Config {
   endpoint: string
@@ -53,11 +54,13 @@ export function getObjectPath(bucket: string, key: string) {
 }
 
 export function presignUrl(params: {
-  method: "GET" | "PUT" | "DELETE"
+  method: "GET" | "PUT" | "POST" | "DELETE"
   bucket: string
   key: string
   expiresInSeconds?: number
   contentType?: string
+  // Extra query params signed into the URL (multipart: uploads, uploadId, partNumber)
+  query?: Record<string, string>
 }) {
   const { method, bucket, key, expiresInSeconds = 60 * 10 } = params
   const { endpoint, region, accessKeyId, secretAccessKey } = getSupabaseS3Config()
@@ -78,6 +81,7 @@ export function presignUrl(params: {
     "X-Amz-Date": amzDate,
     "X-Amz-Expires": String(expiresInSeconds),
     "X-Amz-SignedHeaders": "host",
+    ...params.query,
   }
 
   const canonicalQueryString = Object.keys(query)
@@ -118,27 +122,163 @@ export function presignUrl(params: {
   return url.toString()
 }
 
+// Objects at or above this size are uploaded as parallel multipart
+// chunks; below it a single PUT is cheaper than the initiate/complete
+// round trips.
+export const MULTIPART_THRESHOLD = 8 * 1024 * 1024
+export const MULTIPART_CHUNK_SIZE = 8 * 1024 * 1024
+const MULTIPART_CONCURRENCY = 4
+const UPLOAD_MAX_ATTEMPTS = 3
+
+async function fetchWithRetry(doFetch: () => Promise<Response>, label: string): Promise<Response> {
+  let lastError: unknown
+  for (let attempt = 0; attempt < UPLOAD_MAX_ATTEMPTS; attempt++) {
+    try {
+      const res = await doFetch()
+      if (res.ok) return res
+      const text = await res.text().catch(() => "")
+      lastError = new Error(`${label} failed (${res.status}): ${text}`)
+    } catch (error) {
+      lastError = error
+    }
+    await new Promise((resolve) => setTimeout(resolve, 250 * 2 ** attempt))
+  }
+  throw lastError
+}
+
+// Chunked parallel upload against the S3 multipart API. Parts upload
+// concurrently and retry independently, so a transient failure resends
+// one chunk instead of restarting the whole artifact.
+async function uploadObjectMultipart(params: {
+  bucket: string
+  key: string
+  body: Uint8Array
+  contentType: string
+  contentEncoding?: string
+}) {
+  const { bucket, key, body } = params
+
+  const initiateUrl = presignUrl({ method: "POST", bucket, key, query: { uploads: "" } })
+  const initiateRes = await fetchWithRetry(
+    () =>
+      fetch(initiateUrl, {
+        method: "POST",
+        headers: {
+          "Content-Type": params.contentType,
+          ...(params.contentEncoding ? { "Content-Encoding": params.contentEncoding } : {}),
+        },
+      }),
+    "Initiate multipart upload"
+  )
+
+  const uploadId = /<UploadId>([^<]+)<\/UploadId>/.exec(await initiateRes.text())?.[1]
+  if (!uploadId) {
+    throw new Error("Initiate multipart upload returned no UploadId")
+  }
+
+  const partCount = Math.ceil(body.byteLength / MULTIPART_CHUNK_SIZE)
+  const etags = new Array<string>(partCount)
+  let nextPart = 0
+
+  try {
+    const worker = async () => {
+      while (true) {
+        const part = nextPart++
+        if (part >= partCount) return
+
+        const chunk = body.subarray(
+          part * MULTIPART_CHUNK_SIZE,
+          Math.min((part + 1) * MULTIPART_CHUNK_SIZE, body.byteLength)
+        )
+        const partUrl = presignUrl({
+          method: "PUT",
+          bucket,
+          key,
+          query: { partNumber: String(part + 1), uploadId },
+        })
+        const res = await fetchWithRetry(
+          () => fetch(partUrl, { method: "PUT", body: chunk }),
+          `Upload part ${part + 1}/${partCount}`
+        )
+        etags[part] = res.headers.get("etag") ?? ""
+      }
+    }
+
+    await Promise.all(
+      Array.from({ length: Math.min(MULTIPART_CONCURRENCY, partCount) }, () => worker())
+    )
+
+    const completeXml =
+      "<CompleteMultipartUpload>" +
+      etags
+        .map((etag, i) => `<Part><PartNumber>${i + 1}</PartNumber><ETag>${etag}</ETag></Part>`)
+        .join("") +
+      "</CompleteMultipartUpload>"
+
+    const completeUrl = presignUrl({ method: "POST", bucket, key, query: { uploadId } })
+    await fetchWithRetry(
+      () =>
+        fetch(completeUrl, {
+          method: "POST",
+          headers: { "Content-Type": "application/xml" },
+          body: completeXml,
+        }),
+      "Complete multipart upload"
+    )
+  } catch (error) {
+    // Best effort: abandoned parts otherwise accumulate storage charges
+    const abortUrl = presignUrl({ method: "DELETE", bucket, key, query: { uploadId } })
+    await fetch(abortUrl, { method: "DELETE" }).catch(() => {})
+    throw error
+  }
+
+  return { bucket, key }
+}
+
 export async function uploadObject(params: {
   bucket: string
   key: string
-  body: BodyInit
+  body: string | Uint8Array
   contentType: string
+  // Gzip before upload and store with Content-Encoding: gzip, so
+  // presigned GETs decompress transparently in fetch and browsers.
+  // Mesh artifacts (STL, job JSON) compress 4-6x.
+  compress?: boolean
 }) {
-  const url = presignUrl({ method: "PUT", bucket: params.bucket, key: params.key, expiresInSeconds: 60 * 10 })
+  let bytes: Uint8Array =
+    typeof params.body === "string" ? Buffer.from(params.body, "utf8") : params.body
+  let contentEncoding: string | undefined
 
-  const res = await fetch(url, {
-    method: "PUT",
-    headers: {
-      "Content-Type": params.contentType,
-    },
-    body: params.body,
-  })
+  if (params.compress) {
+    bytes = gzipSync(bytes)
+    contentEncoding = "gzip"
+  }
 
-  if (!res.ok) {
-    const text = await res.text().catch(() => "")
-    throw new Error(`Failed to upload object to storage (${res.status}): ${text}`)
+  if (bytes.byteLength >= MULTIPART_THRESHOLD) {
+    return uploadObjectMultipart({
+      bucket: params.bucket,
+      key: params.key,
+      body: bytes,
+      contentType: params.contentType,
+      contentEncoding,
+    })
   }
 
+  const url = presignUrl({ method: "PUT", bucket: params.bucket, key: params.key, expiresInSeconds: 60 * 10 })
+
+  await fetchWithRetry(
+    () =>
+      fetch(url, {
+        method: "PUT",
+        headers: {
+          "Content-Type": params.contentType,
+          ...(contentEncoding ? { "Content-Encoding": contentEncoding } : {}),
+        },
+        body: bytes,
+      }),
+    "Upload object to storage"
+  )
+
   return {
     bucket: params.bucket,
     key: params.key,
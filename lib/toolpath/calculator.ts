@@ -7,6 +7,7 @@ import { selectLaserToolpathStrategy, calculateLaserTime, getLaserParameters } f
 import { selectPrintingToolpathStrategy, calculatePrintingTime, getPrintingParameters } from './strategies/printing'
 import { selectSheetMetalToolpathStrategy, calculateSheetMetalTime } from './strategies/sheet-metal'
 import { estimateToolCosts } from '../pricing/tools'
+import type { ToolpathMeshMetrics } from '../geometry/kernel-bridge'
 
 export interface ToolpathEstimate {
   process: string
@@ -30,13 +31,21 @@ export interface ToolpathCalculatorInput {
   process: string
   quantity: number
   volumeMm3?: number
+  /**
+   * Mesh-derived metrics from KernelBridge.computeToolpathMetrics.
+   * When present the strategies use real removal volume, silhouette
+   * perimeter, projected area and overhang area instead of the
+   * parametric estimates below — the parametric formulas cannot see
+   * pockets and holes and deviate 2-3x on CSG parts.
+   */
+  meshMetrics?: ToolpathMeshMetrics
 }
 
 export function calculateToolpath(input: ToolpathCalculatorInput): ToolpathEstimate {
-  const { objectType, dimensions, features, material, process, quantity, volumeMm3 } = input
-  
+  const { objectType, dimensions, features, material, process, quantity, volumeMm3, meshMetrics } = input
+
   // Calculate volume if not provided
-  const volume = volumeMm3 || calculateVolume(dimensions, objectType)
+  const volume = meshMetrics?.partVolumeMm3 || volumeMm3 || calculateVolume(dimensions, objectType)
   
   const featureCount = features.length
   const notes: string[] = []
@@ -57,7 +66,10 @@ export function calculateToolpath(input: ToolpathCalculatorInput): ToolpathEstim
     case 'cnc turning':
     case 'cnc-turning': {
       const strategy = selectCNCToolpathStrategy(objectType, material, featureCount, volume)
-      const time = calculateCNCTime(volume, material, strategy, 1 + (featureCount * 0.1))
+      // Machining time tracks removed material, not part volume; the
+      // mesh metrics measure what the tool actually clears from stock
+      const machiningVolume = meshMetrics?.removalVolumeMm3 ?? volume
+      const time = calculateCNCTime(machiningVolume, material, strategy, 1 + (featureCount * 0.1))
       const cuttingData = getCuttingParameters(material)
       
       timeMinutes = time.totalMinutes * quantity
@@ -82,8 +94,9 @@ export function calculateToolpath(input: ToolpathCalculatorInput): ToolpathEstim
     
     case 'laser-cutting':
     case 'laser cutting': {
-      // Estimate perimeter from dimensions
-      const perimeter = calculatePerimeter(dimensions, objectType)
+      // Measured silhouette perimeter when available, else estimate
+      // from dimensions
+      const perimeter = meshMetrics?.perimeterMm ?? calculatePerimeter(dimensions, objectType)
       const thickness = dimensions.depth || dimensions.height || 2
       const strategy = selectLaserToolpathStrategy(material, thickness)
       const time = calculateLaserTime(perimeter, material, thickness, strategy)
@@ -106,7 +119,11 @@ export function calculateToolpath(input: ToolpathCalculatorInput): ToolpathEstim
     
     case '3d-printing':
     case '3d printing': {
-      const hasSupports = features.some(f => f.type === 'overhang' || f.parameters.depth > 10)
+      // Mesh overhang area is authoritative for supports; the feature
+      // heuristic is the fallback
+      const hasSupports = meshMetrics
+        ? meshMetrics.overhangAreaMm2 > 100
+        : features.some(f => f.type === 'overhang' || f.parameters.depth > 10)
       const quality = featureCount > 10 ? 'high' : featureCount > 5 ? 'standard' : 'draft'
       const strategy = selectPrintingToolpathStrategy(material, quality)
       const time = calculatePrintingTime(volume, material, strategy, hasSupports)
@@ -135,7 +152,7 @@ export function calculateToolpath(input: ToolpathCalculatorInput): ToolpathEstim
     
     case 'sheet-metal':
     case 'sheet metal': {
-      const area = calculateArea(dimensions, objectType)
+      const area = meshMetrics?.projectedAreaMm2 ?? calculateArea(dimensions, objectType)
       const bendCount = features.filter(f => f.type === 'bend').length
       const hasBends = bendCount > 0
       const complexity = featureCount > 5 ? 'complex' : featureCount > 2 ? 'medium' : 'simple'
@@ -188,6 +205,18 @@ export function calculateToolpath(input: ToolpathCalculatorInput): ToolpathEstim
   }
 }
 
+// The four processes the calculator knows how to estimate
+const ALL_PROCESSES = ['cnc-milling', 'laser-cutting', '3d-printing', 'sheet-metal'] as const
+
+// Evaluate every process strategy against the same part. One set of
+// mesh metrics (a single WASM height-field build) serves all four, so
+// comparing processes costs no extra kernel calls.
+export function calculateAllToolpaths(
+  input: Omit<ToolpathCalculatorInput, 'process'>
+): ToolpathEstimate[] {
+  return ALL_PROCESSES.map(process => calculateToolpath({ ...input, process }))
+}
+
 // Helper function to calculate volume
 function calculateVolume(dimensions: Record<string, number>, type: string): number {
   const width = dimensions.width || dimensions.length || 50
@@ -1,6 +1,12 @@
 // lib/toolpath/select-toolpath.ts
 // Enhanced toolpath selection with full manufacturing strategies
 
+import {
+  calculateAllToolpaths,
+  type ToolpathCalculatorInput,
+  type ToolpathEstimate,
+} from './calculator'
+
 export interface ToolpathSelection {
   id: string
   name: string
@@ -314,6 +320,17 @@ export function selectToolpath(params: {
   }
 }
 
+// Compare the four process strategies on real numbers. When the caller
+// passes meshMetrics (from KernelBridge.computeToolpathMetrics) every
+// estimate is mesh-driven; otherwise all four fall back to the same
+// parametric dimensions, so the comparison stays apples-to-apples
+// either way. Sorted cheapest first.
+export function compareToolpaths(
+  input: Omit<ToolpathCalculatorInput, 'process'>
+): ToolpathEstimate[] {
+  return calculateAllToolpaths(input).sort((a, b) => a.totalCost - b.totalCost)
+}
+
 export function getAllProcesses(): Array<{ id: string; name: string }> {
   return TOOLPATH_INFO.map(info => ({
     id: info.id,
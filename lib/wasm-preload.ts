@@ -0,0 +1,83 @@
+// lib/wasm-preload.ts
+// Warm-start support for the Cadmium WASM module.
+//
+// Cold loads used to pay full fetch + compile of cadmium_core_bg.wasm
+// before the first geometry appeared. This module keeps the wasm bytes
+// in the Cache API (shared between the main thread and workers) so:
+//
+// - the main thread can prefetch the bytes during React hydration,
+//   overlapping the download with app startup
+// - the worker serves repeat visits from the cache and hands the
+//   response to WebAssembly.compileStreaming, which lets Chromium
+//   reuse its implicit compiled-code cache (keyed on the response
+//   URL) and skip codegen entirely
+//
+// Browsers no longer allow storing a compiled WebAssembly.Module in
+// IndexedDB, so the byte cache plus the engine's own code cache is
+// the supported warm-start path.
+
+/** Served from public/ at the site root */
+export const CADMIUM_WASM_URL = '/wasm/pkg/cadmium_core_bg.wasm'
+
+const WASM_CACHE_NAME = 'cadmium-wasm-v1'
+
+/**
+ * Returns a Response for the Cadmium wasm binary, cache-first.
+ *
+ * On a cache hit the cached copy is returned immediately and a
+ * background fetch refreshes the entry, so a redeployed binary is
+ * picked up on the next load (a stale module that no longer matches
+ * the bundled glue fails instantiation and falls back to the bundled
+ * import path).
+ */
+export async function getCadmiumWasmResponse(): Promise<Response> {
+  if (typeof caches === 'undefined') {
+    return fetch(CADMIUM_WASM_URL)
+  }
+
+  try {
+    const cache = await caches.open(WASM_CACHE_NAME)
+    const hit = await cache.match(CADMIUM_WASM_URL)
+    if (hit) {
+      fetch(CADMIUM_WASM_URL)
+        .then((response) => {
+          if (response.ok) cache.put(CADMIUM_WASM_URL, response)
+        })
+        .catch(() => {
+          // Offline or transient failure; keep serving the cached copy
+        })
+      return hit
+    }
+
+    const response = await fetch(CADMIUM_WASM_URL)
+    if (response.ok) {
+      await cache.put(CADMIUM_WASM_URL, response.clone())
+    }
+    return response
+  } catch {
+    // Cache API unavailable (e.g. insecure context) - plain fetch
+    // still benefits from the HTTP cache
+    return fetch(CADMIUM_WASM_URL)
+  }
+}
+
+let preloadPromise: Promise<void> | null = null
+
+/**
+ * Starts pulling the wasm bytes into the shared cache without waiting
+ * for the worker. Idempotent; safe to call at module-evaluation time
+ * so the download runs in parallel with React hydration.
+ */
+export function preloadCadmiumWasm(): Promise<void> {
+  if (!preloadPromise) {
+    preloadPromise = getCadmiumWasmResponse()
+      .then((response) => {
+        // The bytes are in the cache; we don't need the body here
+        response.body?.cancel()
+      })
+      .catch(() => {
+        // The worker's own load path will retry and fall back
+      })
+  }
+  return preloadPromise
+}
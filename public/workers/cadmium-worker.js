@@ -11,6 +11,20 @@ const CACHE_TTL_MS = 60 * 60 * 1000;
 const geometryCache = new Map();
 let totalCacheSize = 0;
 
+// Minimal module using v128 ops — validates only on SIMD-capable runtimes
+const WASM_SIMD_PROBE = new Uint8Array([
+  0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 10, 1,
+  8, 0, 65, 0, 253, 15, 253, 98, 11,
+]);
+
+function wasmSimdSupported() {
+  try {
+    return WebAssembly.validate(WASM_SIMD_PROBE);
+  } catch {
+    return false;
+  }
+}
+
 function estimateMeshSize(mesh) {
   const vertexSize = (mesh.vertices?.length || 0) * 8;
   const faceSize = (mesh.faces?.length || 0) * 4;
@@ -75,24 +89,66 @@ function addToCache(id, mesh) {
 }
 
 function getFromCache(id) {
+  const start = performance.now();
   const entry = geometryCache.get(id);
   if (entry) {
     entry.lastAccessed = Date.now();
-    return entry.mesh;
   }
-  return null;
+  recordSpan(entry ? 'cache_hit' : 'cache_miss', 'CACHE_LOOKUP', start, performance.now() - start);
+  return entry ? entry.mesh : null;
+}
+
+// ===== PERF SPANS =====
+// Ring buffer of timed stages drained by GET_PERF_SPANS for the studio
+// perf HUD. Cheap enough to stay on in production.
+const MAX_PERF_SPANS = 512;
+const perfSpans = [];
+
+function recordSpan(name, operation, startMs, durationMs) {
+  if (perfSpans.length >= MAX_PERF_SPANS) {
+    perfSpans.shift();
+  }
+  perfSpans.push({ name, operation, startMs, durationMs });
 }
 
 function generateGeometryId() {
   return `geo_${Date.now()}_${Math.random().toString(36).slice(2, 11)}`;
 }
 
+// Fresh typed arrays per response so the backing buffers can be moved
+// (not cloned) across the thread boundary while the cached mesh stays
+// worker-side.
 function convertMeshToTransferable(mesh) {
   return {
-    vertices: Array.from(mesh.vertices || []),
-    indices: Array.from(mesh.faces || []),
-    normals: Array.from(mesh.normals || []),
+    vertices: new Float32Array(mesh.vertices || []),
+    indices: new Uint32Array(mesh.faces || []),
+    normals: new Float32Array(mesh.normals || []),
+  };
+}
+
+function collectMeshTransfers(result) {
+  const buffers = [];
+  const collect = (mesh) => {
+    if (!mesh) return;
+    for (const key of ['vertices', 'indices', 'normals']) {
+      const view = mesh[key];
+      if (ArrayBuffer.isView(view) && !buffers.includes(view.buffer)) {
+        buffers.push(view.buffer);
+      }
+    }
   };
+  collect(result?.mesh);
+  collect(result); // GET_MESH returns the mesh data directly
+
+  // Binary export payloads (streamed STL chunks, 3MF packages)
+  for (const key of ['buffer', 'chunk']) {
+    const view = result?.[key];
+    if (ArrayBuffer.isView(view) && !buffers.includes(view.buffer)) {
+      buffers.push(view.buffer);
+    }
+  }
+
+  return buffers;
 }
 
 // Initialize Cadmium Worker
@@ -102,7 +158,22 @@ async function initialize() {
 
     // Import the JavaScript fallback
     try {
-      const cadmiumModule = await import('../wasm/pkg/cadmium_core.js');
+      let cadmiumModule = null;
+
+      // Prefer the simd128 artifact when the runtime supports it
+      if (wasmSimdSupported()) {
+        try {
+          cadmiumModule = await import('../wasm/pkg-simd/cadmium_core.js');
+          console.log('✅ Cadmium SIMD build loaded');
+        } catch {
+          console.warn('⚠️ SIMD build not available, using scalar build');
+        }
+      }
+
+      if (!cadmiumModule) {
+        cadmiumModule = await import('../wasm/pkg/cadmium_core.js');
+      }
+
       CadmiumCore = cadmiumModule;
       isInitialized = true;
       console.log('✅ Cadmium JavaScript fallback loaded successfully');
@@ -320,6 +391,30 @@ async function handleOperation(operation, payload) {
       return { content: CadmiumCore.export_obj(mesh, filename), format: 'obj' };
     }
 
+    case 'EXPORT_STL_BINARY': {
+      const { geometryId, filename } = payload;
+      const mesh = getFromCache(geometryId);
+      if (!mesh) throw new Error('Geometry not found in cache');
+      return { buffer: CadmiumCore.export_stl_binary(mesh, filename), format: 'stl' };
+    }
+
+    case 'EXPORT_STL_CHUNK': {
+      // Chunk 0 carries the header; chunks concatenate to the full file
+      const { geometryId, filename, chunkIndex, chunkTriangles } = payload;
+      const mesh = getFromCache(geometryId);
+      if (!mesh) throw new Error('Geometry not found in cache');
+      const totalChunks = CadmiumCore.export_stl_chunk_count(mesh, chunkTriangles);
+      const chunk = CadmiumCore.export_stl_binary_chunk(mesh, filename, chunkIndex, chunkTriangles);
+      return { chunk, chunkIndex, totalChunks, format: 'stl' };
+    }
+
+    case 'EXPORT_3MF': {
+      const { geometryId, filename } = payload;
+      const mesh = getFromCache(geometryId);
+      if (!mesh) throw new Error('Geometry not found in cache');
+      return { buffer: CadmiumCore.export_3mf(mesh, filename), format: '3mf' };
+    }
+
     case 'CLEAR_CACHE': {
       geometryCache.clear();
       totalCacheSize = 0;
@@ -334,6 +429,12 @@ async function handleOperation(operation, payload) {
       return { success: deleted };
     }
 
+    case 'GET_PERF_SPANS': {
+      // Drain: each poll returns only spans recorded since the last one
+      const spans = perfSpans.splice(0, perfSpans.length);
+      return { spans };
+    }
+
     default:
       throw new Error(`Unknown operation: ${operation}`);
   }
@@ -343,7 +444,15 @@ async function handleOperation(operation, payload) {
 initialize();
 
 self.onmessage = async (event) => {
-  const { id, operation, payload } = event.data || {};
+  const { id, operation, payload, sentAt } = event.data || {};
+
+  // Queue wait: time between the main thread posting the message and
+  // this handler running (Date.now on both sides — performance.now
+  // epochs differ between contexts)
+  const receivedAt = performance.now();
+  if (typeof sentAt === 'number') {
+    recordSpan('queue_wait', operation, receivedAt, Math.max(Date.now() - sentAt, 0));
+  }
 
   // Wait for initialization
   if (!isInitialized) {
@@ -379,7 +488,12 @@ self.onmessage = async (event) => {
 
   try {
     const result = await handleOperation(operation, payload);
-    self.postMessage({ id, type: 'RESULT', result });
+    recordSpan('execute', operation, receivedAt, performance.now() - receivedAt);
+
+    const transferStart = performance.now();
+    const transfers = collectMeshTransfers(result);
+    self.postMessage({ id, type: 'RESULT', result }, transfers);
+    recordSpan('transfer', operation, transferStart, performance.now() - transferStart);
   } catch (error) {
     const message = error instanceof Error ? error.message : String(error);
     self.postMessage({ id, type: 'ERROR', error: message });
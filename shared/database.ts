@@ -743,6 +743,33 @@ export type Database = {
           },
         ];
       };
+      platform_stats: {
+        Row: {
+          id: number;
+          total_users: number;
+          total_projects: number;
+          total_parts: number;
+          total_hubs: number;
+          updated_at: string | null;
+        };
+        Insert: {
+          id?: number;
+          total_users?: number;
+          total_projects?: number;
+          total_parts?: number;
+          total_hubs?: number;
+          updated_at?: string | null;
+        };
+        Update: {
+          id?: number;
+          total_users?: number;
+          total_projects?: number;
+          total_parts?: number;
+          total_hubs?: number;
+          updated_at?: string | null;
+        };
+        Relationships: [];
+      };
       profiles: {
         Row: {
           id: string;
@@ -0,0 +1,75 @@
+-- supabase/migrations/002_add_platform_stats.sql
+-- Single-row rollup of platform-wide counters so /api/stats/platform is
+-- one primary-key read instead of four COUNT(*) scans per request.
+
+-- Platform Stats Table (exactly one row, id = 1)
+CREATE TABLE IF NOT EXISTS platform_stats (
+  id INT PRIMARY KEY DEFAULT 1 CHECK (id = 1),
+  total_users BIGINT NOT NULL DEFAULT 0,
+  total_projects BIGINT NOT NULL DEFAULT 0,
+  total_parts BIGINT NOT NULL DEFAULT 0,
+  total_hubs BIGINT NOT NULL DEFAULT 0,
+  updated_at TIMESTAMP WITH TIME ZONE DEFAULT NOW()
+);
+
+-- Seed the row from current table sizes
+INSERT INTO platform_stats (id, total_users, total_projects, total_parts, total_hubs)
+SELECT
+  1,
+  (SELECT COUNT(*) FROM profiles),
+  (SELECT COUNT(*) FROM projects),
+  (SELECT COUNT(*) FROM catalog_parts),
+  (SELECT COUNT(*) FROM hubs)
+ON CONFLICT (id) DO UPDATE SET
+  total_users = EXCLUDED.total_users,
+  total_projects = EXCLUDED.total_projects,
+  total_parts = EXCLUDED.total_parts,
+  total_hubs = EXCLUDED.total_hubs,
+  updated_at = NOW();
+
+-- Incremental maintenance: bump the counter that matches the source
+-- table instead of recounting. updated_at doubles as the ETag source
+-- for the stats endpoint.
+CREATE OR REPLACE FUNCTION update_platform_stats()
+RETURNS TRIGGER AS $$
+DECLARE
+  v_delta INT := CASE WHEN TG_OP = 'INSERT' THEN 1 ELSE -1 END;
+BEGIN
+  UPDATE platform_stats SET
+    total_users = total_users + CASE WHEN TG_TABLE_NAME = 'profiles' THEN v_delta ELSE 0 END,
+    total_projects = total_projects + CASE WHEN TG_TABLE_NAME = 'projects' THEN v_delta ELSE 0 END,
+    total_parts = total_parts + CASE WHEN TG_TABLE_NAME = 'catalog_parts' THEN v_delta ELSE 0 END,
+    total_hubs = total_hubs + CASE WHEN TG_TABLE_NAME = 'hubs' THEN v_delta ELSE 0 END,
+    updated_at = NOW()
+  WHERE id = 1;
+  RETURN COALESCE(NEW, OLD);
+END;
+$$ LANGUAGE plpgsql;
+
+-- Triggers for platform stats updates
+CREATE TRIGGER platform_stats_on_profile
+  AFTER INSERT OR DELETE ON profiles
+  FOR EACH ROW
+  EXECUTE FUNCTION update_platform_stats();
+
+CREATE TRIGGER platform_stats_on_project
+  AFTER INSERT OR DELETE ON projects
+  FOR EACH ROW
+  EXECUTE FUNCTION update_platform_stats();
+
+CREATE TRIGGER platform_stats_on_catalog_part
+  AFTER INSERT OR DELETE ON catalog_parts
+  FOR EACH ROW
+  EXECUTE FUNCTION update_platform_stats();
+
+CREATE TRIGGER platform_stats_on_hub
+  AFTER INSERT OR DELETE ON hubs
+  FOR EACH ROW
+  EXECUTE FUNCTION update_platform_stats();
+
+-- RLS: platform stats are public (landing page numbers)
+ALTER TABLE platform_stats ENABLE ROW LEVEL SECURITY;
+
+CREATE POLICY "Anyone can view platform stats" ON platform_stats
+  FOR SELECT TO anon, authenticated
+  USING (true);
@@ -0,0 +1,31 @@
+-- supabase/migrations/003_add_collaboration_snapshots.sql
+-- Compacted Y.js room snapshots. The elected compactor client rewrites
+-- the room state without its update history every few minutes; joining
+-- clients warm-start from this blob instead of replaying the room's
+-- whole update log over the websocket.
+
+CREATE TABLE IF NOT EXISTS collaboration_snapshots (
+  id UUID PRIMARY KEY DEFAULT gen_random_uuid(),
+  -- One snapshot per room; the compactor upserts on this key
+  room_name TEXT NOT NULL UNIQUE,
+  -- base64-encoded Y.js update (TEXT rather than BYTEA so the browser
+  -- client reads and writes it without Buffer)
+  snapshot TEXT NOT NULL,
+  updated_at TIMESTAMP WITH TIME ZONE DEFAULT NOW()
+);
+
+-- RLS: rooms are joined by authenticated collaborators, and the
+-- snapshot holds the same state the websocket already shares
+ALTER TABLE collaboration_snapshots ENABLE ROW LEVEL SECURITY;
+
+CREATE POLICY "Authenticated users can view snapshots" ON collaboration_snapshots
+  FOR SELECT TO authenticated
+  USING (true);
+
+CREATE POLICY "Authenticated users can insert snapshots" ON collaboration_snapshots
+  FOR INSERT TO authenticated
+  WITH CHECK (true);
+
+CREATE POLICY "Authenticated users can update snapshots" ON collaboration_snapshots
+  FOR UPDATE TO authenticated
+  USING (true);
@@ -1381,6 +1381,115 @@ CREATE TRIGGER update_stats_on_payment
   FOR EACH ROW
   EXECUTE FUNCTION update_user_stats();
 
+-- =============================================================================
+-- TABLE: platform_stats
+-- Single-row rollup of platform-wide counters (id = 1). Maintained
+-- incrementally by triggers so the public stats endpoint is one
+-- primary-key read; updated_at doubles as the ETag source.
+-- =============================================================================
+CREATE TABLE IF NOT EXISTS platform_stats (
+  id INT PRIMARY KEY DEFAULT 1 CHECK (id = 1),
+  total_users BIGINT NOT NULL DEFAULT 0,
+  total_projects BIGINT NOT NULL DEFAULT 0,
+  total_parts BIGINT NOT NULL DEFAULT 0,
+  total_hubs BIGINT NOT NULL DEFAULT 0,
+  updated_at TIMESTAMP WITH TIME ZONE DEFAULT NOW()
+);
+
+-- Seed the row from current table sizes
+INSERT INTO platform_stats (id, total_users, total_projects, total_parts, total_hubs)
+SELECT
+  1,
+  (SELECT COUNT(*) FROM profiles),
+  (SELECT COUNT(*) FROM projects),
+  (SELECT COUNT(*) FROM catalog_parts),
+  (SELECT COUNT(*) FROM hubs)
+ON CONFLICT (id) DO UPDATE SET
+  total_users = EXCLUDED.total_users,
+  total_projects = EXCLUDED.total_projects,
+  total_parts = EXCLUDED.total_parts,
+  total_hubs = EXCLUDED.total_hubs,
+  updated_at = NOW();
+
+-- RLS: platform stats are public (landing page numbers)
+ALTER TABLE platform_stats ENABLE ROW LEVEL SECURITY;
+
+CREATE POLICY "Anyone can view platform stats" ON platform_stats
+  FOR SELECT TO anon, authenticated
+  USING (true);
+
+-- =============================================================================
+-- HELPER FUNCTION: Update platform stats
+-- =============================================================================
+CREATE OR REPLACE FUNCTION update_platform_stats()
+RETURNS TRIGGER AS $$
+DECLARE
+  v_delta INT := CASE WHEN TG_OP = 'INSERT' THEN 1 ELSE -1 END;
+BEGIN
+  UPDATE platform_stats SET
+    total_users = total_users + CASE WHEN TG_TABLE_NAME = 'profiles' THEN v_delta ELSE 0 END,
+    total_projects = total_projects + CASE WHEN TG_TABLE_NAME = 'projects' THEN v_delta ELSE 0 END,
+    total_parts = total_parts + CASE WHEN TG_TABLE_NAME = 'catalog_parts' THEN v_delta ELSE 0 END,
+    total_hubs = total_hubs + CASE WHEN TG_TABLE_NAME = 'hubs' THEN v_delta ELSE 0 END,
+    updated_at = NOW()
+  WHERE id = 1;
+  RETURN COALESCE(NEW, OLD);
+END;
+$$ LANGUAGE plpgsql;
+
+-- Triggers for platform stats updates
+CREATE TRIGGER platform_stats_on_profile
+  AFTER INSERT OR DELETE ON profiles
+  FOR EACH ROW
+  EXECUTE FUNCTION update_platform_stats();
+
+CREATE TRIGGER platform_stats_on_project
+  AFTER INSERT OR DELETE ON projects
+  FOR EACH ROW
+  EXECUTE FUNCTION update_platform_stats();
+
+CREATE TRIGGER platform_stats_on_catalog_part
+  AFTER INSERT OR DELETE ON catalog_parts
+  FOR EACH ROW
+  EXECUTE FUNCTION update_platform_stats();
+
+CREATE TRIGGER platform_stats_on_hub
+  AFTER INSERT OR DELETE ON hubs
+  FOR EACH ROW
+  EXECUTE FUNCTION update_platform_stats();
+
+-- =============================================================================
+-- TABLE: collaboration_snapshots
+-- Compacted Y.js room snapshots, one per room. The elected compactor
+-- client upserts a history-free rewrite of the room state every few
+-- minutes; joining clients warm-start from it instead of replaying the
+-- room's whole update log over the websocket.
+-- =============================================================================
+CREATE TABLE IF NOT EXISTS collaboration_snapshots (
+  id UUID PRIMARY KEY DEFAULT gen_random_uuid(),
+  room_name TEXT NOT NULL UNIQUE,
+  -- base64-encoded Y.js update (TEXT rather than BYTEA so the browser
+  -- client reads and writes it without Buffer)
+  snapshot TEXT NOT NULL,
+  updated_at TIMESTAMP WITH TIME ZONE DEFAULT NOW()
+);
+
+-- RLS: rooms are joined by authenticated collaborators, and the
+-- snapshot holds the same state the websocket already shares
+ALTER TABLE collaboration_snapshots ENABLE ROW LEVEL SECURITY;
+
+CREATE POLICY "Authenticated users can view snapshots" ON collaboration_snapshots
+  FOR SELECT TO authenticated
+  USING (true);
+
+CREATE POLICY "Authenticated users can insert snapshots" ON collaboration_snapshots
+  FOR INSERT TO authenticated
+  WITH CHECK (true);
+
+CREATE POLICY "Authenticated users can update snapshots" ON collaboration_snapshots
+  FOR UPDATE TO authenticated
+  USING (true);
+
 -- =============================================================================
 -- AUTO-CREATE PROFILE TRIGGER
 -- =============================================================================
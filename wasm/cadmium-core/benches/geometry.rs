@@ -0,0 +1,91 @@
+//! Criterion benchmarks for the cadmium-core hot paths.
+//!
+//! Covers primitive tessellation, CSG booleans, normal computation
+//! (implicitly, through mesh construction), and binary STL export.
+//! Run with:
+//!
+//!     cargo bench --target x86_64-unknown-linux-gnu
+//!
+//! Numbers are native-target, not wasm — use them for relative
+//! regression tracking release over release, not absolute browser
+//! latency (the worker round-trip harness in lib/perf covers that).
+
+use cadmium_core::{
+    boolean_intersect, boolean_subtract, boolean_union, create_box, create_cylinder,
+    create_sphere, create_torus, export_3mf, export_stl_binary,
+};
+use criterion::{black_box, criterion_group, criterion_main, Criterion};
+
+fn bench_tessellation(c: &mut Criterion) {
+    let mut group = c.benchmark_group("tessellation");
+
+    group.bench_function("box", |b| {
+        b.iter(|| create_box(black_box(100.0), black_box(50.0), black_box(25.0)).unwrap())
+    });
+
+    group.bench_function("cylinder_32", |b| {
+        b.iter(|| create_cylinder(black_box(25.0), black_box(100.0), Some(32)).unwrap())
+    });
+
+    group.bench_function("cylinder_128", |b| {
+        b.iter(|| create_cylinder(black_box(25.0), black_box(100.0), Some(128)).unwrap())
+    });
+
+    group.bench_function("sphere_32", |b| {
+        b.iter(|| create_sphere(black_box(25.0), Some(32), Some(32)).unwrap())
+    });
+
+    group.bench_function("sphere_128", |b| {
+        b.iter(|| create_sphere(black_box(25.0), Some(128), Some(128)).unwrap())
+    });
+
+    group.bench_function("torus_64", |b| {
+        b.iter(|| create_torus(black_box(50.0), black_box(10.0), Some(64), Some(32)).unwrap())
+    });
+
+    group.finish();
+}
+
+fn bench_booleans(c: &mut Criterion) {
+    let mut group = c.benchmark_group("booleans");
+    // Booleans are the slowest operations in the pipeline; a small
+    // sample count keeps the suite under a minute
+    group.sample_size(20);
+
+    let box_mesh = create_box(100.0, 100.0, 100.0).unwrap();
+    let sphere = create_sphere(60.0, Some(32), Some(32)).unwrap();
+    let cylinder = create_cylinder(30.0, 200.0, Some(32)).unwrap();
+
+    group.bench_function("union_box_sphere", |b| {
+        b.iter(|| boolean_union(black_box(&box_mesh), black_box(&sphere)).unwrap())
+    });
+
+    group.bench_function("subtract_cylinder_from_box", |b| {
+        b.iter(|| boolean_subtract(black_box(&box_mesh), black_box(&cylinder)).unwrap())
+    });
+
+    group.bench_function("intersect_box_sphere", |b| {
+        b.iter(|| boolean_intersect(black_box(&box_mesh), black_box(&sphere)).unwrap())
+    });
+
+    group.finish();
+}
+
+fn bench_export(c: &mut Criterion) {
+    let mut group = c.benchmark_group("export");
+
+    let mesh = create_sphere(25.0, Some(64), Some(64)).unwrap();
+
+    group.bench_function("stl_binary_sphere_64", |b| {
+        b.iter(|| export_stl_binary(black_box(&mesh), "bench"))
+    });
+
+    group.bench_function("3mf_sphere_64", |b| {
+        b.iter(|| export_3mf(black_box(&mesh), "bench"))
+    });
+
+    group.finish();
+}
+
+criterion_group!(benches, bench_tessellation, bench_booleans, bench_export);
+criterion_main!(benches);
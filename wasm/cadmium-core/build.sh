@@ -11,8 +11,23 @@ if ! command -v wasm-pack &> /dev/null; then
     curl https://rustwasm.org/wasm-pack/installer/init.sh -sSf | sh
 fi
 
-# Build release bundle
+# Build release bundle (scalar baseline — runs everywhere)
 wasm-pack build --release --target bundler
 
-echo "✓ WASM build complete: pkg/cadmium_core.js"
+# Second artifact with WASM SIMD enabled. Workers probe for simd128
+# support at runtime and prefer this build when available.
+echo "Building SIMD variant..."
+RUSTFLAGS="-C target-feature=+simd128" \
+  wasm-pack build --release --target bundler --out-dir pkg-simd
+
+# Optional: SIMD + threads (rayon over SharedArrayBuffer). Needs nightly
+# for atomics/build-std, and a cross-origin-isolated page at runtime.
+if [ "${WITH_THREADS:-0}" = "1" ]; then
+    echo "Building SIMD+threads variant..."
+    RUSTFLAGS="-C target-feature=+simd128,+atomics,+bulk-memory,+mutable-globals" \
+      rustup run nightly wasm-pack build --release --target bundler --out-dir pkg-simd \
+      -- --features threads -Z build-std=panic_abort,std
+fi
+
+echo "✓ WASM build complete: pkg/cadmium_core.js (scalar), pkg-simd/cadmium_core.js (simd128)"
 echo "✓ Module ready for import in frontend workers"
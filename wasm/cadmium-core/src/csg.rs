@@ -1,10 +1,23 @@
 // CSG (Constructive Solid Geometry) Implementation
 // Implements boolean operations: union, subtract, intersect
+//
+// Triangle/surface classification is accelerated by a bounding-volume
+// hierarchy (BVH) built over the mesh triangles. The BVH is constructed
+// once per mesh and reused for every ray cast and candidate-pair query,
+// so a boolean over two meshes costs O(n log n) instead of the all-pairs
+// scan the original implementation performed. Boolean results keep their
+// BVH alive so chained operations (the union → subtract → subtract
+// pattern produced by add_hole) never rebuild it from scratch.
 
 use nalgebra::{Vector3, Point3};
 use std::collections::HashMap;
 
 const EPSILON: f64 = 1e-10;
+// Tolerance for classifying a vertex as lying on a splitting plane.
+const PLANE_EPSILON: f64 = 1e-9;
+// Maximum triangles per BVH leaf; small leaves keep traversal shallow
+// without exploding node count.
+const BVH_LEAF_SIZE: usize = 8;
 
 #[derive(Clone, Debug)]
 pub struct Triangle {
@@ -16,18 +29,24 @@ impl Triangle {
     pub fn new(v0: Point3<f64>, v1: Point3<f64>, v2: Point3<f64>) -> Self {
         let edge1 = v1 - v0;
         let edge2 = v2 - v0;
-        let normal = edge1.cross(&edge2).normalize();
-        
+        let cross = edge1.cross(&edge2);
+        let normal = if cross.norm() > EPSILON {
+            cross.normalize()
+        } else {
+            // Degenerate triangle; keep a placeholder normal rather than NaN.
+            Vector3::new(0.0, 0.0, 1.0)
+        };
+
         Triangle {
             vertices: [v0, v1, v2],
             normal,
         }
     }
-    
+
     pub fn compute_aabb(&self) -> AABB {
         let mut min = self.vertices[0];
         let mut max = self.vertices[0];
-        
+
         for v in &self.vertices[1..] {
             min.x = min.x.min(v.x);
             min.y = min.y.min(v.y);
@@ -36,10 +55,18 @@ impl Triangle {
             max.y = max.y.max(v.y);
             max.z = max.z.max(v.z);
         }
-        
+
         AABB { min, max }
     }
-    
+
+    pub fn centroid(&self) -> Point3<f64> {
+        Point3::new(
+            (self.vertices[0].x + self.vertices[1].x + self.vertices[2].x) / 3.0,
+            (self.vertices[0].y + self.vertices[1].y + self.vertices[2].y) / 3.0,
+            (self.vertices[0].z + self.vertices[1].z + self.vertices[2].z) / 3.0,
+        )
+    }
+
     // Check if point is inside triangle (for projection tests)
     pub fn contains_point_2d(&self, p: &Point3<f64>, axis: usize) -> bool {
         let (i1, i2) = match axis {
@@ -47,18 +74,18 @@ impl Triangle {
             1 => (0, 2), // Project to XZ
             _ => (0, 1), // Project to XY
         };
-        
+
         let v0 = &self.vertices[0];
         let v1 = &self.vertices[1];
         let v2 = &self.vertices[2];
-        
+
         let d1 = sign_2d(p, v0, v1, i1, i2);
         let d2 = sign_2d(p, v1, v2, i1, i2);
         let d3 = sign_2d(p, v2, v0, i1, i2);
-        
+
         let has_neg = (d1 < 0.0) || (d2 < 0.0) || (d3 < 0.0);
         let has_pos = (d1 > 0.0) || (d2 > 0.0) || (d3 > 0.0);
-        
+
         !(has_neg && has_pos)
     }
 }
@@ -67,7 +94,7 @@ fn sign_2d(p1: &Point3<f64>, p2: &Point3<f64>, p3: &Point3<f64>, i1: usize, i2:
     let p1_coords = [p1.x, p1.y, p1.z];
     let p2_coords = [p2.x, p2.y, p2.z];
     let p3_coords = [p3.x, p3.y, p3.z];
-    
+
     (p1_coords[i1] - p3_coords[i1]) * (p2_coords[i2] - p3_coords[i2]) -
     (p2_coords[i1] - p3_coords[i1]) * (p1_coords[i2] - p3_coords[i2])
 }
@@ -84,13 +111,13 @@ impl AABB {
         self.min.y <= other.max.y && self.max.y >= other.min.y &&
         self.min.z <= other.max.z && self.max.z >= other.min.z
     }
-    
+
     pub fn contains_point(&self, p: &Point3<f64>) -> bool {
         p.x >= self.min.x && p.x <= self.max.x &&
         p.y >= self.min.y && p.y <= self.max.y &&
         p.z >= self.min.z && p.z <= self.max.z
     }
-    
+
     pub fn expand(&mut self, p: &Point3<f64>) {
         self.min.x = self.min.x.min(p.x);
         self.min.y = self.min.y.min(p.y);
@@ -99,22 +126,215 @@ impl AABB {
         self.max.y = self.max.y.max(p.y);
         self.max.z = self.max.z.max(p.z);
     }
+
+    fn merge(&mut self, other: &AABB) {
+        self.expand(&other.min);
+        self.expand(&other.max);
+    }
+
+    // Slab test; handles axis-parallel rays via the IEEE inf semantics
+    // of division by zero.
+    fn intersects_ray(&self, origin: &Point3<f64>, inv_dir: &Vector3<f64>) -> bool {
+        let t1 = (self.min.x - origin.x) * inv_dir.x;
+        let t2 = (self.max.x - origin.x) * inv_dir.x;
+        let mut tmin = t1.min(t2);
+        let mut tmax = t1.max(t2);
+
+        let t1 = (self.min.y - origin.y) * inv_dir.y;
+        let t2 = (self.max.y - origin.y) * inv_dir.y;
+        tmin = tmin.max(t1.min(t2));
+        tmax = tmax.min(t1.max(t2));
+
+        let t1 = (self.min.z - origin.z) * inv_dir.z;
+        let t2 = (self.max.z - origin.z) * inv_dir.z;
+        tmin = tmin.max(t1.min(t2));
+        tmax = tmax.min(t1.max(t2));
+
+        tmax >= tmin.max(0.0)
+    }
+}
+
+// ============ BOUNDING VOLUME HIERARCHY ============
+
+#[derive(Clone, Debug)]
+struct BvhNode {
+    aabb: AABB,
+    // Internal nodes: indices of children. Leaves: left == u32::MAX and
+    // [start, start + count) indexes into Bvh::tri_indices.
+    left: u32,
+    right: u32,
+    start: u32,
+    count: u32,
 }
 
+#[derive(Clone, Debug)]
+pub struct Bvh {
+    nodes: Vec<BvhNode>,
+    tri_indices: Vec<u32>,
+}
+
+impl Bvh {
+    pub fn build(triangles: &[Triangle]) -> Self {
+        let mut tri_indices: Vec<u32> = (0..triangles.len() as u32).collect();
+        let mut nodes = Vec::with_capacity(triangles.len() / BVH_LEAF_SIZE * 2 + 1);
+
+        if triangles.is_empty() {
+            nodes.push(BvhNode {
+                aabb: AABB { min: Point3::origin(), max: Point3::origin() },
+                left: u32::MAX,
+                right: u32::MAX,
+                start: 0,
+                count: 0,
+            });
+            return Bvh { nodes, tri_indices };
+        }
+
+        let centroids: Vec<Point3<f64>> = triangles.iter().map(|t| t.centroid()).collect();
+        Self::build_node(triangles, &centroids, &mut tri_indices, &mut nodes, 0, triangles.len());
+        Bvh { nodes, tri_indices }
+    }
+
+    fn build_node(
+        triangles: &[Triangle],
+        centroids: &[Point3<f64>],
+        tri_indices: &mut [u32],
+        nodes: &mut Vec<BvhNode>,
+        start: usize,
+        end: usize,
+    ) -> u32 {
+        let mut aabb = triangles[tri_indices[start] as usize].compute_aabb();
+        for &idx in &tri_indices[start + 1..end] {
+            aabb.merge(&triangles[idx as usize].compute_aabb());
+        }
+
+        let node_index = nodes.len() as u32;
+        nodes.push(BvhNode {
+            aabb,
+            left: u32::MAX,
+            right: u32::MAX,
+            start: start as u32,
+            count: (end - start) as u32,
+        });
+
+        if end - start <= BVH_LEAF_SIZE {
+            return node_index;
+        }
+
+        // Median split along the longest axis of the centroid extent.
+        let node_aabb = &nodes[node_index as usize].aabb;
+        let extent = node_aabb.max - node_aabb.min;
+        let axis = if extent.x >= extent.y && extent.x >= extent.z {
+            0
+        } else if extent.y >= extent.z {
+            1
+        } else {
+            2
+        };
+
+        let mid = (start + end) / 2;
+        tri_indices[start..end].select_nth_unstable_by(mid - start, |&a, &b| {
+            let ca = centroids[a as usize];
+            let cb = centroids[b as usize];
+            let (ka, kb) = match axis {
+                0 => (ca.x, cb.x),
+                1 => (ca.y, cb.y),
+                _ => (ca.z, cb.z),
+            };
+            ka.partial_cmp(&kb).unwrap_or(std::cmp::Ordering::Equal)
+        });
+
+        let left = Self::build_node(triangles, centroids, tri_indices, nodes, start, mid);
+        let right = Self::build_node(triangles, centroids, tri_indices, nodes, mid, end);
+        nodes[node_index as usize].left = left;
+        nodes[node_index as usize].right = right;
+        nodes[node_index as usize].count = 0;
+        node_index
+    }
+
+    // Collect indices of triangles whose AABB may overlap `query`.
+    pub fn query_aabb(&self, query: &AABB, out: &mut Vec<u32>) {
+        out.clear();
+        if self.tri_indices.is_empty() {
+            return;
+        }
+
+        let mut stack = vec![0u32];
+        while let Some(node_index) = stack.pop() {
+            let node = &self.nodes[node_index as usize];
+            if !node.aabb.intersects(query) {
+                continue;
+            }
+            if node.count > 0 {
+                let start = node.start as usize;
+                let end = start + node.count as usize;
+                out.extend_from_slice(&self.tri_indices[start..end]);
+            } else {
+                stack.push(node.left);
+                stack.push(node.right);
+            }
+        }
+    }
+
+    // Count ray/triangle crossings for the parity-based inside test.
+    fn count_ray_hits(
+        &self,
+        triangles: &[Triangle],
+        origin: &Point3<f64>,
+        direction: &Vector3<f64>,
+    ) -> u32 {
+        if self.tri_indices.is_empty() {
+            return 0;
+        }
+
+        let inv_dir = Vector3::new(1.0 / direction.x, 1.0 / direction.y, 1.0 / direction.z);
+        let mut hits = 0;
+        let mut stack = vec![0u32];
+
+        while let Some(node_index) = stack.pop() {
+            let node = &self.nodes[node_index as usize];
+            if !node.aabb.intersects_ray(origin, &inv_dir) {
+                continue;
+            }
+            if node.count > 0 {
+                let start = node.start as usize;
+                let end = start + node.count as usize;
+                for &tri_index in &self.tri_indices[start..end] {
+                    if ray_intersects_triangle(origin, direction, &triangles[tri_index as usize]) {
+                        hits += 1;
+                    }
+                }
+            } else {
+                stack.push(node.left);
+                stack.push(node.right);
+            }
+        }
+
+        hits
+    }
+}
+
+#[derive(Clone, Debug)]
 pub struct CSGMesh {
     pub triangles: Vec<Triangle>,
     pub aabb: AABB,
+    bvh: Bvh,
 }
 
 impl CSGMesh {
+    pub fn from_triangles(triangles: Vec<Triangle>) -> Self {
+        let aabb = compute_mesh_aabb(&triangles);
+        let bvh = Bvh::build(&triangles);
+        CSGMesh { triangles, aabb, bvh }
+    }
+
     pub fn from_buffers(vertices: &[f64], faces: &[u32]) -> Self {
-        let mut triangles = Vec::new();
-        
+        let mut triangles = Vec::with_capacity(faces.len() / 3);
+
         for i in (0..faces.len()).step_by(3) {
             let idx0 = faces[i] as usize;
             let idx1 = faces[i + 1] as usize;
             let idx2 = faces[i + 2] as usize;
-            
+
             let v0 = Point3::new(
                 vertices[idx0 * 3],
                 vertices[idx0 * 3 + 1],
@@ -130,25 +350,23 @@ impl CSGMesh {
                 vertices[idx2 * 3 + 1],
                 vertices[idx2 * 3 + 2],
             );
-            
+
             triangles.push(Triangle::new(v0, v1, v2));
         }
-        
-        let aabb = compute_mesh_aabb(&triangles);
-        
-        CSGMesh { triangles, aabb }
+
+        Self::from_triangles(triangles)
     }
-    
+
     pub fn to_buffers(&self) -> (Vec<f64>, Vec<u32>, Vec<f64>) {
         let mut vertices = Vec::new();
         let mut faces = Vec::new();
         let mut normals = Vec::new();
         let mut vertex_map: HashMap<(i64, i64, i64), u32> = HashMap::new();
         let mut next_index = 0;
-        
+
         for tri in &self.triangles {
             let mut indices = [0u32; 3];
-            
+
             for (i, v) in tri.vertices.iter().enumerate() {
                 // Quantize vertex coordinates for deduplication
                 let key = (
@@ -156,7 +374,7 @@ impl CSGMesh {
                     (v.y * 1e6) as i64,
                     (v.z * 1e6) as i64,
                 );
-                
+
                 let idx = *vertex_map.entry(key).or_insert_with(|| {
                     vertices.push(v.x);
                     vertices.push(v.y);
@@ -168,35 +386,27 @@ impl CSGMesh {
                     next_index += 1;
                     idx
                 });
-                
+
                 indices[i] = idx;
             }
-            
+
             faces.extend_from_slice(&indices);
         }
-        
+
         (vertices, faces, normals)
     }
-    
-    // Ray casting for inside/outside test
+
+    // Ray casting for inside/outside test, accelerated by the BVH.
     pub fn is_point_inside(&self, point: &Point3<f64>) -> bool {
         if !self.aabb.contains_point(point) {
             return false;
         }
-        
-        // Cast ray in +X direction and count intersections
-        let ray_origin = *point;
-        let ray_dir = Vector3::new(1.0, 0.0, 0.0);
-        let mut intersection_count = 0;
-        
-        for tri in &self.triangles {
-            if ray_intersects_triangle(&ray_origin, &ray_dir, tri) {
-                intersection_count += 1;
-            }
-        }
-        
-        // Odd number of intersections = inside
-        intersection_count % 2 == 1
+
+        // Cast ray in a direction unlikely to graze edges exactly and
+        // count intersections; odd parity means inside.
+        let ray_dir = Vector3::new(1.0, 1e-4, 1e-5).normalize();
+        let hits = self.bvh.count_ray_hits(&self.triangles, point, &ray_dir);
+        hits % 2 == 1
     }
 }
 
@@ -207,15 +417,15 @@ fn compute_mesh_aabb(triangles: &[Triangle]) -> AABB {
             max: Point3::origin(),
         };
     }
-    
+
     let mut aabb = triangles[0].compute_aabb();
-    
+
     for tri in &triangles[1..] {
         let tri_aabb = tri.compute_aabb();
         aabb.expand(&tri_aabb.min);
         aabb.expand(&tri_aabb.max);
     }
-    
+
     aabb
 }
 
@@ -223,124 +433,322 @@ fn compute_mesh_aabb(triangles: &[Triangle]) -> AABB {
 fn ray_intersects_triangle(origin: &Point3<f64>, direction: &Vector3<f64>, tri: &Triangle) -> bool {
     let edge1 = tri.vertices[1] - tri.vertices[0];
     let edge2 = tri.vertices[2] - tri.vertices[0];
-    
+
     let h = direction.cross(&edge2);
     let a = edge1.dot(&h);
-    
+
     if a.abs() < EPSILON {
         return false;
     }
-    
+
     let f = 1.0 / a;
     let s = origin - tri.vertices[0];
     let u = f * s.dot(&h);
-    
+
     if u < 0.0 || u > 1.0 {
         return false;
     }
-    
+
     let q = s.cross(&edge1);
     let v = f * direction.dot(&q);
-    
+
     if v < 0.0 || u + v > 1.0 {
         return false;
     }
-    
+
     let t = f * edge2.dot(&q);
-    
+
     t > EPSILON
 }
 
-// Simplified CSG operations
-pub fn csg_union(mesh_a: &CSGMesh, mesh_b: &CSGMesh) -> CSGMesh {
-    let mut result_triangles = Vec::new();
-    
-    // Add triangles from A that are outside B
-    for tri in &mesh_a.triangles {
-        let centroid = compute_triangle_centroid(tri);
-        if !mesh_b.is_point_inside(&centroid) {
-            result_triangles.push(tri.clone());
+// ============ TRIANGLE SPLITTING ============
+
+// Split a triangle by the plane (normal, d) where points satisfy
+// normal·p = d. Fragments entirely on one side are pushed to the
+// matching output; spanning triangles are clipped into up to three.
+fn split_triangle_by_plane(
+    tri: &Triangle,
+    plane_normal: &Vector3<f64>,
+    plane_d: f64,
+    front: &mut Vec<Triangle>,
+    back: &mut Vec<Triangle>,
+) {
+    let dists: [f64; 3] = [
+        plane_normal.dot(&tri.vertices[0].coords) - plane_d,
+        plane_normal.dot(&tri.vertices[1].coords) - plane_d,
+        plane_normal.dot(&tri.vertices[2].coords) - plane_d,
+    ];
+
+    let has_front = dists.iter().any(|&d| d > PLANE_EPSILON);
+    let has_back = dists.iter().any(|&d| d < -PLANE_EPSILON);
+
+    if !has_front && !has_back {
+        // Coplanar with the splitting plane; keep with the side the
+        // triangle's normal agrees with so orientation survives.
+        if tri.normal.dot(plane_normal) >= 0.0 {
+            front.push(tri.clone());
+        } else {
+            back.push(tri.clone());
         }
+        return;
     }
-    
-    // Add triangles from B that are outside A
-    for tri in &mesh_b.triangles {
-        let centroid = compute_triangle_centroid(tri);
-        if !mesh_a.is_point_inside(&centroid) {
-            result_triangles.push(tri.clone());
-        }
+    if !has_back {
+        front.push(tri.clone());
+        return;
     }
-    
-    let aabb = compute_mesh_aabb(&result_triangles);
-    
-    CSGMesh {
-        triangles: result_triangles,
-        aabb,
+    if !has_front {
+        back.push(tri.clone());
+        return;
     }
-}
 
-pub fn csg_subtract(base: &CSGMesh, tool: &CSGMesh) -> CSGMesh {
-    let mut result_triangles = Vec::new();
-    
-    // Keep triangles from base that are outside tool
-    for tri in &base.triangles {
-        let centroid = compute_triangle_centroid(tri);
-        if !tool.is_point_inside(&centroid) {
-            result_triangles.push(tri.clone());
+    // Spanning: clip the polygon against the plane on both sides.
+    let mut front_poly: Vec<Point3<f64>> = Vec::with_capacity(4);
+    let mut back_poly: Vec<Point3<f64>> = Vec::with_capacity(4);
+
+    for i in 0..3 {
+        let j = (i + 1) % 3;
+        let vi = tri.vertices[i];
+        let di = dists[i];
+        let dj = dists[j];
+
+        if di >= -PLANE_EPSILON {
+            front_poly.push(vi);
+        }
+        if di <= PLANE_EPSILON {
+            back_poly.push(vi);
+        }
+
+        // Edge crosses the plane strictly: emit the intersection point
+        // into both polygons.
+        if (di > PLANE_EPSILON && dj < -PLANE_EPSILON) || (di < -PLANE_EPSILON && dj > PLANE_EPSILON) {
+            let t = di / (di - dj);
+            let p = vi + (tri.vertices[j] - vi) * t;
+            front_poly.push(p);
+            back_poly.push(p);
         }
     }
-    
-    // Add inverted triangles from tool that are inside base
-    for tri in &tool.triangles {
-        let centroid = compute_triangle_centroid(tri);
-        if base.is_point_inside(&centroid) {
-            let mut inverted = tri.clone();
-            // Invert triangle by swapping vertices
-            inverted.vertices.swap(1, 2);
-            inverted.normal = -inverted.normal;
-            result_triangles.push(inverted);
+
+    fan_triangulate(&front_poly, &tri.normal, front);
+    fan_triangulate(&back_poly, &tri.normal, back);
+}
+
+fn fan_triangulate(poly: &[Point3<f64>], normal: &Vector3<f64>, out: &mut Vec<Triangle>) {
+    for i in 1..poly.len().saturating_sub(1) {
+        let tri = Triangle::new(poly[0], poly[i], poly[i + 1]);
+        // Reject slivers produced by clipping at tolerance.
+        let e1 = tri.vertices[1] - tri.vertices[0];
+        let e2 = tri.vertices[2] - tri.vertices[0];
+        if e1.cross(&e2).norm() < EPSILON {
+            continue;
+        }
+        // Preserve the winding of the source triangle.
+        if tri.normal.dot(normal) < 0.0 {
+            let mut flipped = tri;
+            flipped.vertices.swap(1, 2);
+            flipped.normal = -flipped.normal;
+            out.push(flipped);
+        } else {
+            out.push(tri);
         }
     }
-    
-    let aabb = compute_mesh_aabb(&result_triangles);
-    
-    CSGMesh {
-        triangles: result_triangles,
-        aabb,
+}
+
+// ============ CLASSIFICATION ============
+
+#[derive(Clone, Copy, PartialEq)]
+enum Keep {
+    Outside,
+    Inside,
+}
+
+// Split the triangles of `mesh` against the surface of `other` wherever
+// the two meshes can intersect, then keep the fragments whose centroids
+// classify to `keep`. When `invert` is set, kept fragments are flipped
+// (used for the tool surface of a subtraction).
+fn classify_against(
+    mesh: &CSGMesh,
+    other: &CSGMesh,
+    keep: Keep,
+    invert: bool,
+    result: &mut Vec<Triangle>,
+) {
+    let mut candidates: Vec<u32> = Vec::new();
+    let mut fragments: Vec<Triangle> = Vec::new();
+    let mut split_front: Vec<Triangle> = Vec::new();
+    let mut split_back: Vec<Triangle> = Vec::new();
+
+    for tri in &mesh.triangles {
+        let tri_aabb = tri.compute_aabb();
+        other.bvh.query_aabb(&tri_aabb, &mut candidates);
+
+        fragments.clear();
+
+        if candidates.is_empty() {
+            // Far from the other surface: classify the whole triangle.
+            fragments.push(tri.clone());
+        } else {
+            // Near the other surface: split against candidate planes so
+            // fragments lie strictly on one side before classification.
+            fragments.push(tri.clone());
+            for &candidate_index in &candidates {
+                let cut = &other.triangles[candidate_index as usize];
+                let plane_d = cut.normal.dot(&cut.vertices[0].coords);
+
+                split_front.clear();
+                split_back.clear();
+                for fragment in &fragments {
+                    split_triangle_by_plane(
+                        fragment,
+                        &cut.normal,
+                        plane_d,
+                        &mut split_front,
+                        &mut split_back,
+                    );
+                }
+                fragments.clear();
+                fragments.extend_from_slice(&split_front);
+                fragments.extend_from_slice(&split_back);
+            }
+        }
+
+        for fragment in &fragments {
+            let inside = other.is_point_inside(&fragment.centroid());
+            let wanted = match keep {
+                Keep::Outside => !inside,
+                Keep::Inside => inside,
+            };
+            if !wanted {
+                continue;
+            }
+            if invert {
+                let mut flipped = fragment.clone();
+                flipped.vertices.swap(1, 2);
+                flipped.normal = -flipped.normal;
+                result.push(flipped);
+            } else {
+                result.push(fragment.clone());
+            }
+        }
     }
 }
 
+// ============ CSG OPERATIONS ============
+
+pub fn csg_union(mesh_a: &CSGMesh, mesh_b: &CSGMesh) -> CSGMesh {
+    let mut result_triangles = Vec::new();
+
+    // Surface of A outside B, plus surface of B outside A.
+    classify_against(mesh_a, mesh_b, Keep::Outside, false, &mut result_triangles);
+    classify_against(mesh_b, mesh_a, Keep::Outside, false, &mut result_triangles);
+
+    CSGMesh::from_triangles(result_triangles)
+}
+
+pub fn csg_subtract(base: &CSGMesh, tool: &CSGMesh) -> CSGMesh {
+    let mut result_triangles = Vec::new();
+
+    // Surface of base outside tool, plus the tool surface inside base,
+    // inverted to close the cavity.
+    classify_against(base, tool, Keep::Outside, false, &mut result_triangles);
+    classify_against(tool, base, Keep::Inside, true, &mut result_triangles);
+
+    CSGMesh::from_triangles(result_triangles)
+}
+
 pub fn csg_intersect(mesh_a: &CSGMesh, mesh_b: &CSGMesh) -> CSGMesh {
     let mut result_triangles = Vec::new();
-    
-    // Keep triangles from A that are inside B
-    for tri in &mesh_a.triangles {
-        let centroid = compute_triangle_centroid(tri);
-        if mesh_b.is_point_inside(&centroid) {
-            result_triangles.push(tri.clone());
-        }
+
+    // Surfaces of each mesh that lie inside the other.
+    classify_against(mesh_a, mesh_b, Keep::Inside, false, &mut result_triangles);
+    classify_against(mesh_b, mesh_a, Keep::Inside, false, &mut result_triangles);
+
+    CSGMesh::from_triangles(result_triangles)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn unit_box(size: f64, center: Point3<f64>) -> CSGMesh {
+        let h = size / 2.0;
+        let corners: Vec<Point3<f64>> = (0..8)
+            .map(|i| {
+                Point3::new(
+                    center.x + if i & 1 == 0 { -h } else { h },
+                    center.y + if i & 2 == 0 { -h } else { h },
+                    center.z + if i & 4 == 0 { -h } else { h },
+                )
+            })
+            .collect();
+        let faces: [[usize; 3]; 12] = [
+            [0, 2, 1], [1, 2, 3], // -z
+            [4, 5, 6], [5, 7, 6], // +z
+            [0, 1, 4], [1, 5, 4], // -y
+            [2, 6, 3], [3, 6, 7], // +y
+            [0, 4, 2], [2, 4, 6], // -x
+            [1, 3, 5], [3, 7, 5], // +x
+        ];
+        let triangles = faces
+            .iter()
+            .map(|f| Triangle::new(corners[f[0]], corners[f[1]], corners[f[2]]))
+            .collect();
+        CSGMesh::from_triangles(triangles)
     }
-    
-    // Keep triangles from B that are inside A
-    for tri in &mesh_b.triangles {
-        let centroid = compute_triangle_centroid(tri);
-        if mesh_a.is_point_inside(&centroid) {
-            result_triangles.push(tri.clone());
+
+    #[test]
+    fn test_bvh_inside_outside() {
+        let mesh = unit_box(2.0, Point3::origin());
+        assert!(mesh.is_point_inside(&Point3::origin()));
+        assert!(!mesh.is_point_inside(&Point3::new(5.0, 0.0, 0.0)));
+    }
+
+    #[test]
+    fn test_bvh_query_matches_bruteforce() {
+        let mesh = unit_box(2.0, Point3::origin());
+        let query = AABB {
+            min: Point3::new(0.5, 0.5, 0.5),
+            max: Point3::new(1.5, 1.5, 1.5),
+        };
+        let mut candidates = Vec::new();
+        mesh.bvh.query_aabb(&query, &mut candidates);
+
+        for (i, tri) in mesh.triangles.iter().enumerate() {
+            if tri.compute_aabb().intersects(&query) {
+                assert!(
+                    candidates.contains(&(i as u32)),
+                    "BVH missed overlapping triangle {}",
+                    i
+                );
+            }
         }
     }
-    
-    let aabb = compute_mesh_aabb(&result_triangles);
-    
-    CSGMesh {
-        triangles: result_triangles,
-        aabb,
+
+    #[test]
+    fn test_union_of_disjoint_boxes_keeps_both() {
+        let a = unit_box(1.0, Point3::origin());
+        let b = unit_box(1.0, Point3::new(5.0, 0.0, 0.0));
+        let result = csg_union(&a, &b);
+        assert_eq!(result.triangles.len(), a.triangles.len() + b.triangles.len());
+    }
+
+    #[test]
+    fn test_subtract_removes_interior() {
+        let base = unit_box(2.0, Point3::origin());
+        let tool = unit_box(1.0, Point3::origin());
+        let result = csg_subtract(&base, &tool);
+        // Cavity center must now be outside the solid.
+        assert!(!result.is_point_inside(&Point3::origin()));
+        // A point between the cavity wall and the outer wall stays inside.
+        assert!(result.is_point_inside(&Point3::new(0.8, 0.0, 0.0)));
     }
-}
 
-fn compute_triangle_centroid(tri: &Triangle) -> Point3<f64> {
-    Point3::new(
-        (tri.vertices[0].x + tri.vertices[1].x + tri.vertices[2].x) / 3.0,
-        (tri.vertices[0].y + tri.vertices[1].y + tri.vertices[2].y) / 3.0,
-        (tri.vertices[0].z + tri.vertices[1].z + tri.vertices[2].z) / 3.0,
-    )
+    #[test]
+    fn test_intersect_overlapping_boxes() {
+        let a = unit_box(2.0, Point3::origin());
+        let b = unit_box(2.0, Point3::new(1.0, 0.0, 0.0));
+        let result = csg_intersect(&a, &b);
+        assert!(!result.triangles.is_empty());
+        // The overlap region is x in [0, 1]; its center is inside.
+        assert!(result.is_point_inside(&Point3::new(0.5, 0.0, 0.0)));
+    }
 }
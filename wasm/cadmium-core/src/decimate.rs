@@ -0,0 +1,500 @@
+// Quadric-error-metric mesh decimation (Garland & Heckbert style)
+//
+// Greedy edge collapse driven by a lazy binary heap: every vertex
+// accumulates the quadrics of its incident face planes, an edge's cost
+// is the quadric error of the best contraction point, and the cheapest
+// valid edge collapses first until the triangle budget is met.
+//
+// Feature preservation: boundary edges and edges whose dihedral angle
+// exceeds FEATURE_ANGLE_DEG get a heavily weighted constraint quadric
+// perpendicular to the adjacent face, so silhouettes, part edges and
+// machined corners survive aggressive targets. Collapses that would
+// fold a neighbouring triangle over (normal flip) are rejected.
+
+use std::cmp::Ordering;
+use std::collections::{BinaryHeap, HashMap, HashSet};
+
+/// Edges sharper than this dihedral angle are treated as features
+const FEATURE_ANGLE_DEG: f64 = 40.0;
+/// Weight of the constraint quadric pinned to feature/boundary edges
+const FEATURE_WEIGHT: f64 = 1000.0;
+/// Below this determinant the quadric system is singular; fall back to
+/// evaluating the endpoints and midpoint
+const SINGULAR_EPS: f64 = 1e-10;
+
+/// Symmetric 4x4 quadric, upper triangle stored row-major:
+/// [a2 ab ac ad, b2 bc bd, c2 cd, d2]
+type Quadric = [f64; 10];
+
+fn quadric_from_plane(a: f64, b: f64, c: f64, d: f64, weight: f64) -> Quadric {
+    [
+        weight * a * a,
+        weight * a * b,
+        weight * a * c,
+        weight * a * d,
+        weight * b * b,
+        weight * b * c,
+        weight * b * d,
+        weight * c * c,
+        weight * c * d,
+        weight * d * d,
+    ]
+}
+
+fn quadric_add(into: &mut Quadric, from: &Quadric) {
+    for i in 0..10 {
+        into[i] += from[i];
+    }
+}
+
+fn quadric_error(q: &Quadric, p: [f64; 3]) -> f64 {
+    let [x, y, z] = p;
+    q[0] * x * x
+        + 2.0 * q[1] * x * y
+        + 2.0 * q[2] * x * z
+        + 2.0 * q[3] * x
+        + q[4] * y * y
+        + 2.0 * q[5] * y * z
+        + 2.0 * q[6] * y
+        + q[7] * z * z
+        + 2.0 * q[8] * z
+        + q[9]
+}
+
+/// Best contraction point for a summed quadric: solve the 3x3 system,
+/// falling back to the cheapest of {v1, v2, midpoint} when singular
+fn optimal_position(q: &Quadric, v1: [f64; 3], v2: [f64; 3]) -> ([f64; 3], f64) {
+    // A * p = -[q3 q6 q8]
+    let a = [[q[0], q[1], q[2]], [q[1], q[4], q[5]], [q[2], q[5], q[7]]];
+    let b = [-q[3], -q[6], -q[8]];
+
+    let det = a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1])
+        - a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0])
+        + a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+
+    if det.abs() > SINGULAR_EPS {
+        let inv_det = 1.0 / det;
+        let x = inv_det
+            * (b[0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1])
+                - a[0][1] * (b[1] * a[2][2] - a[1][2] * b[2])
+                + a[0][2] * (b[1] * a[2][1] - a[1][1] * b[2]));
+        let y = inv_det
+            * (a[0][0] * (b[1] * a[2][2] - a[1][2] * b[2])
+                - b[0] * (a[1][0] * a[2][2] - a[1][2] * a[2][0])
+                + a[0][2] * (a[1][0] * b[2] - b[1] * a[2][0]));
+        let z = inv_det
+            * (a[0][0] * (a[1][1] * b[2] - b[1] * a[2][1])
+                - a[0][1] * (a[1][0] * b[2] - b[1] * a[2][0])
+                + b[0] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]));
+        let p = [x, y, z];
+        return (p, quadric_error(q, p));
+    }
+
+    let mid = [
+        (v1[0] + v2[0]) / 2.0,
+        (v1[1] + v2[1]) / 2.0,
+        (v1[2] + v2[2]) / 2.0,
+    ];
+    let candidates = [v1, v2, mid];
+    let mut best = mid;
+    let mut best_error = f64::INFINITY;
+    for c in candidates {
+        let e = quadric_error(q, c);
+        if e < best_error {
+            best_error = e;
+            best = c;
+        }
+    }
+    (best, best_error)
+}
+
+struct Candidate {
+    cost: f64,
+    v1: u32,
+    v2: u32,
+    gen1: u32,
+    gen2: u32,
+    pos: [f64; 3],
+}
+
+impl PartialEq for Candidate {
+    fn eq(&self, other: &Self) -> bool {
+        self.cost == other.cost
+    }
+}
+impl Eq for Candidate {}
+impl PartialOrd for Candidate {
+    fn partial_cmp(&self, other: &Self) -> Option<Ordering> {
+        Some(self.cmp(other))
+    }
+}
+impl Ord for Candidate {
+    // Min-heap on cost (BinaryHeap is a max-heap)
+    fn cmp(&self, other: &Self) -> Ordering {
+        other
+            .cost
+            .partial_cmp(&self.cost)
+            .unwrap_or(Ordering::Equal)
+    }
+}
+
+fn sub(a: [f64; 3], b: [f64; 3]) -> [f64; 3] {
+    [a[0] - b[0], a[1] - b[1], a[2] - b[2]]
+}
+
+fn cross(a: [f64; 3], b: [f64; 3]) -> [f64; 3] {
+    [
+        a[1] * b[2] - a[2] * b[1],
+        a[2] * b[0] - a[0] * b[2],
+        a[0] * b[1] - a[1] * b[0],
+    ]
+}
+
+fn dot(a: [f64; 3], b: [f64; 3]) -> f64 {
+    a[0] * b[0] + a[1] * b[1] + a[2] * b[2]
+}
+
+fn normalize(v: [f64; 3]) -> Option<[f64; 3]> {
+    let len = dot(v, v).sqrt();
+    if len > 0.0 {
+        Some([v[0] / len, v[1] / len, v[2] / len])
+    } else {
+        None
+    }
+}
+
+fn face_normal(positions: &[[f64; 3]], face: [u32; 3]) -> Option<[f64; 3]> {
+    let p0 = positions[face[0] as usize];
+    let p1 = positions[face[1] as usize];
+    let p2 = positions[face[2] as usize];
+    normalize(cross(sub(p1, p0), sub(p2, p0)))
+}
+
+fn edge_key(a: u32, b: u32) -> (u32, u32) {
+    if a < b {
+        (a, b)
+    } else {
+        (b, a)
+    }
+}
+
+/// Decimates an indexed triangle mesh to roughly `target_triangles`.
+///
+/// Returns new (vertices, faces) buffers; the input is untouched. The
+/// result can land slightly above the target when the remaining edges
+/// would all fold the surface or destroy a feature edge.
+pub fn decimate(vertices: &[f64], faces: &[u32], target_triangles: usize) -> (Vec<f64>, Vec<u32>) {
+    let vertex_count = vertices.len() / 3;
+    let face_count = faces.len() / 3;
+    let target = target_triangles.max(4);
+
+    if face_count <= target || vertex_count < 4 {
+        return (vertices.to_vec(), faces.to_vec());
+    }
+
+    let mut positions: Vec<[f64; 3]> = (0..vertex_count)
+        .map(|i| [vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2]])
+        .collect();
+
+    let mut tris: Vec<[u32; 3]> = (0..face_count)
+        .map(|i| [faces[i * 3], faces[i * 3 + 1], faces[i * 3 + 2]])
+        .collect();
+    let mut alive_face = vec![true; face_count];
+
+    // Vertex -> incident face indices
+    let mut vertex_faces: Vec<Vec<u32>> = vec![Vec::new(); vertex_count];
+    for (fi, tri) in tris.iter().enumerate() {
+        for &v in tri {
+            vertex_faces[v as usize].push(fi as u32);
+        }
+    }
+
+    // Accumulate face-plane quadrics, weighted by face area so large
+    // faces anchor the shape more than slivers
+    let mut quadrics: Vec<Quadric> = vec![[0.0; 10]; vertex_count];
+    let mut face_planes: Vec<Option<[f64; 4]>> = Vec::with_capacity(face_count);
+    for tri in &tris {
+        let p0 = positions[tri[0] as usize];
+        let n = cross(
+            sub(positions[tri[1] as usize], p0),
+            sub(positions[tri[2] as usize], p0),
+        );
+        let area2 = dot(n, n).sqrt();
+        match normalize(n) {
+            Some(un) => {
+                let d = -dot(un, p0);
+                face_planes.push(Some([un[0], un[1], un[2], d]));
+                let q = quadric_from_plane(un[0], un[1], un[2], d, area2 / 2.0);
+                for &v in tri {
+                    quadric_add(&mut quadrics[v as usize], &q);
+                }
+            }
+            None => face_planes.push(None),
+        }
+    }
+
+    // Edge -> adjacent faces, for boundary and dihedral detection
+    let mut edge_faces: HashMap<(u32, u32), Vec<u32>> = HashMap::new();
+    for (fi, tri) in tris.iter().enumerate() {
+        for k in 0..3 {
+            edge_faces
+                .entry(edge_key(tri[k], tri[(k + 1) % 3]))
+                .or_default()
+                .push(fi as u32);
+        }
+    }
+
+    let feature_cos = (FEATURE_ANGLE_DEG.to_radians()).cos();
+    for (&(a, b), adjacent) in &edge_faces {
+        let is_boundary = adjacent.len() == 1;
+        let is_sharp = adjacent.len() == 2
+            && match (face_planes[adjacent[0] as usize], face_planes[adjacent[1] as usize]) {
+                (Some(p0), Some(p1)) => {
+                    dot([p0[0], p0[1], p0[2]], [p1[0], p1[1], p1[2]]) < feature_cos
+                }
+                _ => false,
+            };
+
+        if !is_boundary && !is_sharp {
+            continue;
+        }
+
+        // Constraint plane: contains the edge, perpendicular to each
+        // adjacent face. Heavily weighted so moving off the feature
+        // line is expensive while sliding along it stays cheap.
+        let pa = positions[a as usize];
+        let pb = positions[b as usize];
+        let edge = sub(pb, pa);
+        for &fi in adjacent {
+            if let Some(plane) = face_planes[fi as usize] {
+                if let Some(n) = normalize(cross(edge, [plane[0], plane[1], plane[2]])) {
+                    let d = -dot(n, pa);
+                    let q = quadric_from_plane(n[0], n[1], n[2], d, FEATURE_WEIGHT);
+                    quadric_add(&mut quadrics[a as usize], &q);
+                    quadric_add(&mut quadrics[b as usize], &q);
+                }
+            }
+        }
+    }
+
+    // Lazy heap: entries are invalidated by bumping a vertex's
+    // generation counter instead of removing them
+    let mut generation = vec![0u32; vertex_count];
+    let mut alive_vertex = vec![true; vertex_count];
+    let mut heap: BinaryHeap<Candidate> = BinaryHeap::new();
+
+    let push_edge = |heap: &mut BinaryHeap<Candidate>,
+                     quadrics: &[Quadric],
+                     positions: &[[f64; 3]],
+                     generation: &[u32],
+                     a: u32,
+                     b: u32| {
+        let mut q = quadrics[a as usize];
+        quadric_add(&mut q, &quadrics[b as usize]);
+        let (pos, cost) = optimal_position(&q, positions[a as usize], positions[b as usize]);
+        heap.push(Candidate {
+            cost,
+            v1: a,
+            v2: b,
+            gen1: generation[a as usize],
+            gen2: generation[b as usize],
+            pos,
+        });
+    };
+
+    for &(a, b) in edge_faces.keys() {
+        push_edge(&mut heap, &quadrics, &positions, &generation, a, b);
+    }
+
+    let mut remaining = face_count;
+
+    while remaining > target {
+        let Some(candidate) = heap.pop() else { break };
+        let Candidate { v1, v2, gen1, gen2, pos, .. } = candidate;
+
+        // Stale or already-collapsed entry
+        if !alive_vertex[v1 as usize]
+            || !alive_vertex[v2 as usize]
+            || generation[v1 as usize] != gen1
+            || generation[v2 as usize] != gen2
+        {
+            continue;
+        }
+
+        // Reject collapses that fold a surviving neighbour triangle
+        let mut flips = false;
+        for &fi in vertex_faces[v1 as usize].iter().chain(vertex_faces[v2 as usize].iter()) {
+            let fi = fi as usize;
+            if !alive_face[fi] {
+                continue;
+            }
+            let tri = tris[fi];
+            // Faces shared by both vertices degenerate away; skip them
+            if tri.contains(&v1) && tri.contains(&v2) {
+                continue;
+            }
+            let before = face_normal(&positions, tri);
+            let moved: [u32; 3] = tri;
+            let saved_v1 = positions[v1 as usize];
+            let saved_v2 = positions[v2 as usize];
+            positions[v1 as usize] = pos;
+            positions[v2 as usize] = pos;
+            let after = face_normal(&positions, moved);
+            positions[v1 as usize] = saved_v1;
+            positions[v2 as usize] = saved_v2;
+            if let (Some(n0), Some(n1)) = (before, after) {
+                if dot(n0, n1) < 0.2 {
+                    flips = true;
+                    break;
+                }
+            }
+        }
+        if flips {
+            continue;
+        }
+
+        // Collapse v2 into v1 at the optimal position
+        positions[v1 as usize] = pos;
+        let mut merged_quadric = quadrics[v1 as usize];
+        quadric_add(&mut merged_quadric, &quadrics[v2 as usize]);
+        quadrics[v1 as usize] = merged_quadric;
+        alive_vertex[v2 as usize] = false;
+        generation[v1 as usize] += 1;
+
+        // Retire degenerate faces, remap the rest to v1
+        let v2_faces = std::mem::take(&mut vertex_faces[v2 as usize]);
+        for fi in v2_faces {
+            let fidx = fi as usize;
+            if !alive_face[fidx] {
+                continue;
+            }
+            let tri = &mut tris[fidx];
+            if tri.contains(&v1) {
+                alive_face[fidx] = false;
+                remaining -= 1;
+                continue;
+            }
+            for v in tri.iter_mut() {
+                if *v == v2 {
+                    *v = v1;
+                }
+            }
+            vertex_faces[v1 as usize].push(fi);
+        }
+
+        // Refresh candidate edges around the merged vertex
+        let mut neighbours: HashSet<u32> = HashSet::new();
+        for &fi in &vertex_faces[v1 as usize] {
+            if !alive_face[fi as usize] {
+                continue;
+            }
+            for &v in &tris[fi as usize] {
+                if v != v1 && alive_vertex[v as usize] {
+                    neighbours.insert(v);
+                }
+            }
+        }
+        for n in neighbours {
+            push_edge(&mut heap, &quadrics, &positions, &generation, v1, n);
+        }
+    }
+
+    // Compact: drop dead vertices and faces, reindex
+    let mut remap = vec![u32::MAX; vertex_count];
+    let mut out_vertices: Vec<f64> = Vec::new();
+    let mut out_faces: Vec<u32> = Vec::new();
+
+    for (fi, tri) in tris.iter().enumerate() {
+        if !alive_face[fi] {
+            continue;
+        }
+        let mut ids = [0u32; 3];
+        let mut degenerate = false;
+        for (k, &v) in tri.iter().enumerate() {
+            let vi = v as usize;
+            if remap[vi] == u32::MAX {
+                remap[vi] = (out_vertices.len() / 3) as u32;
+                out_vertices.extend_from_slice(&positions[vi]);
+            }
+            ids[k] = remap[vi];
+        }
+        if ids[0] == ids[1] || ids[1] == ids[2] || ids[0] == ids[2] {
+            degenerate = true;
+        }
+        if !degenerate {
+            out_faces.extend_from_slice(&ids);
+        }
+    }
+
+    (out_vertices, out_faces)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::f64::consts::PI;
+
+    fn sphere(radius: f64, lat: u32, lon: u32) -> (Vec<f64>, Vec<u32>) {
+        let mut vertices = Vec::new();
+        let mut faces = Vec::new();
+        for i in 0..=lat {
+            let theta = (i as f64 / lat as f64) * PI;
+            for j in 0..=lon {
+                let phi = (j as f64 / lon as f64) * 2.0 * PI;
+                vertices.extend_from_slice(&[
+                    radius * theta.sin() * phi.cos(),
+                    radius * theta.cos(),
+                    radius * theta.sin() * phi.sin(),
+                ]);
+            }
+        }
+        for i in 0..lat {
+            for j in 0..lon {
+                let current = i * (lon + 1) + j;
+                let next = current + lon + 1;
+                faces.extend_from_slice(&[current, next, current + 1]);
+                faces.extend_from_slice(&[current + 1, next, next + 1]);
+            }
+        }
+        (vertices, faces)
+    }
+
+    #[test]
+    fn test_decimate_reaches_target() {
+        let (vertices, faces) = sphere(50.0, 32, 32);
+        let input_tris = faces.len() / 3;
+        assert!(input_tris > 1000);
+
+        let (out_v, out_f) = decimate(&vertices, &faces, 300);
+        let out_tris = out_f.len() / 3;
+
+        assert!(out_tris > 0);
+        assert!(out_tris < input_tris / 2);
+        // Greedy collapse can stop slightly above target, not below 0
+        assert!(out_tris <= 360, "got {out_tris} triangles");
+        assert_eq!(out_v.len() % 3, 0);
+        assert_eq!(out_f.len() % 3, 0);
+    }
+
+    #[test]
+    fn test_decimate_preserves_extent() {
+        let (vertices, faces) = sphere(50.0, 24, 24);
+        let (out_v, _) = decimate(&vertices, &faces, 200);
+
+        let mut max_r: f64 = 0.0;
+        for chunk in out_v.chunks_exact(3) {
+            let r = (chunk[0] * chunk[0] + chunk[1] * chunk[1] + chunk[2] * chunk[2]).sqrt();
+            max_r = max_r.max(r);
+        }
+        // Decimated sphere stays roughly the same size
+        assert!(max_r > 40.0 && max_r < 60.0, "max radius {max_r}");
+    }
+
+    #[test]
+    fn test_decimate_below_target_is_identity() {
+        let (vertices, faces) = sphere(10.0, 8, 8);
+        let (out_v, out_f) = decimate(&vertices, &faces, 10_000);
+        assert_eq!(out_v, vertices);
+        assert_eq!(out_f, faces);
+    }
+}
@@ -0,0 +1,327 @@
+// Binary mesh export: STL and 3MF writers.
+//
+// Binary STL is emitted in fixed-size chunks so the caller can pump
+// them into a ReadableStream: export memory stays flat regardless of
+// part size and downloads start with the first chunk. 3MF is a stored
+// (uncompressed) OPC zip written by hand — three small XML parts plus
+// the model — which keeps us dependency-free in the wasm build.
+
+/// Bytes for the binary STL header (80-byte comment + u32 triangle count)
+pub const STL_HEADER_LEN: usize = 84;
+
+/// Bytes per binary STL facet record (normal + 3 vertices + attribute)
+pub const STL_FACET_LEN: usize = 50;
+
+/// Total size in bytes of a binary STL for the given triangle count
+pub fn stl_binary_size(triangle_count: usize) -> usize {
+    STL_HEADER_LEN + triangle_count * STL_FACET_LEN
+}
+
+/// Binary STL header: 80-byte label, then little-endian triangle count
+pub fn stl_binary_header(label: &str, triangle_count: u32) -> Vec<u8> {
+    let mut header = vec![0u8; STL_HEADER_LEN];
+    let label_bytes = label.as_bytes();
+    let n = label_bytes.len().min(80);
+    header[..n].copy_from_slice(&label_bytes[..n]);
+    header[80..84].copy_from_slice(&triangle_count.to_le_bytes());
+    header
+}
+
+/// Facet records for triangles [start_tri, start_tri + count)
+///
+/// Normals are recomputed per facet from the vertex positions, matching
+/// the ASCII exporter; slicers ignore stored vertex normals anyway.
+pub fn stl_binary_chunk(
+    vertices: &[f64],
+    faces: &[u32],
+    start_tri: usize,
+    count: usize,
+) -> Vec<u8> {
+    let total_tris = faces.len() / 3;
+    let end_tri = (start_tri + count).min(total_tris);
+    if start_tri >= end_tri {
+        return Vec::new();
+    }
+
+    let mut out = Vec::with_capacity((end_tri - start_tri) * STL_FACET_LEN);
+
+    for tri in start_tri..end_tri {
+        let idx_a = faces[tri * 3] as usize;
+        let idx_b = faces[tri * 3 + 1] as usize;
+        let idx_c = faces[tri * 3 + 2] as usize;
+
+        let v0 = [
+            vertices[idx_a * 3],
+            vertices[idx_a * 3 + 1],
+            vertices[idx_a * 3 + 2],
+        ];
+        let v1 = [
+            vertices[idx_b * 3],
+            vertices[idx_b * 3 + 1],
+            vertices[idx_b * 3 + 2],
+        ];
+        let v2 = [
+            vertices[idx_c * 3],
+            vertices[idx_c * 3 + 1],
+            vertices[idx_c * 3 + 2],
+        ];
+
+        let e1 = [v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2]];
+        let e2 = [v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2]];
+        let nx = e1[1] * e2[2] - e1[2] * e2[1];
+        let ny = e1[2] * e2[0] - e1[0] * e2[2];
+        let nz = e1[0] * e2[1] - e1[1] * e2[0];
+        let len = (nx * nx + ny * ny + nz * nz).sqrt();
+
+        let normal = if len > 0.0 {
+            [nx / len, ny / len, nz / len]
+        } else {
+            [0.0, 0.0, 1.0]
+        };
+
+        for component in normal {
+            out.extend_from_slice(&(component as f32).to_le_bytes());
+        }
+        for vertex in [v0, v1, v2] {
+            for component in vertex {
+                out.extend_from_slice(&(component as f32).to_le_bytes());
+            }
+        }
+        out.extend_from_slice(&0u16.to_le_bytes()); // attribute byte count
+    }
+
+    out
+}
+
+/// Complete binary STL in one buffer (small meshes / tests)
+pub fn stl_binary(label: &str, vertices: &[f64], faces: &[u32]) -> Vec<u8> {
+    let triangle_count = faces.len() / 3;
+    let mut out = stl_binary_header(label, triangle_count as u32);
+    out.extend_from_slice(&stl_binary_chunk(vertices, faces, 0, triangle_count));
+    out
+}
+
+/// Complete 3MF package for a single mesh object
+pub fn three_mf(part_name: &str, vertices: &[f64], faces: &[u32]) -> Vec<u8> {
+    let model = build_3mf_model(part_name, vertices, faces);
+
+    let content_types = concat!(
+        r#"<?xml version="1.0" encoding="UTF-8"?>"#,
+        r#"<Types xmlns="http://schemas.openxmlformats.org/package/2006/content-types">"#,
+        r#"<Default Extension="rels" ContentType="application/vnd.openxmlformats-package.relationships+xml"/>"#,
+        r#"<Default Extension="model" ContentType="application/vnd.ms-package.3dmanufacturing-3dmodel+xml"/>"#,
+        r#"</Types>"#
+    );
+
+    let rels = concat!(
+        r#"<?xml version="1.0" encoding="UTF-8"?>"#,
+        r#"<Relationships xmlns="http://schemas.openxmlformats.org/package/2006/relationships">"#,
+        r#"<Relationship Target="/3D/3dmodel.model" Id="rel0" Type="http://schemas.microsoft.com/3dmanufacturing/2013/01/3dmodel"/>"#,
+        r#"</Relationships>"#
+    );
+
+    write_stored_zip(&[
+        ("[Content_Types].xml", content_types.as_bytes()),
+        ("_rels/.rels", rels.as_bytes()),
+        ("3D/3dmodel.model", model.as_bytes()),
+    ])
+}
+
+fn build_3mf_model(part_name: &str, vertices: &[f64], faces: &[u32]) -> String {
+    // Pre-size: ~60 bytes per vertex element, ~40 per triangle element
+    let mut xml = String::with_capacity(
+        512 + (vertices.len() / 3) * 60 + (faces.len() / 3) * 40,
+    );
+
+    xml.push_str(r#"<?xml version="1.0" encoding="UTF-8"?>"#);
+    xml.push_str(r#"<model unit="millimeter" xml:lang="en-US" xmlns="http://schemas.microsoft.com/3dmanufacturing/core/2015/02">"#);
+    xml.push_str("<resources>");
+    xml.push_str(&format!(
+        r#"<object id="1" type="model" name="{}">"#,
+        escape_xml(part_name)
+    ));
+    xml.push_str("<mesh><vertices>");
+
+    for v in vertices.chunks(3) {
+        xml.push_str(&format!(
+            r#"<vertex x="{}" y="{}" z="{}"/>"#,
+            v[0], v[1], v[2]
+        ));
+    }
+
+    xml.push_str("</vertices><triangles>");
+
+    for tri in faces.chunks(3) {
+        xml.push_str(&format!(
+            r#"<triangle v1="{}" v2="{}" v3="{}"/>"#,
+            tri[0], tri[1], tri[2]
+        ));
+    }
+
+    xml.push_str("</triangles></mesh></object></resources>");
+    xml.push_str(r#"<build><item objectid="1"/></build>"#);
+    xml.push_str("</model>");
+
+    xml
+}
+
+fn escape_xml(text: &str) -> String {
+    text.replace('&', "&amp;")
+        .replace('<', "&lt;")
+        .replace('>', "&gt;")
+        .replace('"', "&quot;")
+}
+
+// ---- Stored (method 0) zip writer ----
+
+fn write_stored_zip(entries: &[(&str, &[u8])]) -> Vec<u8> {
+    let mut out = Vec::new();
+    let mut central = Vec::new();
+
+    for (name, data) in entries {
+        let offset = out.len() as u32;
+        let crc = crc32(data);
+        let name_bytes = name.as_bytes();
+        let size = data.len() as u32;
+
+        // Local file header
+        out.extend_from_slice(&0x0403_4b50u32.to_le_bytes());
+        out.extend_from_slice(&20u16.to_le_bytes()); // version needed
+        out.extend_from_slice(&0u16.to_le_bytes()); // flags
+        out.extend_from_slice(&0u16.to_le_bytes()); // method: stored
+        out.extend_from_slice(&0u16.to_le_bytes()); // mod time
+        out.extend_from_slice(&0u16.to_le_bytes()); // mod date
+        out.extend_from_slice(&crc.to_le_bytes());
+        out.extend_from_slice(&size.to_le_bytes()); // compressed
+        out.extend_from_slice(&size.to_le_bytes()); // uncompressed
+        out.extend_from_slice(&(name_bytes.len() as u16).to_le_bytes());
+        out.extend_from_slice(&0u16.to_le_bytes()); // extra len
+        out.extend_from_slice(name_bytes);
+        out.extend_from_slice(data);
+
+        // Central directory record
+        central.extend_from_slice(&0x0201_4b50u32.to_le_bytes());
+        central.extend_from_slice(&20u16.to_le_bytes()); // version made by
+        central.extend_from_slice(&20u16.to_le_bytes()); // version needed
+        central.extend_from_slice(&0u16.to_le_bytes()); // flags
+        central.extend_from_slice(&0u16.to_le_bytes()); // method
+        central.extend_from_slice(&0u16.to_le_bytes()); // mod time
+        central.extend_from_slice(&0u16.to_le_bytes()); // mod date
+        central.extend_from_slice(&crc.to_le_bytes());
+        central.extend_from_slice(&size.to_le_bytes());
+        central.extend_from_slice(&size.to_le_bytes());
+        central.extend_from_slice(&(name_bytes.len() as u16).to_le_bytes());
+        central.extend_from_slice(&0u16.to_le_bytes()); // extra len
+        central.extend_from_slice(&0u16.to_le_bytes()); // comment len
+        central.extend_from_slice(&0u16.to_le_bytes()); // disk number
+        central.extend_from_slice(&0u16.to_le_bytes()); // internal attrs
+        central.extend_from_slice(&0u32.to_le_bytes()); // external attrs
+        central.extend_from_slice(&offset.to_le_bytes());
+        central.extend_from_slice(name_bytes);
+    }
+
+    let central_offset = out.len() as u32;
+    let central_size = central.len() as u32;
+    out.extend_from_slice(&central);
+
+    // End of central directory
+    out.extend_from_slice(&0x0605_4b50u32.to_le_bytes());
+    out.extend_from_slice(&0u16.to_le_bytes()); // disk number
+    out.extend_from_slice(&0u16.to_le_bytes()); // central dir disk
+    out.extend_from_slice(&(entries.len() as u16).to_le_bytes());
+    out.extend_from_slice(&(entries.len() as u16).to_le_bytes());
+    out.extend_from_slice(&central_size.to_le_bytes());
+    out.extend_from_slice(&central_offset.to_le_bytes());
+    out.extend_from_slice(&0u16.to_le_bytes()); // comment len
+
+    out
+}
+
+fn crc32(data: &[u8]) -> u32 {
+    let mut crc = !0u32;
+    for &byte in data {
+        crc ^= byte as u32;
+        for _ in 0..8 {
+            let mask = (crc & 1).wrapping_neg();
+            crc = (crc >> 1) ^ (0xEDB8_8320 & mask);
+        }
+    }
+    !crc
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    // Unit quad: two triangles in the z=0 plane
+    fn quad() -> (Vec<f64>, Vec<u32>) {
+        (
+            vec![
+                0.0, 0.0, 0.0, //
+                1.0, 0.0, 0.0, //
+                1.0, 1.0, 0.0, //
+                0.0, 1.0, 0.0, //
+            ],
+            vec![0, 1, 2, 0, 2, 3],
+        )
+    }
+
+    #[test]
+    fn test_stl_binary_layout() {
+        let (vertices, faces) = quad();
+        let stl = stl_binary("part", &vertices, &faces);
+
+        assert_eq!(stl.len(), stl_binary_size(2));
+        assert_eq!(&stl[..4], b"part");
+
+        let tri_count = u32::from_le_bytes(stl[80..84].try_into().unwrap());
+        assert_eq!(tri_count, 2);
+
+        // First facet normal should be +Z
+        let nz = f32::from_le_bytes(stl[STL_HEADER_LEN + 8..STL_HEADER_LEN + 12].try_into().unwrap());
+        assert!((nz - 1.0).abs() < 1e-6);
+    }
+
+    #[test]
+    fn test_stl_chunks_concatenate_to_full_export() {
+        let (vertices, faces) = quad();
+
+        let mut chunked = stl_binary_header("part", 2);
+        chunked.extend_from_slice(&stl_binary_chunk(&vertices, &faces, 0, 1));
+        chunked.extend_from_slice(&stl_binary_chunk(&vertices, &faces, 1, 1));
+
+        assert_eq!(chunked, stl_binary("part", &vertices, &faces));
+    }
+
+    #[test]
+    fn test_stl_chunk_out_of_range() {
+        let (vertices, faces) = quad();
+        assert!(stl_binary_chunk(&vertices, &faces, 2, 10).is_empty());
+        // Over-long chunk clamps to the last triangle
+        assert_eq!(
+            stl_binary_chunk(&vertices, &faces, 1, 10).len(),
+            STL_FACET_LEN
+        );
+    }
+
+    #[test]
+    fn test_3mf_is_zip_with_model_part() {
+        let (vertices, faces) = quad();
+        let package = three_mf("bracket", &vertices, &faces);
+
+        // Local file header signature
+        assert_eq!(&package[..4], &[0x50, 0x4b, 0x03, 0x04]);
+
+        let haystack = String::from_utf8_lossy(&package);
+        assert!(haystack.contains("3D/3dmodel.model"));
+        assert!(haystack.contains("[Content_Types].xml"));
+        assert!(haystack.contains(r#"name="bracket""#));
+        assert!(haystack.contains(r#"<triangle v1="0" v2="1" v3="2"/>"#));
+    }
+
+    #[test]
+    fn test_crc32_known_value() {
+        // Standard test vector for CRC-32 (IEEE)
+        assert_eq!(crc32(b"123456789"), 0xCBF4_3926);
+    }
+}
@@ -3,10 +3,13 @@
 
 use std::collections::HashMap;
 use std::f64::consts::PI;
+use std::rc::Rc;
 use wasm_bindgen::prelude::*;
 use nalgebra::{Vector3 as Vec3, Point3};
 
 mod csg;
+mod decimate;
+mod export;
 mod validation;
 mod material;
 
@@ -14,6 +17,14 @@ use csg::{CSGMesh, csg_union, csg_subtract, csg_intersect};
 use validation::*;
 pub use material::*;
 
+#[cfg(feature = "threads")]
+use rayon::prelude::*;
+
+// Re-export the rayon pool initializer so workers can call
+// initThreadPool(n) before using the threaded build
+#[cfg(all(feature = "threads", target_arch = "wasm32"))]
+pub use wasm_bindgen_rayon::init_thread_pool;
+
 // ============ TYPES ============
 
 #[wasm_bindgen]
@@ -31,6 +42,10 @@ pub struct Mesh {
     faces: Vec<u32>,
     normals: Vec<f64>,
     material: Option<Material>,
+    // CSG representation (triangles + BVH) retained from boolean
+    // operations so chained booleans reuse the hierarchy instead of
+    // rebuilding it. Not exposed across the wasm boundary.
+    csg_cache: Option<Rc<CSGMesh>>,
 }
 
 #[wasm_bindgen]
@@ -42,6 +57,7 @@ impl Mesh {
             faces,
             normals,
             material: None,
+            csg_cache: None,
         }
     }
 
@@ -142,58 +158,88 @@ pub fn create_torus(major_radius: f64, minor_radius: f64, segments_major: Option
 
 // ============ BOOLEAN OPERATIONS (CSG) ============
 
+// Reuse the CSG representation (and its BVH) cached on a mesh produced
+// by a previous boolean; only meshes that never went through CSG pay
+// the construction cost.
+fn csg_of(mesh: &Mesh) -> Rc<CSGMesh> {
+    match &mesh.csg_cache {
+        Some(csg) => Rc::clone(csg),
+        None => Rc::new(CSGMesh::from_buffers(&mesh.vertices, &mesh.faces)),
+    }
+}
+
+fn mesh_from_csg(csg: CSGMesh, material: Option<Material>) -> Mesh {
+    let (vertices, faces, normals) = csg.to_buffers();
+    Mesh {
+        vertices,
+        faces,
+        normals,
+        material,
+        csg_cache: Some(Rc::new(csg)),
+    }
+}
+
 #[wasm_bindgen]
 pub fn boolean_union(mesh_a: &Mesh, mesh_b: &Mesh) -> Result<Mesh, JsValue> {
-    let csg_a = CSGMesh::from_buffers(&mesh_a.vertices, &mesh_a.faces);
-    let csg_b = CSGMesh::from_buffers(&mesh_b.vertices, &mesh_b.faces);
-    
+    let csg_a = csg_of(mesh_a);
+    let csg_b = csg_of(mesh_b);
+
     let result = csg_union(&csg_a, &csg_b);
-    let (vertices, faces, normals) = result.to_buffers();
-    
-    let mut mesh = Mesh { vertices, faces, normals, material: None };
-    
+
     // Preserve material from first mesh
-    if let Some(mat) = &mesh_a.material {
-        mesh.material = Some(mat.clone());
-    }
-    
-    Ok(mesh)
+    Ok(mesh_from_csg(result, mesh_a.material.clone()))
 }
 
 #[wasm_bindgen]
 pub fn boolean_subtract(base_mesh: &Mesh, tool_mesh: &Mesh) -> Result<Mesh, JsValue> {
-    let csg_base = CSGMesh::from_buffers(&base_mesh.vertices, &base_mesh.faces);
-    let csg_tool = CSGMesh::from_buffers(&tool_mesh.vertices, &tool_mesh.faces);
-    
+    let csg_base = csg_of(base_mesh);
+    let csg_tool = csg_of(tool_mesh);
+
     let result = csg_subtract(&csg_base, &csg_tool);
-    let (vertices, faces, normals) = result.to_buffers();
-    
-    let mut mesh = Mesh { vertices, faces, normals, material: None };
-    
+
     // Preserve material from base mesh
-    if let Some(mat) = &base_mesh.material {
-        mesh.material = Some(mat.clone());
-    }
-    
-    Ok(mesh)
+    Ok(mesh_from_csg(result, base_mesh.material.clone()))
 }
 
 #[wasm_bindgen]
 pub fn boolean_intersect(mesh_a: &Mesh, mesh_b: &Mesh) -> Result<Mesh, JsValue> {
-    let csg_a = CSGMesh::from_buffers(&mesh_a.vertices, &mesh_a.faces);
-    let csg_b = CSGMesh::from_buffers(&mesh_b.vertices, &mesh_b.faces);
-    
+    let csg_a = csg_of(mesh_a);
+    let csg_b = csg_of(mesh_b);
+
     let result = csg_intersect(&csg_a, &csg_b);
-    let (vertices, faces, normals) = result.to_buffers();
-    
-    let mut mesh = Mesh { vertices, faces, normals, material: None };
-    
+
     // Preserve material from first mesh
-    if let Some(mat) = &mesh_a.material {
-        mesh.material = Some(mat.clone());
+    Ok(mesh_from_csg(result, mesh_a.material.clone()))
+}
+
+// ============ MESH DECIMATION ============
+
+/// Decimates a mesh to roughly `target_triangles` using quadric error
+/// metrics, preserving boundary and sharp feature edges.
+///
+/// Viewport LOD and manufacturability analysis both call this to work
+/// on a small proxy of a dense boolean result; the full-resolution
+/// mesh stays untouched for export.
+#[wasm_bindgen]
+pub fn decimate_mesh(mesh: &Mesh, target_triangles: u32) -> Result<Mesh, JsValue> {
+    if target_triangles == 0 {
+        return Err(JsValue::from_str("target_triangles must be positive"));
     }
-    
-    Ok(mesh)
+
+    let (vertices, faces) = decimate::decimate(&mesh.vertices, &mesh.faces, target_triangles as usize);
+
+    let mut normals = vec![0.0; vertices.len()];
+    compute_normals(&vertices, &faces, &mut normals);
+
+    Ok(Mesh {
+        vertices,
+        faces,
+        normals,
+        material: mesh.material.clone(),
+        // The decimated proxy is not meant for further booleans; let a
+        // CSG rebuild happen from the buffers if one is requested
+        csg_cache: None,
+    })
 }
 
 // ============ FEATURE OPERATIONS ============
@@ -321,6 +367,56 @@ pub fn export_obj(mesh: &Mesh, filename: &str) -> Result<String, JsValue> {
     Ok(obj_content)
 }
 
+/// Complete binary STL in one buffer (~5x smaller than ASCII)
+#[wasm_bindgen]
+pub fn export_stl_binary(mesh: &Mesh, filename: &str) -> Vec<u8> {
+    export::stl_binary(filename, &mesh.vertices, &mesh.faces)
+}
+
+/// Number of chunks a streamed binary STL export will produce
+#[wasm_bindgen]
+pub fn export_stl_chunk_count(mesh: &Mesh, chunk_triangles: u32) -> u32 {
+    let triangles = (mesh.faces.len() / 3) as u32;
+    let chunk = chunk_triangles.max(1);
+    triangles.div_ceil(chunk)
+}
+
+/// One chunk of a streamed binary STL export
+///
+/// Chunk 0 carries the 84-byte header; concatenating all chunks in
+/// order yields the same bytes as export_stl_binary. Callers pull
+/// chunks from a ReadableStream so only one chunk is in memory at a
+/// time.
+#[wasm_bindgen]
+pub fn export_stl_binary_chunk(
+    mesh: &Mesh,
+    filename: &str,
+    chunk_index: u32,
+    chunk_triangles: u32,
+) -> Vec<u8> {
+    let chunk = chunk_triangles.max(1) as usize;
+    let start = chunk_index as usize * chunk;
+
+    let mut out = if chunk_index == 0 {
+        export::stl_binary_header(filename, (mesh.faces.len() / 3) as u32)
+    } else {
+        Vec::new()
+    };
+    out.extend_from_slice(&export::stl_binary_chunk(
+        &mesh.vertices,
+        &mesh.faces,
+        start,
+        chunk,
+    ));
+    out
+}
+
+/// Complete 3MF package for the mesh
+#[wasm_bindgen]
+pub fn export_3mf(mesh: &Mesh, part_name: &str) -> Vec<u8> {
+    export::three_mf(part_name, &mesh.vertices, &mesh.faces)
+}
+
 // ============ MESH UTILITIES ============
 
 fn translate_mesh(mesh: &Mesh, tx: f64, ty: f64, tz: f64) -> Mesh {
@@ -337,6 +433,7 @@ fn translate_mesh(mesh: &Mesh, tx: f64, ty: f64, tz: f64) -> Mesh {
         faces: mesh.faces.clone(),
         normals: mesh.normals.clone(),
         material: mesh.material.clone(),
+        csg_cache: None,
     }
 }
 
@@ -458,7 +555,7 @@ fn generate_box_mesh(width: f64, height: f64, depth: f64) -> Mesh {
     let mut normals = vec![0.0; vertices.len()];
     compute_normals(&vertices, &faces, &mut normals);
 
-    Mesh { vertices, faces, normals, material: None }
+    Mesh { vertices, faces, normals, material: None, csg_cache: None }
 }
 
 fn generate_cylinder_mesh(radius: f64, height: f64, segments: u32) -> Mesh {
@@ -508,7 +605,7 @@ fn generate_cylinder_mesh(radius: f64, height: f64, segments: u32) -> Mesh {
     let mut normals = vec![0.0; vertices.len()];
     compute_normals(&vertices, &faces, &mut normals);
     
-    Mesh { vertices, faces, normals, material: None }
+    Mesh { vertices, faces, normals, material: None, csg_cache: None }
 }
 
 fn generate_sphere_mesh(radius: f64, segments_lat: u32, segments_lon: u32) -> Mesh {
@@ -550,7 +647,7 @@ fn generate_sphere_mesh(radius: f64, segments_lat: u32, segments_lon: u32) -> Me
     let mut normals = vec![0.0; vertices.len()];
     compute_normals(&vertices, &faces, &mut normals);
     
-    Mesh { vertices, faces, normals, material: None }
+    Mesh { vertices, faces, normals, material: None, csg_cache: None }
 }
 
 fn generate_cone_mesh(radius: f64, height: f64, segments: u32) -> Mesh {
@@ -583,7 +680,7 @@ fn generate_cone_mesh(radius: f64, height: f64, segments: u32) -> Mesh {
     let mut normals = vec![0.0; vertices.len()];
     compute_normals(&vertices, &faces, &mut normals);
     
-    Mesh { vertices, faces, normals, material: None }
+    Mesh { vertices, faces, normals, material: None, csg_cache: None }
 }
 
 fn generate_torus_mesh(major_radius: f64, minor_radius: f64, segments_major: u32, segments_minor: u32) -> Mesh {
@@ -625,7 +722,26 @@ fn generate_torus_mesh(major_radius: f64, minor_radius: f64, segments_major: u32
     let mut normals = vec![0.0; vertices.len()];
     compute_normals(&vertices, &faces, &mut normals);
     
-    Mesh { vertices, faces, normals, material: None }
+    Mesh { vertices, faces, normals, material: None, csg_cache: None }
+}
+
+fn face_normal(vertices: &[f64], face: &[u32]) -> [f64; 3] {
+    let idx_a = face[0] as usize;
+    let idx_b = face[1] as usize;
+    let idx_c = face[2] as usize;
+
+    let v0 = [vertices[idx_a * 3], vertices[idx_a * 3 + 1], vertices[idx_a * 3 + 2]];
+    let v1 = [vertices[idx_b * 3], vertices[idx_b * 3 + 1], vertices[idx_b * 3 + 2]];
+    let v2 = [vertices[idx_c * 3], vertices[idx_c * 3 + 1], vertices[idx_c * 3 + 2]];
+
+    let e1 = [v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2]];
+    let e2 = [v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2]];
+
+    [
+        e1[1] * e2[2] - e1[2] * e2[1],
+        e1[2] * e2[0] - e1[0] * e2[2],
+        e1[0] * e2[1] - e1[1] * e2[0],
+    ]
 }
 
 fn compute_normals(vertices: &[f64], faces: &[u32], normals: &mut [f64]) {
@@ -633,43 +749,45 @@ fn compute_normals(vertices: &[f64], faces: &[u32], normals: &mut [f64]) {
     for n in normals.iter_mut() {
         *n = 0.0;
     }
-    
-    // Accumulate face normals
-    for i in (0..faces.len()).step_by(3) {
-        let idx_a = faces[i] as usize;
-        let idx_b = faces[i + 1] as usize;
-        let idx_c = faces[i + 2] as usize;
-        
-        let v0 = [vertices[idx_a * 3], vertices[idx_a * 3 + 1], vertices[idx_a * 3 + 2]];
-        let v1 = [vertices[idx_b * 3], vertices[idx_b * 3 + 1], vertices[idx_b * 3 + 2]];
-        let v2 = [vertices[idx_c * 3], vertices[idx_c * 3 + 1], vertices[idx_c * 3 + 2]];
-        
-        let e1 = [v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2]];
-        let e2 = [v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2]];
-        
-        let nx = e1[1] * e2[2] - e1[2] * e2[1];
-        let ny = e1[2] * e2[0] - e1[0] * e2[2];
-        let nz = e1[0] * e2[1] - e1[1] * e2[0];
-        
-        for &idx in &[idx_a, idx_b, idx_c] {
-            normals[idx * 3] += nx;
-            normals[idx * 3 + 1] += ny;
-            normals[idx * 3 + 2] += nz;
+
+    // Per-face normals: independent work, parallel in the threaded build
+    #[cfg(feature = "threads")]
+    let face_normals: Vec<[f64; 3]> = faces
+        .par_chunks_exact(3)
+        .map(|face| face_normal(vertices, face))
+        .collect();
+
+    #[cfg(not(feature = "threads"))]
+    let face_normals: Vec<[f64; 3]> = faces
+        .chunks_exact(3)
+        .map(|face| face_normal(vertices, face))
+        .collect();
+
+    // Accumulate into shared vertices (serial: vertices overlap between faces)
+    for (face, n) in faces.chunks_exact(3).zip(face_normals.iter()) {
+        for &idx in face {
+            let idx = idx as usize;
+            normals[idx * 3] += n[0];
+            normals[idx * 3 + 1] += n[1];
+            normals[idx * 3 + 2] += n[2];
         }
     }
-    
-    // Normalize
-    for i in (0..normals.len()).step_by(3) {
-        let len = (normals[i] * normals[i] + 
-                   normals[i + 1] * normals[i + 1] + 
-                   normals[i + 2] * normals[i + 2]).sqrt();
-        
+
+    // Normalize: per-vertex, parallel in the threaded build
+    #[cfg(feature = "threads")]
+    let chunks = normals.par_chunks_exact_mut(3);
+    #[cfg(not(feature = "threads"))]
+    let chunks = normals.chunks_exact_mut(3);
+
+    chunks.for_each(|n| {
+        let len = (n[0] * n[0] + n[1] * n[1] + n[2] * n[2]).sqrt();
+
         if len > 0.0 {
-            normals[i] /= len;
-            normals[i + 1] /= len;
-            normals[i + 2] /= len;
+            n[0] /= len;
+            n[1] /= len;
+            n[2] /= len;
         }
-    }
+    });
 }
 
 #[cfg(test)]
@@ -678,38 +796,84 @@ mod tests {
 
     #[test]
     fn test_create_box() {
-        let mesh = create_box(100.0, 50.0, 25.0);
+        let mesh = create_box(100.0, 50.0, 25.0).unwrap();
         assert_eq!(mesh.vertex_count(), 8);
         assert_eq!(mesh.face_count(), 12);
     }
 
     #[test]
     fn test_create_cylinder() {
-        let mesh = create_cylinder(50.0, 100.0, Some(16));
+        let mesh = create_cylinder(50.0, 100.0, Some(16)).unwrap();
         assert!(mesh.vertex_count() > 0);
         assert!(mesh.face_count() > 0);
     }
 
     #[test]
     fn test_create_sphere() {
-        let mesh = create_sphere(50.0, Some(16), Some(16));
+        let mesh = create_sphere(50.0, Some(16), Some(16)).unwrap();
         assert!(mesh.vertex_count() > 0);
         assert!(mesh.face_count() > 0);
     }
 
+    #[test]
+    fn test_decimate_mesh() {
+        let mesh = create_sphere(50.0, Some(32), Some(32)).unwrap();
+        let dense_faces = mesh.face_count();
+
+        let proxy = decimate_mesh(&mesh, 300).unwrap();
+        assert!(proxy.face_count() > 0);
+        assert!(proxy.face_count() < dense_faces / 2);
+        assert_eq!(proxy.normals().len(), proxy.vertices().len());
+
+        // A mesh already under budget passes through unchanged
+        let box_mesh = create_box(100.0, 50.0, 25.0).unwrap();
+        let same = decimate_mesh(&box_mesh, 500).unwrap();
+        assert_eq!(same.face_count(), box_mesh.face_count());
+    }
+
     #[test]
     fn test_export_stl() {
-        let mesh = create_box(100.0, 50.0, 25.0);
+        let mesh = create_box(100.0, 50.0, 25.0).unwrap();
         let stl = export_stl(&mesh, "test").unwrap();
         assert!(stl.contains("solid test"));
         assert!(stl.contains("facet normal"));
         assert!(stl.contains("endsolid"));
     }
 
+    #[test]
+    fn test_export_stl_binary_chunks() {
+        let mesh = create_box(100.0, 50.0, 25.0).unwrap();
+
+        let full = export_stl_binary(&mesh, "test");
+        assert_eq!(full.len(), 84 + (mesh.faces.len() / 3) * 50);
+
+        // Streamed chunks must concatenate to the one-shot export
+        let chunk_triangles = 4;
+        let mut assembled = Vec::new();
+        for i in 0..export_stl_chunk_count(&mesh, chunk_triangles) {
+            assembled.extend_from_slice(&export_stl_binary_chunk(
+                &mesh,
+                "test",
+                i,
+                chunk_triangles,
+            ));
+        }
+        assert_eq!(assembled, full);
+    }
+
+    #[test]
+    fn test_export_3mf() {
+        let mesh = create_box(100.0, 50.0, 25.0).unwrap();
+        let package = export_3mf(&mesh, "box");
+
+        // Zip local-file-header signature
+        assert_eq!(&package[..4], &[0x50, 0x4b, 0x03, 0x04]);
+    }
+
     #[test]
     fn test_deterministic_mesh() {
-        let mesh1 = create_box(100.0, 50.0, 25.0);
-        let mesh2 = create_box(100.0, 50.0, 25.0);
+        let mesh1 = create_box(100.0, 50.0, 25.0).unwrap();
+        let mesh2 = create_box(100.0, 50.0, 25.0).unwrap();
 
         let hash1 = compute_mesh_hash(&mesh1);
         let hash2 = compute_mesh_hash(&mesh2);
@@ -0,0 +1,160 @@
+//! Criterion benchmarks for the geometry kernel compile pipeline.
+//!
+//! Covers intent hashing, the binary protocol, and full compilation
+//! (which exercises CSG evaluation and tessellation internally) in both
+//! cold and cache-hit configurations. Run with:
+//!
+//!     cargo bench --target x86_64-unknown-linux-gnu
+//!
+//! Numbers are native-target, not wasm — use them for relative
+//! regression tracking release over release.
+
+use criterion::{black_box, criterion_group, criterion_main, BatchSize, Criterion};
+use qutlas_geometry_kernel::hashing;
+use qutlas_geometry_kernel::protocol;
+use qutlas_geometry_kernel::types::{
+    GeometryIR, Intent, OperationIntent, OperationType, PrimitiveIntent, PrimitiveType,
+};
+use qutlas_geometry_kernel::GeometryKernel;
+use std::collections::HashMap;
+
+fn box_intent() -> GeometryIR {
+    GeometryIR {
+        part: "bench_part".to_string(),
+        operations: vec![Intent::Primitive(PrimitiveIntent {
+            id: "box1".to_string(),
+            type_: PrimitiveType::Box,
+            parameters: vec![
+                ("width".to_string(), 100.0),
+                ("height".to_string(), 50.0),
+                ("depth".to_string(), 25.0),
+            ]
+            .into_iter()
+            .collect(),
+            transform: None,
+            timestamp: 0.0,
+        })],
+        constraints: vec![],
+    }
+}
+
+fn union_intent() -> GeometryIR {
+    GeometryIR {
+        part: "bench_part".to_string(),
+        operations: vec![
+            Intent::Primitive(PrimitiveIntent {
+                id: "box1".to_string(),
+                type_: PrimitiveType::Box,
+                parameters: vec![
+                    ("width".to_string(), 100.0),
+                    ("height".to_string(), 100.0),
+                    ("depth".to_string(), 100.0),
+                ]
+                .into_iter()
+                .collect(),
+                transform: None,
+                timestamp: 0.0,
+            }),
+            Intent::Primitive(PrimitiveIntent {
+                id: "sphere1".to_string(),
+                type_: PrimitiveType::Sphere,
+                parameters: vec![("radius".to_string(), 60.0)].into_iter().collect(),
+                transform: None,
+                timestamp: 0.0,
+            }),
+            Intent::Operation(OperationIntent {
+                id: "union1".to_string(),
+                type_: OperationType::Union,
+                target: "box1".to_string(),
+                operand: Some("sphere1".to_string()),
+                parameters: HashMap::new(),
+                timestamp: 0.0,
+            }),
+        ],
+        constraints: vec![],
+    }
+}
+
+fn bench_hashing(c: &mut Criterion) {
+    let mut group = c.benchmark_group("hashing");
+    let ir = union_intent();
+    let json = serde_json::to_string(&ir).unwrap();
+
+    group.bench_function("hash_intent", |b| b.iter(|| hashing::hash_intent(black_box(&ir))));
+
+    group.bench_function("hash_intent_json", |b| {
+        b.iter(|| hashing::hash_intent_json(black_box(&json)))
+    });
+
+    group.finish();
+}
+
+fn bench_protocol(c: &mut Criterion) {
+    let mut group = c.benchmark_group("protocol");
+    let ir = union_intent();
+    let json = serde_json::to_string(&ir).unwrap();
+    let bytes = protocol::encode_geometry_ir(&ir);
+
+    group.bench_function("encode_binary", |b| {
+        b.iter(|| protocol::encode_geometry_ir(black_box(&ir)))
+    });
+
+    group.bench_function("decode_binary", |b| {
+        b.iter(|| protocol::decode_geometry_ir(black_box(&bytes)).unwrap())
+    });
+
+    // The serde path the binary protocol replaces, for comparison
+    group.bench_function("decode_json", |b| {
+        b.iter(|| serde_json::from_str::<GeometryIR>(black_box(&json)).unwrap())
+    });
+
+    group.finish();
+}
+
+fn bench_compile(c: &mut Criterion) {
+    let mut group = c.benchmark_group("compile");
+    group.sample_size(20);
+
+    let box_json = serde_json::to_string(&box_intent()).unwrap();
+    let union_json = serde_json::to_string(&union_intent()).unwrap();
+    let box_bytes = protocol::encode_geometry_ir(&box_intent());
+
+    // Cold: fresh kernel per iteration, so evaluation and tessellation
+    // run in full (this is the first-edit latency)
+    group.bench_function("box_cold", |b| {
+        b.iter_batched(
+            GeometryKernel::new,
+            |mut kernel| kernel.compile_intent(black_box(&box_json)),
+            BatchSize::SmallInput,
+        )
+    });
+
+    group.bench_function("union_cold", |b| {
+        b.iter_batched(
+            GeometryKernel::new,
+            |mut kernel| kernel.compile_intent(black_box(&union_json)),
+            BatchSize::SmallInput,
+        )
+    });
+
+    // Cached: one kernel, repeated compile of the same intent — this is
+    // the content-hash cache hit path for unchanged subtrees
+    group.bench_function("box_cached", |b| {
+        let mut kernel = GeometryKernel::new();
+        kernel.compile_intent(&box_json);
+        b.iter(|| kernel.compile_intent(black_box(&box_json)))
+    });
+
+    group.bench_function("box_cold_binary", |b| {
+        b.iter_batched(
+            GeometryKernel::new,
+            |mut kernel| kernel.compile_intent_binary(black_box(&box_bytes)),
+            BatchSize::SmallInput,
+        )
+    });
+
+    group.finish();
+}
+
+criterion_group!(benches, bench_hashing, bench_protocol, bench_compile);
+criterion_main!(benches);
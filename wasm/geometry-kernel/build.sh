@@ -20,6 +20,16 @@ wasm-pack build \
   --out-dir pkg \
   --release
 
+# SIMD variant: same crate compiled with simd128 enabled so the hot
+# tessellation loops auto-vectorize. Loaded preferentially by workers
+# when the runtime passes the simd128 feature probe.
+echo "🔨 Building SIMD variant..."
+RUSTFLAGS="-C target-feature=+simd128" \
+  wasm-pack build \
+  --target bundler \
+  --out-dir pkg-simd \
+  --release
+
 # Move the output to a location accessible by the frontend
 if [ -d "pkg" ]; then
     echo "✅ Kernel built successfully"
@@ -7,6 +7,7 @@ use crate::compiler::{CsgEvaluator, IntentParser};
 use crate::errors::{KernelError, KernelResult};
 use crate::geometry::analysis::bounding_box::compute_bounding_box;
 use crate::hashing;
+use crate::timing::{now_ms, Span, SpanRecorder};
 use crate::types::{
     CompileResult, CompileStatus, GeometryIR, ManufacturabilityReport, PreviewMesh,
 };
@@ -20,6 +21,7 @@ pub struct CsgCompiler {
     evaluator: CsgEvaluator,
     cached_hash: Option<String>,
     cached_result: Option<CompileResult>,
+    spans: SpanRecorder,
 }
 
 impl CsgCompiler {
@@ -29,6 +31,7 @@ impl CsgCompiler {
             evaluator: CsgEvaluator::new(),
             cached_hash: None,
             cached_result: None,
+            spans: SpanRecorder::new(),
         }
     }
 
@@ -38,18 +41,22 @@ impl CsgCompiler {
             evaluator: CsgEvaluator::with_subdivisions(subdivisions),
             cached_hash: None,
             cached_result: None,
+            spans: SpanRecorder::new(),
         }
     }
 
     /// Compile Intent IR to geometry with caching
     pub fn compile(&mut self, ir: &GeometryIR) -> KernelResult<CompileResult> {
         // Compute hash
+        let t = now_ms();
         let intent_hash = hashing::hash_intent(ir);
+        self.spans.record("hash", t);
 
         // Check cache
         if let Some(cached_hash) = &self.cached_hash {
             if cached_hash == &intent_hash {
                 if let Some(result) = &self.cached_result {
+                    self.spans.record("cache_hit", t);
                     return Ok(CompileResult {
                         status: CompileStatus::Cached,
                         ..result.clone()
@@ -59,19 +66,25 @@ impl CsgCompiler {
         }
 
         // Validate intent structure
+        let t = now_ms();
         let csg_tree = self.parser.parse(ir)?;
 
         // Validate tree structure
         csg_tree.validate()?;
+        self.spans.record("parse", t);
 
-        // Evaluate to mesh
+        // Evaluate to mesh (CSG evaluation + tessellation)
+        let t = now_ms();
         let mesh = self.evaluator.evaluate(&csg_tree)?;
 
         // Validate mesh output
         mesh.is_valid()?;
+        self.spans.record("evaluate", t);
 
         // Check manufacturability constraints
+        let t = now_ms();
         let mfg_report = self.check_manufacturability(&mesh, ir)?;
+        self.spans.record("manufacturability", t);
 
         // Build result
         let result = CompileResult {
@@ -147,10 +160,17 @@ impl CsgCompiler {
         self.evaluator.clear_cache();
     }
 
+    /// Move recorded pipeline spans out (oldest first)
+    pub fn take_spans(&mut self) -> Vec<Span> {
+        self.spans.drain()
+    }
+
     /// Get cache statistics
     pub fn cache_stats(&self) -> CacheStats {
+        let evaluator_stats = self.evaluator.cache_stats();
         CacheStats {
-            size: self.evaluator.cache.len(),
+            size: evaluator_stats.size,
+            hits: evaluator_stats.hits,
         }
     }
 }
@@ -165,6 +185,7 @@ impl Default for CsgCompiler {
 #[derive(Debug, Clone)]
 pub struct CacheStats {
     pub size: usize,
+    pub hits: usize,
 }
 
 #[cfg(test)]
@@ -263,9 +284,38 @@ mod tests {
         assert_eq!(result1.intent_hash, result2.intent_hash);
     }
 
+    #[test]
+    fn test_compile_records_spans() {
+        let mut compiler = CsgCompiler::new();
+
+        let ir = GeometryIR {
+            part: "test_part".to_string(),
+            operations: vec![Intent::Primitive(create_test_box_intent("box1"))],
+            constraints: vec![],
+        };
+
+        compiler.compile(&ir).unwrap();
+        let spans = compiler.take_spans();
+        let names: Vec<&str> = spans.iter().map(|s| s.name.as_str()).collect();
+
+        assert!(names.contains(&"hash"));
+        assert!(names.contains(&"parse"));
+        assert!(names.contains(&"evaluate"));
+        assert!(names.contains(&"manufacturability"));
+
+        // Drained: a second take is empty
+        assert!(compiler.take_spans().is_empty());
+
+        // A cached compile records the cache-hit path instead
+        compiler.compile(&ir).unwrap();
+        let spans = compiler.take_spans();
+        assert!(spans.iter().any(|s| s.name == "cache_hit"));
+        assert!(!spans.iter().any(|s| s.name == "evaluate"));
+    }
+
     #[test]
     fn test_validate() {
-        let compiler = CsgCompiler::new();
+        let mut compiler = CsgCompiler::new();
 
         let ir = GeometryIR {
             part: "test_part".to_string(),
@@ -278,7 +328,7 @@ mod tests {
 
     #[test]
     fn test_validate_missing_parameter() {
-        let compiler = CsgCompiler::new();
+        let mut compiler = CsgCompiler::new();
 
         let ir = GeometryIR {
             part: "test_part".to_string(),
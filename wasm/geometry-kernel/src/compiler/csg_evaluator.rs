@@ -5,17 +5,31 @@
 
 use crate::compiler::csg_tree::CsgNode;
 use crate::types::PreviewMesh;
-use crate::geometry::{Primitive, create_primitive};
-use crate::errors::{KernelError, KernelResult};
-use std::collections::HashMap;
+use crate::geometry::create_primitive;
+use crate::errors::KernelResult;
+use std::collections::{HashMap, HashSet};
+
+/// Maximum cached meshes before stale entries are pruned.
+///
+/// Each incremental edit retires the hashes of the modified subtree,
+/// so the cache accumulates dead entries over a long session. Pruning
+/// keeps only the entries touched by the most recent evaluation.
+const MAX_CACHED_MESHES: usize = 256;
 
 /// CSG tree evaluator
 ///
 /// Evaluates CSG trees to produce preview meshes with memoization
-/// for performance.
+/// for performance. Results are keyed by per-node content hashes, so
+/// editing one parameter re-tessellates only the modified primitive
+/// and the boolean operations above it; every untouched subtree
+/// splices its cached mesh back in.
 pub struct CsgEvaluator {
-    /// Cache of evaluated results
+    /// Cache of evaluated results, keyed by node content hash
     pub(crate) cache: HashMap<String, PreviewMesh>,
+    /// Cache keys touched during the current evaluation (for pruning)
+    touched: HashSet<String>,
+    /// Cache hit counter
+    hits: usize,
     /// Subdivision level for mesh generation
     subdivisions: u32,
 }
@@ -24,6 +38,8 @@ impl CsgEvaluator {
     pub fn new() -> Self {
         CsgEvaluator {
             cache: HashMap::new(),
+            touched: HashSet::new(),
+            hits: 0,
             subdivisions: 16, // Default subdivisions
         }
     }
@@ -31,85 +47,129 @@ impl CsgEvaluator {
     pub fn with_subdivisions(subdivisions: u32) -> Self {
         CsgEvaluator {
             cache: HashMap::new(),
+            touched: HashSet::new(),
+            hits: 0,
             subdivisions: subdivisions.max(4).min(64),
         }
     }
 
     /// Evaluate a CSG node to produce a mesh
     pub fn evaluate(&mut self, node: &CsgNode) -> KernelResult<PreviewMesh> {
-        // Check cache
-        if let Some(id) = node.get_id() {
-            if let Some(mesh) = self.cache.get(id) {
-                return Ok(mesh.clone());
-            }
+        self.touched.clear();
+        let (_, mesh) = self.evaluate_hashed(node)?;
+
+        // Drop entries no longer reachable from the current tree once
+        // the cache outgrows its budget.
+        if self.cache.len() > MAX_CACHED_MESHES {
+            let touched = std::mem::take(&mut self.touched);
+            self.cache.retain(|hash, _| touched.contains(hash));
+            self.touched = touched;
         }
 
-        let result = match node {
-            CsgNode::Primitive {
-                id,
-                type_,
-                params,
-                transform,
-            } => {
-                let primitive = create_primitive(type_.clone(), params)?;
-                let mut mesh = primitive.to_mesh(self.subdivisions);
+        Ok(mesh)
+    }
+
+    /// Evaluate a node, returning its content hash alongside the mesh
+    ///
+    /// Hashes are computed bottom-up in the same recursion that
+    /// evaluates the tree, so each node is hashed exactly once.
+    fn evaluate_hashed(&mut self, node: &CsgNode) -> KernelResult<(String, PreviewMesh)> {
+        let (hash, result) = match node {
+            CsgNode::Primitive { type_, params, .. } => {
+                let hash = node.content_hash();
 
-                // Cache primitive result
-                self.cache.insert(id.clone(), mesh.clone());
+                if let Some(mesh) = self.cache_get(&hash) {
+                    return Ok((hash, mesh));
+                }
 
-                Ok(mesh)
+                let primitive = create_primitive(type_.clone(), params)?;
+                let mesh = primitive.to_mesh(self.subdivisions);
+                (hash, mesh)
             }
             CsgNode::Union { left, right } => {
-                let left_mesh = self.evaluate(left)?;
-                let right_mesh = self.evaluate(right)?;
+                let (left_hash, left_mesh) = self.evaluate_hashed(left)?;
+                let (right_hash, right_mesh) = self.evaluate_hashed(right)?;
+                let hash = crate::hashing::hash_value(&("union", left_hash, right_hash));
+
+                if let Some(mesh) = self.cache_get(&hash) {
+                    return Ok((hash, mesh));
+                }
 
-                crate::geometry::operations::boolean_operation(
+                let mesh = crate::geometry::operations::boolean_operation(
                     &left_mesh,
                     &right_mesh,
                     crate::geometry::operations::BooleanOperation::Union,
-                )
+                )?;
+                (hash, mesh)
             }
             CsgNode::Subtract { target, tool } => {
-                let target_mesh = self.evaluate(target)?;
-                let tool_mesh = self.evaluate(tool)?;
+                let (target_hash, target_mesh) = self.evaluate_hashed(target)?;
+                let (tool_hash, tool_mesh) = self.evaluate_hashed(tool)?;
+                let hash = crate::hashing::hash_value(&("subtract", target_hash, tool_hash));
 
-                crate::geometry::operations::boolean_operation(
+                if let Some(mesh) = self.cache_get(&hash) {
+                    return Ok((hash, mesh));
+                }
+
+                let mesh = crate::geometry::operations::boolean_operation(
                     &target_mesh,
                     &tool_mesh,
                     crate::geometry::operations::BooleanOperation::Subtract,
-                )
+                )?;
+                (hash, mesh)
             }
             CsgNode::Intersect { left, right } => {
-                let left_mesh = self.evaluate(left)?;
-                let right_mesh = self.evaluate(right)?;
+                let (left_hash, left_mesh) = self.evaluate_hashed(left)?;
+                let (right_hash, right_mesh) = self.evaluate_hashed(right)?;
+                let hash = crate::hashing::hash_value(&("intersect", left_hash, right_hash));
+
+                if let Some(mesh) = self.cache_get(&hash) {
+                    return Ok((hash, mesh));
+                }
 
-                crate::geometry::operations::boolean_operation(
+                let mesh = crate::geometry::operations::boolean_operation(
                     &left_mesh,
                     &right_mesh,
                     crate::geometry::operations::BooleanOperation::Intersect,
-                )
+                )?;
+                (hash, mesh)
             }
         };
 
-        result
+        self.touched.insert(hash.clone());
+        self.cache.insert(hash.clone(), result.clone());
+
+        Ok((hash, result))
+    }
+
+    /// Look up a cached mesh, recording the hit
+    fn cache_get(&mut self, hash: &str) -> Option<PreviewMesh> {
+        let mesh = self.cache.get(hash).cloned();
+        if mesh.is_some() {
+            self.hits += 1;
+            self.touched.insert(hash.to_string());
+        }
+        mesh
     }
 
     /// Set subdivision level for mesh generation
     pub fn set_subdivisions(&mut self, subdivisions: u32) {
         self.subdivisions = subdivisions.max(4).min(64);
-        self.cache.clear(); // Clear cache when subdivisions change
+        self.clear_cache(); // Cached meshes are tessellation-specific
     }
 
     /// Clear evaluation cache
     pub fn clear_cache(&mut self) {
         self.cache.clear();
+        self.touched.clear();
+        self.hits = 0;
     }
 
     /// Get cache statistics
     pub fn cache_stats(&self) -> CacheStats {
         CacheStats {
             size: self.cache.len(),
-            hits: 0, // Would need counter for accurate stats
+            hits: self.hits,
         }
     }
 }
@@ -213,10 +273,87 @@ mod tests {
         );
 
         let mesh1 = evaluator.evaluate(&node).unwrap();
+        let hits_after_first = evaluator.cache_stats().hits;
         let mesh2 = evaluator.evaluate(&node).unwrap();
 
         // Should get cached result (same mesh)
         assert_eq!(mesh1.vertices.len(), mesh2.vertices.len());
         assert_eq!(mesh1.indices.len(), mesh2.indices.len());
+        assert!(evaluator.cache_stats().hits > hits_after_first);
+    }
+
+    #[test]
+    fn test_parameter_edit_invalidates_cache() {
+        let mut evaluator = CsgEvaluator::new();
+
+        let make_box = |width: f64| {
+            primitive_node(
+                "box1".to_string(),
+                PrimitiveType::Box,
+                vec![
+                    ("width".to_string(), width),
+                    ("height".to_string(), 10.0),
+                    ("depth".to_string(), 10.0),
+                ]
+                .into_iter()
+                .collect(),
+                None,
+            )
+        };
+
+        let mesh1 = evaluator.evaluate(&make_box(10.0)).unwrap();
+        let mesh2 = evaluator.evaluate(&make_box(20.0)).unwrap();
+
+        // Same node ID, different parameters: the content hash differs,
+        // so the second evaluation must not return the stale mesh.
+        let max_x = |mesh: &PreviewMesh| {
+            mesh.vertices
+                .chunks(3)
+                .map(|v| v[0])
+                .fold(f32::NEG_INFINITY, f32::max)
+        };
+        assert!(max_x(&mesh2) > max_x(&mesh1));
+    }
+
+    #[test]
+    fn test_incremental_reuse_of_unchanged_subtree() {
+        let mut evaluator = CsgEvaluator::new();
+
+        let make_tree = |box2_width: f64| {
+            let box1 = primitive_node(
+                "box1".to_string(),
+                PrimitiveType::Box,
+                vec![
+                    ("width".to_string(), 10.0),
+                    ("height".to_string(), 10.0),
+                    ("depth".to_string(), 10.0),
+                ]
+                .into_iter()
+                .collect(),
+                None,
+            );
+            let box2 = primitive_node(
+                "box2".to_string(),
+                PrimitiveType::Box,
+                vec![
+                    ("width".to_string(), box2_width),
+                    ("height".to_string(), 5.0),
+                    ("depth".to_string(), 5.0),
+                ]
+                .into_iter()
+                .collect(),
+                None,
+            );
+            union_node(box1, box2)
+        };
+
+        evaluator.evaluate(&make_tree(5.0)).unwrap();
+        let hits_before = evaluator.cache_stats().hits;
+
+        // Nudge one parameter: box1 is unchanged and must come from
+        // cache; box2 and the union above it re-evaluate.
+        evaluator.evaluate(&make_tree(6.0)).unwrap();
+
+        assert_eq!(evaluator.cache_stats().hits, hits_before + 1);
     }
 }
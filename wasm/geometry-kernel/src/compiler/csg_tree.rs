@@ -115,6 +115,39 @@ impl CsgNode {
         }
     }
 
+    /// Compute the content hash of this node
+    ///
+    /// The hash is built bottom-up from child hashes, so two subtrees
+    /// hash equal exactly when their geometry is identical. Primitive
+    /// IDs are deliberately excluded: renaming a node must not
+    /// invalidate its cached tessellation, while nudging a parameter
+    /// changes the hash of the primitive and every operation above it —
+    /// and nothing else.
+    pub fn content_hash(&self) -> String {
+        match self {
+            CsgNode::Primitive {
+                type_,
+                params,
+                transform,
+                ..
+            } => {
+                // Sort parameters for deterministic ordering
+                let mut entries: Vec<(&String, &f64)> = params.iter().collect();
+                entries.sort_by(|a, b| a.0.cmp(b.0));
+                crate::hashing::hash_value(&("primitive", type_, entries, transform))
+            }
+            CsgNode::Union { left, right } => {
+                crate::hashing::hash_value(&("union", left.content_hash(), right.content_hash()))
+            }
+            CsgNode::Subtract { target, tool } => {
+                crate::hashing::hash_value(&("subtract", target.content_hash(), tool.content_hash()))
+            }
+            CsgNode::Intersect { left, right } => {
+                crate::hashing::hash_value(&("intersect", left.content_hash(), right.content_hash()))
+            }
+        }
+    }
+
     /// Get bounding box for this node (cached if available)
     pub fn bounding_box(&self) -> Option<BoundingBox> {
         // This would be implemented with actual geometry evaluation
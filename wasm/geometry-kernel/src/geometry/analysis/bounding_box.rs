@@ -140,12 +140,13 @@ pub fn transform_bbox(bbox: &BoundingBox, transform: &crate::types::Transform) -
 #[cfg(test)]
 mod tests {
     use super::*;
-    use crate::geometry::primitives::{Box as BoxPrimitive, Primitive};
+    use crate::geometry::primitives::Box as BoxPrimitive;
+    use crate::geometry::Primitive;
 
     #[test]
     fn test_compute_bounding_box() {
         let mesh = BoxPrimitive::new(1.0, 2.0, 3.0).to_mesh(4);
-        let bbox = compute_bounding_box(&mesh).unwrap();
+        let bbox = compute_bounding_box(&mesh);
 
         assert!(!bbox.is_empty());
 
@@ -0,0 +1,720 @@
+//! Mesh-based design-for-manufacturability analysis.
+//!
+//! The TypeScript constraint checks score parts from their parametric
+//! dimensions; once geometry has been through CSG or comes from an
+//! import, those parameters no longer describe the actual shape. This
+//! module inspects the tessellated mesh directly:
+//!
+//! - wall thickness by ray-casting inward from each face against a
+//!   uniform spatial grid of triangles
+//! - draft angles from face normals relative to a pull direction
+//! - hole diameters from circular sharp-edge loops found through the
+//!   half-edge topology structure
+//!
+//! Results are serializable so the worker can pass them straight to
+//! the manufacturability assessment on the JS side.
+
+use crate::errors::{KernelError, KernelResult};
+use crate::geometry::topology::{HalfEdgeMesh, INVALID_HANDLE};
+use serde::{Deserialize, Serialize};
+use std::collections::HashMap;
+
+/// Tunable thresholds for the analysis. All lengths are in model
+/// units (millimetres throughout the app).
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct MeshDfmOptions {
+    /// Walls thinner than this are reported (process-dependent)
+    #[serde(default = "default_min_wall")]
+    pub min_wall_thickness: f64,
+    /// Required draft in degrees; 0 disables the draft check
+    #[serde(default = "default_min_draft")]
+    pub min_draft_angle_deg: f64,
+    /// Mold pull / machining approach direction
+    #[serde(default = "default_pull_direction")]
+    pub pull_direction: [f64; 3],
+    /// Dihedral angle above which an edge counts as sharp, in degrees
+    #[serde(default = "default_sharp_angle")]
+    pub sharp_angle_deg: f64,
+}
+
+fn default_min_wall() -> f64 {
+    1.0
+}
+fn default_min_draft() -> f64 {
+    1.0
+}
+fn default_pull_direction() -> [f64; 3] {
+    [0.0, 0.0, 1.0]
+}
+fn default_sharp_angle() -> f64 {
+    30.0
+}
+
+impl Default for MeshDfmOptions {
+    fn default() -> Self {
+        MeshDfmOptions {
+            min_wall_thickness: default_min_wall(),
+            min_draft_angle_deg: default_min_draft(),
+            pull_direction: default_pull_direction(),
+            sharp_angle_deg: default_sharp_angle(),
+        }
+    }
+}
+
+/// A circular sharp-edge loop whose wall faces point at its centre —
+/// a through-hole or blind bore rim.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct DetectedHole {
+    pub diameter: f64,
+    pub center: [f64; 3],
+}
+
+/// Full analysis report for one mesh
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct MeshDfmReport {
+    /// Thinnest wall found by ray sampling (f64::MAX when no
+    /// opposing surface was hit within the bounding box)
+    pub min_wall_thickness: f64,
+    /// Fraction of sampled surface area thinner than the threshold
+    pub thin_wall_area_fraction: f64,
+    /// Number of face samples that produced a thickness measurement
+    pub wall_samples: usize,
+    /// Smallest draft angle among steep faces, in degrees
+    pub min_draft_angle_deg: f64,
+    /// Fraction of side-wall area with insufficient draft
+    pub undrafted_area_fraction: f64,
+    /// Circular bores found through the topology structure
+    pub holes: Vec<DetectedHole>,
+    /// Smallest detected hole diameter (0 when no holes were found)
+    pub min_hole_diameter: f64,
+    /// Whether the mesh is a closed manifold (topology checks are
+    /// skipped when it is not)
+    pub is_closed: bool,
+    pub triangle_count: usize,
+}
+
+// Faces steeper than this (normal nearly parallel to pull) are
+// treated as tops/bottoms and excluded from the draft check
+const HORIZONTAL_NORMAL_DOT: f64 = 0.95;
+// Relative radius deviation below which an edge loop counts as
+// circular
+const CIRCLE_FIT_TOLERANCE: f64 = 0.15;
+// Minimum segments for a loop to be considered a bore rim
+const MIN_HOLE_LOOP_EDGES: usize = 6;
+// Offset along the ray before testing intersections, so a face does
+// not immediately hit itself
+const RAY_SELF_EPS: f64 = 1e-6;
+
+/// Uniform grid over the mesh bounding box binning triangle indices,
+/// so a thickness ray only tests triangles near its path.
+struct TriangleGrid {
+    min: [f64; 3],
+    cell_size: [f64; 3],
+    resolution: [usize; 3],
+    cells: Vec<Vec<u32>>,
+}
+
+impl TriangleGrid {
+    fn build(positions: &[f64], indices: &[u32]) -> TriangleGrid {
+        let mut min = [f64::MAX; 3];
+        let mut max = [f64::MIN; 3];
+        for v in positions.chunks_exact(3) {
+            for a in 0..3 {
+                min[a] = min[a].min(v[a]);
+                max[a] = max[a].max(v[a]);
+            }
+        }
+
+        let tri_count = indices.len() / 3;
+        // Aim for a few triangles per occupied cell; clamp so tiny and
+        // huge meshes both stay reasonable
+        let res = ((tri_count as f64).cbrt().ceil() as usize).clamp(4, 64);
+        let resolution = [res, res, res];
+
+        let mut cell_size = [0.0; 3];
+        for a in 0..3 {
+            let extent = (max[a] - min[a]).max(1e-9);
+            cell_size[a] = extent / res as f64;
+        }
+
+        let mut cells = vec![Vec::new(); res * res * res];
+        for t in 0..tri_count {
+            let mut tmin = [f64::MAX; 3];
+            let mut tmax = [f64::MIN; 3];
+            for k in 0..3 {
+                let vi = indices[t * 3 + k] as usize * 3;
+                for a in 0..3 {
+                    tmin[a] = tmin[a].min(positions[vi + a]);
+                    tmax[a] = tmax[a].max(positions[vi + a]);
+                }
+            }
+            let lo = Self::clamp_cell(&tmin, &min, &cell_size, res);
+            let hi = Self::clamp_cell(&tmax, &min, &cell_size, res);
+            for x in lo[0]..=hi[0] {
+                for y in lo[1]..=hi[1] {
+                    for z in lo[2]..=hi[2] {
+                        cells[(x * res + y) * res + z].push(t as u32);
+                    }
+                }
+            }
+        }
+
+        TriangleGrid {
+            min,
+            cell_size,
+            resolution,
+            cells,
+        }
+    }
+
+    fn clamp_cell(p: &[f64; 3], min: &[f64; 3], cell_size: &[f64; 3], res: usize) -> [usize; 3] {
+        let mut c = [0usize; 3];
+        for a in 0..3 {
+            let i = ((p[a] - min[a]) / cell_size[a]).floor();
+            c[a] = (i.max(0.0) as usize).min(res - 1);
+        }
+        c
+    }
+
+    /// Nearest triangle hit along `dir` from `origin`, ignoring
+    /// `skip_triangle`. Walks grid cells front to back (3D DDA) so
+    /// traversal stops at the first populated intersection.
+    fn raycast(
+        &self,
+        positions: &[f64],
+        indices: &[u32],
+        origin: [f64; 3],
+        dir: [f64; 3],
+        max_t: f64,
+        skip_triangle: u32,
+    ) -> Option<f64> {
+        let res = self.resolution[0];
+        let mut cell = Self::clamp_cell(&origin, &self.min, &self.cell_size, res);
+
+        let mut step = [0isize; 3];
+        let mut t_max = [f64::MAX; 3];
+        let mut t_delta = [f64::MAX; 3];
+        for a in 0..3 {
+            if dir[a] > 1e-12 {
+                step[a] = 1;
+                let boundary = self.min[a] + (cell[a] + 1) as f64 * self.cell_size[a];
+                t_max[a] = (boundary - origin[a]) / dir[a];
+                t_delta[a] = self.cell_size[a] / dir[a];
+            } else if dir[a] < -1e-12 {
+                step[a] = -1;
+                let boundary = self.min[a] + cell[a] as f64 * self.cell_size[a];
+                t_max[a] = (boundary - origin[a]) / dir[a];
+                t_delta[a] = -self.cell_size[a] / dir[a];
+            }
+        }
+
+        let mut best: Option<f64> = None;
+        loop {
+            for &t in &self.cells[(cell[0] * res + cell[1]) * res + cell[2]] {
+                if t == skip_triangle {
+                    continue;
+                }
+                if let Some(hit) = ray_triangle(positions, indices, t as usize, origin, dir) {
+                    if hit > RAY_SELF_EPS && hit <= max_t && best.map_or(true, |b| hit < b) {
+                        best = Some(hit);
+                    }
+                }
+            }
+
+            // Done once a hit lies before the next cell boundary
+            let next_t = t_max[0].min(t_max[1]).min(t_max[2]);
+            if let Some(b) = best {
+                if b <= next_t {
+                    return best;
+                }
+            }
+            if next_t > max_t {
+                return best;
+            }
+
+            let axis = if t_max[0] <= t_max[1] && t_max[0] <= t_max[2] {
+                0
+            } else if t_max[1] <= t_max[2] {
+                1
+            } else {
+                2
+            };
+            let next = cell[axis] as isize + step[axis];
+            if next < 0 || next as usize >= res {
+                return best;
+            }
+            cell[axis] = next as usize;
+            t_max[axis] += t_delta[axis];
+        }
+    }
+}
+
+/// Möller–Trumbore ray/triangle intersection; returns the ray
+/// parameter t of the hit
+fn ray_triangle(
+    positions: &[f64],
+    indices: &[u32],
+    triangle: usize,
+    origin: [f64; 3],
+    dir: [f64; 3],
+) -> Option<f64> {
+    let p = |i: usize| -> [f64; 3] {
+        let v = indices[triangle * 3 + i] as usize * 3;
+        [positions[v], positions[v + 1], positions[v + 2]]
+    };
+    let (a, b, c) = (p(0), p(1), p(2));
+
+    let e1 = sub(b, a);
+    let e2 = sub(c, a);
+    let h = cross(dir, e2);
+    let det = dot(e1, h);
+    if det.abs() < 1e-12 {
+        return None;
+    }
+    let inv_det = 1.0 / det;
+    let s = sub(origin, a);
+    let u = dot(s, h) * inv_det;
+    if !(0.0..=1.0).contains(&u) {
+        return None;
+    }
+    let q = cross(s, e1);
+    let v = dot(dir, q) * inv_det;
+    if v < 0.0 || u + v > 1.0 {
+        return None;
+    }
+    let t = dot(e2, q) * inv_det;
+    if t > 0.0 {
+        Some(t)
+    } else {
+        None
+    }
+}
+
+fn sub(a: [f64; 3], b: [f64; 3]) -> [f64; 3] {
+    [a[0] - b[0], a[1] - b[1], a[2] - b[2]]
+}
+
+fn cross(a: [f64; 3], b: [f64; 3]) -> [f64; 3] {
+    [
+        a[1] * b[2] - a[2] * b[1],
+        a[2] * b[0] - a[0] * b[2],
+        a[0] * b[1] - a[1] * b[0],
+    ]
+}
+
+fn dot(a: [f64; 3], b: [f64; 3]) -> f64 {
+    a[0] * b[0] + a[1] * b[1] + a[2] * b[2]
+}
+
+fn normalize(v: [f64; 3]) -> Option<[f64; 3]> {
+    let len = dot(v, v).sqrt();
+    if len > 1e-12 {
+        Some([v[0] / len, v[1] / len, v[2] / len])
+    } else {
+        None
+    }
+}
+
+/// Per-triangle normal, area and centroid, shared by the wall and
+/// draft passes
+struct FaceData {
+    normal: [f64; 3],
+    area: f64,
+    centroid: [f64; 3],
+}
+
+fn face_data(positions: &[f64], indices: &[u32], triangle: usize) -> Option<FaceData> {
+    let p = |i: usize| -> [f64; 3] {
+        let v = indices[triangle * 3 + i] as usize * 3;
+        [positions[v], positions[v + 1], positions[v + 2]]
+    };
+    let (a, b, c) = (p(0), p(1), p(2));
+    let n = cross(sub(b, a), sub(c, a));
+    let double_area = dot(n, n).sqrt();
+    if double_area < 1e-12 {
+        return None;
+    }
+    Some(FaceData {
+        normal: [n[0] / double_area, n[1] / double_area, n[2] / double_area],
+        area: double_area / 2.0,
+        centroid: [
+            (a[0] + b[0] + c[0]) / 3.0,
+            (a[1] + b[1] + c[1]) / 3.0,
+            (a[2] + b[2] + c[2]) / 3.0,
+        ],
+    })
+}
+
+/// Analyzes a tessellated mesh for manufacturability. Positions are
+/// flat xyz triples and indices are triangle vertex triples, matching
+/// the preview-mesh buffers the worker already holds.
+pub fn analyze_mesh_dfm(
+    positions: &[f64],
+    indices: &[u32],
+    options: &MeshDfmOptions,
+) -> KernelResult<MeshDfmReport> {
+    if positions.len() % 3 != 0 || indices.len() % 3 != 0 {
+        return Err(KernelError::internal(
+            "Mesh buffers must contain whole xyz/index triples".to_string(),
+        ));
+    }
+    let triangle_count = indices.len() / 3;
+    if triangle_count == 0 {
+        return Err(KernelError::internal(
+            "Cannot analyze an empty mesh".to_string(),
+        ));
+    }
+
+    let grid = TriangleGrid::build(positions, indices);
+
+    // Bounding-box diagonal caps the thickness rays: past that there
+    // is no opposing wall
+    let mut diag = 0.0;
+    for a in 0..3 {
+        let extent = grid.cell_size[a] * grid.resolution[a] as f64;
+        diag += extent * extent;
+    }
+    let diag = diag.sqrt();
+
+    let pull = normalize(options.pull_direction).unwrap_or([0.0, 0.0, 1.0]);
+
+    // ---- Wall thickness and draft, one pass over the faces ----
+    let mut min_wall = f64::MAX;
+    let mut thin_area = 0.0;
+    let mut wall_samples = 0usize;
+    let mut total_area = 0.0;
+    let mut min_draft = f64::MAX;
+    let mut undrafted_area = 0.0;
+    let mut side_area = 0.0;
+
+    for t in 0..triangle_count {
+        let face = match face_data(positions, indices, t) {
+            Some(f) => f,
+            None => continue,
+        };
+        total_area += face.area;
+
+        // Thickness: cast from just inside the surface, against the
+        // normal; the first surface hit is the opposing wall
+        let inward = [-face.normal[0], -face.normal[1], -face.normal[2]];
+        let origin = [
+            face.centroid[0] + inward[0] * RAY_SELF_EPS,
+            face.centroid[1] + inward[1] * RAY_SELF_EPS,
+            face.centroid[2] + inward[2] * RAY_SELF_EPS,
+        ];
+        if let Some(hit) = grid.raycast(positions, indices, origin, inward, diag, t as u32) {
+            // Add back the launch offset so the span is surface to surface
+            let thickness = hit + RAY_SELF_EPS;
+            wall_samples += 1;
+            min_wall = min_wall.min(thickness);
+            if thickness < options.min_wall_thickness {
+                thin_area += face.area;
+            }
+        }
+
+        // Draft: angle between the face and the pull direction.
+        // Near-horizontal faces are tops/bottoms, not walls.
+        let axial = dot(face.normal, pull).abs();
+        if axial < HORIZONTAL_NORMAL_DOT {
+            side_area += face.area;
+            let draft_deg = axial.asin().to_degrees();
+            min_draft = min_draft.min(draft_deg);
+            if options.min_draft_angle_deg > 0.0 && draft_deg < options.min_draft_angle_deg {
+                undrafted_area += face.area;
+            }
+        }
+    }
+
+    // ---- Holes from the topology structure ----
+    let mut holes = Vec::new();
+    let mut is_closed = false;
+    if let Ok(he_mesh) = HalfEdgeMesh::from_buffers(positions, indices) {
+        is_closed = he_mesh.is_closed();
+        if is_closed {
+            holes = detect_holes(&he_mesh, options.sharp_angle_deg.to_radians());
+        }
+    }
+    let min_hole_diameter = holes
+        .iter()
+        .map(|h| h.diameter)
+        .fold(f64::MAX, f64::min);
+
+    Ok(MeshDfmReport {
+        min_wall_thickness: min_wall,
+        thin_wall_area_fraction: if total_area > 0.0 {
+            thin_area / total_area
+        } else {
+            0.0
+        },
+        wall_samples,
+        min_draft_angle_deg: if min_draft == f64::MAX { 90.0 } else { min_draft },
+        undrafted_area_fraction: if side_area > 0.0 {
+            undrafted_area / side_area
+        } else {
+            0.0
+        },
+        min_hole_diameter: if holes.is_empty() {
+            0.0
+        } else {
+            min_hole_diameter
+        },
+        holes,
+        is_closed,
+        triangle_count,
+    })
+}
+
+/// Chains sharp edges into closed loops, keeps the near-circular
+/// ones, and classifies each as a hole when the adjacent wall faces
+/// point toward the loop centre.
+fn detect_holes(mesh: &HalfEdgeMesh, sharp_angle: f64) -> Vec<DetectedHole> {
+    let sharp = mesh.sharp_edges(sharp_angle);
+    if sharp.len() < MIN_HOLE_LOOP_EDGES {
+        return Vec::new();
+    }
+
+    // Undirected sharp edges as vertex pairs, indexed by endpoint
+    let mut by_vertex: HashMap<u32, Vec<usize>> = HashMap::new();
+    let edges: Vec<(u32, u32)> = sharp
+        .iter()
+        .map(|&he| {
+            let a = mesh.half_edges[he as usize].origin;
+            let b = mesh.destination(he);
+            (a.min(b), a.max(b))
+        })
+        .collect();
+    for (i, &(a, b)) in edges.iter().enumerate() {
+        by_vertex.entry(a).or_default().push(i);
+        by_vertex.entry(b).or_default().push(i);
+    }
+
+    let mut used = vec![false; edges.len()];
+    let mut holes = Vec::new();
+
+    for start in 0..edges.len() {
+        if used[start] {
+            continue;
+        }
+
+        // Walk edge to edge through shared vertices; loops where a
+        // vertex has other than two sharp edges are not simple rims
+        let mut loop_edges = vec![start];
+        used[start] = true;
+        let (first_vertex, mut current_vertex) = edges[start];
+        let mut closed = false;
+
+        loop {
+            let incident = &by_vertex[&current_vertex];
+            if incident.len() != 2 {
+                break;
+            }
+            let next = incident
+                .iter()
+                .copied()
+                .find(|&e| !used[e]);
+            let next = match next {
+                Some(e) => e,
+                None => {
+                    closed = current_vertex == first_vertex;
+                    break;
+                }
+            };
+            used[next] = true;
+            loop_edges.push(next);
+            let (a, b) = edges[next];
+            current_vertex = if a == current_vertex { b } else { a };
+            if current_vertex == first_vertex {
+                closed = true;
+                break;
+            }
+        }
+
+        if !closed || loop_edges.len() < MIN_HOLE_LOOP_EDGES {
+            continue;
+        }
+
+        // Circle fit over the loop vertices; in a closed loop every
+        // vertex appears in exactly two edges, so summing both
+        // endpoints gives the exact centroid
+        let mut center = [0.0; 3];
+        for &e in &loop_edges {
+            for v in [edges[e].0, edges[e].1] {
+                let p = mesh.vertices[v as usize].position;
+                for a in 0..3 {
+                    center[a] += p[a];
+                }
+            }
+        }
+        for a in 0..3 {
+            center[a] /= (loop_edges.len() * 2) as f64;
+        }
+
+        let radii: Vec<f64> = loop_edges
+            .iter()
+            .map(|&e| {
+                let p = mesh.vertices[edges[e].0 as usize].position;
+                dot(sub(p, center), sub(p, center)).sqrt()
+            })
+            .collect();
+        let mean_radius: f64 = radii.iter().sum::<f64>() / radii.len() as f64;
+        if mean_radius < 1e-9 {
+            continue;
+        }
+        let circular = radii
+            .iter()
+            .all(|r| (r - mean_radius).abs() / mean_radius < CIRCLE_FIT_TOLERANCE);
+        if !circular {
+            continue;
+        }
+
+        // Hole vs boss: a bore's wall normals point at the axis. Vote
+        // across both faces of each loop edge.
+        let mut toward = 0usize;
+        let mut away = 0usize;
+        for &e in &loop_edges {
+            let he = sharp[e];
+            let (f0, f1) = mesh.edge_faces(he);
+            for face in [f0, f1] {
+                if face == INVALID_HANDLE {
+                    continue;
+                }
+                if let Some(n) = mesh.face_normal(face) {
+                    let fd = mesh.vertices
+                        [mesh.half_edges[mesh.faces[face as usize].half_edge as usize].origin
+                            as usize]
+                        .position;
+                    let to_center = sub(center, fd);
+                    let d = dot(n, to_center);
+                    if d > 1e-9 {
+                        toward += 1;
+                    } else if d < -1e-9 {
+                        away += 1;
+                    }
+                }
+            }
+        }
+
+        if toward > away {
+            holes.push(DetectedHole {
+                diameter: mean_radius * 2.0,
+                center,
+            });
+        }
+    }
+
+    holes
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    // Closed box mesh centred at the origin
+    fn box_mesh(w: f64, h: f64, d: f64) -> (Vec<f64>, Vec<u32>) {
+        let (x, y, z) = (w / 2.0, h / 2.0, d / 2.0);
+        let vertices = vec![
+            -x, -y, -z, x, -y, -z, x, y, -z, -x, y, -z, -x, -y, z, x, -y, z, x, y, z, -x, y, z,
+        ];
+        let indices = vec![
+            0, 2, 1, 0, 3, 2, 4, 5, 6, 4, 6, 7, 0, 1, 5, 0, 5, 4, 2, 3, 7, 2, 7, 6, 0, 4, 7, 0,
+            7, 3, 1, 2, 6, 1, 6, 5,
+        ];
+        (vertices, indices)
+    }
+
+    // Closed washer: n-gon prism with an n-gon bore through it
+    fn washer(r_outer: f64, r_inner: f64, height: f64, n: usize) -> (Vec<f64>, Vec<u32>) {
+        let mut vertices = Vec::new();
+        // Rings: outer-bottom, outer-top, inner-bottom, inner-top
+        for &(r, z) in &[
+            (r_outer, 0.0),
+            (r_outer, height),
+            (r_inner, 0.0),
+            (r_inner, height),
+        ] {
+            for i in 0..n {
+                let a = i as f64 / n as f64 * std::f64::consts::TAU;
+                vertices.extend_from_slice(&[r * a.cos(), r * a.sin(), z]);
+            }
+        }
+
+        let ring = |r: usize, i: usize| (r * n + i % n) as u32;
+        let mut indices = Vec::new();
+        for i in 0..n {
+            // Outer wall, normal pointing out
+            indices.extend_from_slice(&[ring(0, i), ring(0, i + 1), ring(1, i + 1)]);
+            indices.extend_from_slice(&[ring(0, i), ring(1, i + 1), ring(1, i)]);
+            // Inner wall, normal pointing at the axis
+            indices.extend_from_slice(&[ring(2, i), ring(3, i + 1), ring(2, i + 1)]);
+            indices.extend_from_slice(&[ring(2, i), ring(3, i), ring(3, i + 1)]);
+            // Top annulus, normal +z
+            indices.extend_from_slice(&[ring(1, i), ring(1, i + 1), ring(3, i + 1)]);
+            indices.extend_from_slice(&[ring(1, i), ring(3, i + 1), ring(3, i)]);
+            // Bottom annulus, normal -z
+            indices.extend_from_slice(&[ring(0, i), ring(2, i + 1), ring(0, i + 1)]);
+            indices.extend_from_slice(&[ring(0, i), ring(2, i), ring(2, i + 1)]);
+        }
+        (vertices, indices)
+    }
+
+    #[test]
+    fn test_wall_thickness_of_plate() {
+        let (vertices, indices) = box_mesh(50.0, 50.0, 2.0);
+        let report =
+            analyze_mesh_dfm(&vertices, &indices, &MeshDfmOptions::default()).unwrap();
+
+        // The big faces see the 2mm span; min wall is the plate
+        // thickness, not the lateral extent
+        assert!((report.min_wall_thickness - 2.0).abs() < 1e-6);
+        assert!(report.wall_samples > 0);
+        assert!(report.is_closed);
+    }
+
+    #[test]
+    fn test_thin_wall_flagged() {
+        let (vertices, indices) = box_mesh(50.0, 50.0, 0.5);
+        let options = MeshDfmOptions {
+            min_wall_thickness: 1.0,
+            ..MeshDfmOptions::default()
+        };
+        let report = analyze_mesh_dfm(&vertices, &indices, &options).unwrap();
+
+        assert!(report.min_wall_thickness < 1.0);
+        assert!(report.thin_wall_area_fraction > 0.0);
+    }
+
+    #[test]
+    fn test_draft_of_straight_walls() {
+        let (vertices, indices) = box_mesh(10.0, 10.0, 10.0);
+        let report =
+            analyze_mesh_dfm(&vertices, &indices, &MeshDfmOptions::default()).unwrap();
+
+        // Vertical box walls have exactly zero draft relative to +Z
+        assert!(report.min_draft_angle_deg.abs() < 1e-9);
+        assert!(report.undrafted_area_fraction > 0.0);
+    }
+
+    #[test]
+    fn test_hole_detected_in_washer() {
+        let (vertices, indices) = washer(10.0, 3.0, 4.0, 16);
+        let report =
+            analyze_mesh_dfm(&vertices, &indices, &MeshDfmOptions::default()).unwrap();
+
+        assert!(report.is_closed);
+        // Both bore rims (top and bottom) resolve to the same
+        // diameter; the outer rims classify as boss, not hole
+        assert!(!report.holes.is_empty());
+        assert!((report.min_hole_diameter - 6.0).abs() < 0.1);
+        for hole in &report.holes {
+            assert!(hole.center[0].abs() < 1e-6);
+            assert!(hole.center[1].abs() < 1e-6);
+        }
+        // Thinnest span is the 4mm axial wall, not the 7mm radial one
+        assert!((report.min_wall_thickness - 4.0).abs() < 0.5);
+    }
+
+    #[test]
+    fn test_empty_mesh_rejected() {
+        assert!(analyze_mesh_dfm(&[], &[], &MeshDfmOptions::default()).is_err());
+    }
+}
@@ -7,6 +7,8 @@
 
 pub mod bounding_box;
 pub mod mass_props;
+pub mod mesh_dfm;
+pub mod toolpath;
 
 // Re-export core analysis types
 pub use bounding_box::{
@@ -19,6 +21,10 @@ pub use mass_props::{
     MaterialProperties,
 };
 
+pub use mesh_dfm::{analyze_mesh_dfm, DetectedHole, MeshDfmOptions, MeshDfmReport};
+
+pub use toolpath::{ToolpathAnalyzer, ToolpathMetrics};
+
 use crate::errors::KernelResult;
 use crate::geometry::ir::node::{IRNode, NodeId};
 use crate::types::{BoundingBox, PreviewMesh};
@@ -262,14 +268,26 @@ mod tests {
     }
 
     fn create_simple_mesh() -> PreviewMesh {
+        // Closed tetrahedron: mass properties require an enclosed volume
         PreviewMesh {
             vertices: vec![
                 0.0, 0.0, 0.0, // 0
                 1.0, 0.0, 0.0, // 1
                 0.0, 1.0, 0.0, // 2
+                0.0, 0.0, 1.0, // 3
+            ],
+            indices: vec![
+                0, 2, 1, // bottom
+                0, 1, 3, // front
+                0, 3, 2, // left
+                1, 2, 3, // slanted
+            ],
+            normals: vec![
+                0.0, 0.0, -1.0, //
+                0.0, -1.0, 0.0, //
+                -1.0, 0.0, 0.0, //
+                0.577, 0.577, 0.577, //
             ],
-            indices: vec![0, 1, 2],
-            normals: vec![0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0],
         }
     }
 
@@ -322,22 +340,15 @@ mod tests {
         assert_eq!(analysis.surface_area, 52.0); // 2*(2*3 + 2*4 + 3*4)
 
         // Check bounding box
-        assert_eq!(analysis.bounding_box.min_x, -1.0);
-        assert_eq!(analysis.bounding_box.max_x, 1.0);
+        assert_eq!(analysis.bounding_box.min[0], -1.0);
+        assert_eq!(analysis.bounding_box.max[0], 1.0);
     }
 
     #[test]
     fn test_analysis_freshness() {
         let mut analysis = GeometricAnalysis::new(
             crate::geometry::ir::node::NodeId::from_user_string("test"),
-            BoundingBox {
-                min_x: 0.0,
-                max_x: 1.0,
-                min_y: 0.0,
-                max_y: 1.0,
-                min_z: 0.0,
-                max_z: 1.0,
-            },
+            BoundingBox::new([0.0, 0.0, 0.0], [1.0, 1.0, 1.0]),
             MassProperties::zero(),
         );
 
@@ -345,7 +345,8 @@ fn bbox_volume(bbox: &BoundingBox) -> f64 {
 #[cfg(test)]
 mod tests {
     use super::*;
-    use crate::geometry::primitives::{Box as BoxPrimitive, Primitive};
+    use crate::geometry::primitives::Box as BoxPrimitive;
+    use crate::geometry::Primitive;
 
     #[test]
     fn test_validate_empty_mesh() {
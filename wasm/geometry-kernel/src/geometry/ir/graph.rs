@@ -23,6 +23,14 @@ pub struct IRGraph {
     /// Cached topological order
     cached_order: Option<Vec<NodeId>>,
 
+    /// Nodes whose geometry is stale and needs re-evaluation
+    ///
+    /// Marking a node dirty propagates through `forward_deps`, so the
+    /// set always covers the full affected subtree; everything outside
+    /// it can splice its cached result on the next compile.
+    #[serde(default)]
+    dirty: HashSet<NodeId>,
+
     /// Graph modification counter for cache invalidation
     modification_count: u64,
 }
@@ -35,6 +43,7 @@ impl IRGraph {
             forward_deps: HashMap::new(),
             reverse_deps: HashMap::new(),
             cached_order: None,
+            dirty: HashSet::new(),
             modification_count: 0,
         }
     }
@@ -81,9 +90,12 @@ impl IRGraph {
         }
 
         // Add the node
-        self.nodes.insert(node_id, node);
+        self.nodes.insert(node_id.clone(), node);
         self.invalidate_cache();
 
+        // A new or updated node is stale, as is everything built on it
+        self.mark_dirty(&node_id);
+
         Ok(())
     }
 
@@ -118,6 +130,7 @@ impl IRGraph {
 
         self.forward_deps.remove(node_id);
         self.nodes.remove(node_id);
+        self.dirty.remove(node_id);
         self.invalidate_cache();
 
         Ok(())
@@ -129,13 +142,48 @@ impl IRGraph {
     }
 
     /// Get mutable reference to a node by ID
+    ///
+    /// The node and its transitive dependents are marked dirty, since
+    /// the caller may mutate content the downstream geometry depends on.
     pub fn get_node_mut(&mut self, node_id: &NodeId) -> Option<&mut IRNode> {
         if self.nodes.contains_key(node_id) {
             self.invalidate_cache();
+            self.mark_dirty(&node_id.clone());
         }
         self.nodes.get_mut(node_id)
     }
 
+    /// Mark a node and all its transitive dependents as dirty
+    pub fn mark_dirty(&mut self, node_id: &NodeId) {
+        let mut queue = VecDeque::new();
+        queue.push_back(node_id.clone());
+
+        while let Some(current) = queue.pop_front() {
+            if self.dirty.insert(current.clone()) {
+                if let Some(dependents) = self.forward_deps.get(&current) {
+                    for dependent_id in dependents {
+                        queue.push_back(dependent_id.clone());
+                    }
+                }
+            }
+        }
+    }
+
+    /// Get the set of dirty nodes awaiting re-evaluation
+    pub fn dirty_nodes(&self) -> &HashSet<NodeId> {
+        &self.dirty
+    }
+
+    /// Check whether any node needs re-evaluation
+    pub fn has_dirty_nodes(&self) -> bool {
+        !self.dirty.is_empty()
+    }
+
+    /// Clear all dirty flags after a successful re-evaluation
+    pub fn mark_clean(&mut self) {
+        self.dirty.clear();
+    }
+
     /// Get all nodes in the graph
     pub fn nodes(&self) -> &HashMap<NodeId, IRNode> {
         &self.nodes
@@ -311,6 +359,7 @@ impl IRGraph {
             edge_count,
             root_count,
             leaf_count,
+            dirty_count: self.dirty.len(),
             max_depth,
             avg_dependencies,
         }
@@ -620,6 +669,8 @@ pub struct GraphStats {
     pub edge_count: usize,
     pub root_count: usize,
     pub leaf_count: usize,
+    #[serde(default)]
+    pub dirty_count: usize,
     pub max_depth: usize,
     pub avg_dependencies: f64,
 }
@@ -735,6 +786,66 @@ mod tests {
         assert_eq!(*leaves[0], leaf_id);
     }
 
+    #[test]
+    fn test_dirty_propagation_to_dependents() {
+        let mut graph = IRGraph::new();
+
+        // Chain: A -> B -> C, plus unrelated D
+        let node_a = create_test_node("A", vec![]);
+        let id_a = node_a.id.clone();
+        graph.add_node(node_a).unwrap();
+
+        let node_b = create_test_node("B", vec![id_a.clone()]);
+        let id_b = node_b.id.clone();
+        graph.add_node(node_b).unwrap();
+
+        let node_c = create_test_node("C", vec![id_b.clone()]);
+        let id_c = node_c.id.clone();
+        graph.add_node(node_c).unwrap();
+
+        let node_d = create_test_node("D", vec![]);
+        let id_d = node_d.id.clone();
+        graph.add_node(node_d).unwrap();
+
+        graph.mark_clean();
+        assert!(!graph.has_dirty_nodes());
+
+        // Editing A dirties A, B, C but not the unrelated D
+        graph.mark_dirty(&id_a);
+        assert!(graph.dirty_nodes().contains(&id_a));
+        assert!(graph.dirty_nodes().contains(&id_b));
+        assert!(graph.dirty_nodes().contains(&id_c));
+        assert!(!graph.dirty_nodes().contains(&id_d));
+    }
+
+    #[test]
+    fn test_add_node_marks_dirty() {
+        let mut graph = IRGraph::new();
+
+        let node = create_test_node("node1", vec![]);
+        let node_id = node.id.clone();
+        graph.add_node(node).unwrap();
+
+        assert!(graph.dirty_nodes().contains(&node_id));
+        assert_eq!(graph.stats().dirty_count, 1);
+
+        graph.mark_clean();
+        assert_eq!(graph.stats().dirty_count, 0);
+    }
+
+    #[test]
+    fn test_get_node_mut_marks_dirty() {
+        let mut graph = IRGraph::new();
+
+        let node = create_test_node("node1", vec![]);
+        let node_id = node.id.clone();
+        graph.add_node(node).unwrap();
+        graph.mark_clean();
+
+        let _ = graph.get_node_mut(&node_id);
+        assert!(graph.dirty_nodes().contains(&node_id));
+    }
+
     #[test]
     fn test_subgraph_extraction() {
         let mut graph = IRGraph::new();
@@ -29,7 +29,7 @@
 //!
 //! # Usage Example
 //!
-//! ```rust
+//! ```rust,ignore
 //! use crate::geometry::ir::{IRGraph, IRNode, NodeType, NodeContent};
 //!
 //! // Create a new IR graph
@@ -327,7 +327,6 @@ mod tests {
     #[test]
     fn test_node_id_deterministic() {
         let content_hash = "abc123";
-        let deps = vec![];
 
         let id1 = NodeId::new("primitive", content_hash, &[]);
         let id2 = NodeId::new("primitive", content_hash, &[]);
@@ -156,7 +156,8 @@ pub fn boxes_overlap_significantly(
 #[cfg(test)]
 mod tests {
     use super::*;
-    use crate::geometry::primitives::{Box as BoxPrimitive, Primitive};
+    use crate::geometry::primitives::Box as BoxPrimitive;
+    use crate::geometry::Primitive;
 
     #[test]
     fn test_union_meshes() {
@@ -182,8 +183,8 @@ mod tests {
     #[test]
     fn test_boxes_overlap_significantly() {
         let bbox1 = BoundingBox::new([0.0, 0.0, 0.0], [1.0, 1.0, 1.0]);
-        let bbox2 = BoundingBox::new([0.9, 0.9, 0.9], [1.9, 1.9, 1.9]);
-        let bbox3 = BoundingBox::new([0.0, 0.0, 0.0], [0.01, 0.01, 0.01]);
+        let bbox2 = BoundingBox::new([0.5, 0.5, 0.5], [1.5, 1.5, 1.5]);
+        let bbox3 = BoundingBox::new([0.99, 0.99, 0.99], [1.99, 1.99, 1.99]);
 
         // Significant overlap
         assert!(boxes_overlap_significantly(&bbox1, &bbox2, 0.1));
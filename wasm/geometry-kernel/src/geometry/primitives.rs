@@ -1,7 +1,11 @@
 //! Primitive solid generation with deterministic topology.
 //!
 //! All primitives generate consistent vertex ordering and face
-//! orientation for reliable boolean operations.
+//! orientation for reliable boolean operations. Tessellators emit
+//! welded, indexed meshes: corners shared by coplanar triangles are
+//! stored once, and smooth surfaces carry per-vertex normals so
+//! adjacent facets share their ring vertices. Vertices only split
+//! where a hard edge needs distinct normals (box corners, cap rims).
 
 use crate::geometry::{constants, Primitive, apply_transform_to_point, apply_transform_to_normal, compute_face_normal};
 use crate::types::{BoundingBox, PreviewMesh, PrimitiveType};
@@ -11,6 +15,70 @@ use std::collections::HashMap;
 /// Local Transform alias for primitives
 type Transform = crate::types::Transform;
 
+/// Welding resolution for positions (model units)
+const WELD_EPS: f64 = 1e-6;
+/// Welding resolution for normals; coarser than positions so
+/// floating-point jitter on a smooth surface still merges
+const NORMAL_WELD_EPS: f64 = 1e-3;
+
+/// Accumulates an indexed mesh, sharing vertices through a quantized
+/// (position, normal) hash. Keying on the normal as well keeps hard
+/// edges split — a box corner holds one vertex per meeting face —
+/// while smooth surfaces reuse their ring vertices across facets.
+struct MeshWelder {
+    mesh: PreviewMesh,
+    shared: HashMap<([i64; 3], [i64; 3]), u32>,
+}
+
+impl MeshWelder {
+    fn new() -> Self {
+        MeshWelder {
+            mesh: PreviewMesh::new(),
+            shared: HashMap::new(),
+        }
+    }
+
+    fn quantize(v: [f64; 3], eps: f64) -> [i64; 3] {
+        [
+            (v[0] / eps).round() as i64,
+            (v[1] / eps).round() as i64,
+            (v[2] / eps).round() as i64,
+        ]
+    }
+
+    /// Index of the welded vertex, inserting on first sight
+    fn vertex(&mut self, position: [f64; 3], normal: [f64; 3]) -> u32 {
+        let key = (
+            Self::quantize(position, WELD_EPS),
+            Self::quantize(normal, NORMAL_WELD_EPS),
+        );
+        if let Some(&index) = self.shared.get(&key) {
+            return index;
+        }
+        let index = (self.mesh.vertices.len() / 3) as u32;
+        self.mesh.vertices.extend_from_slice(&[
+            position[0] as f32,
+            position[1] as f32,
+            position[2] as f32,
+        ]);
+        self.mesh.normals.extend_from_slice(&[
+            normal[0] as f32,
+            normal[1] as f32,
+            normal[2] as f32,
+        ]);
+        self.shared.insert(key, index);
+        index
+    }
+
+    fn triangle(&mut self, a: u32, b: u32, c: u32) {
+        self.mesh.indices.extend_from_slice(&[a, b, c]);
+    }
+
+    fn finish(self) -> PreviewMesh {
+        self.mesh
+    }
+}
+
 /// Box primitive
 #[derive(Debug, Clone)]
 pub struct Box {
@@ -57,7 +125,7 @@ impl Box {
 
 impl Primitive for Box {
     fn to_mesh(&self, _subdivisions: u32) -> PreviewMesh {
-        let mut mesh = PreviewMesh::new();
+        let mut welder = MeshWelder::new();
         let identity = Transform::identity();
         let transform = self.transform.as_ref().unwrap_or(&identity);
 
@@ -94,46 +162,21 @@ impl Primitive for Box {
             .map(|c| apply_transform_to_point(*c, transform))
             .collect();
 
-        // Generate vertices and indices
-        let mut vertex_offset = mesh.vertices.len() as u32 / 3;
-
+        // Each face welds its quad to 4 vertices shared by both
+        // triangles; faces stay split from each other at the hard
+        // edges (distinct normals), giving 24 vertices total
         for (face_indices, face_normal) in &faces {
             let normal = apply_transform_to_normal(*face_normal, transform);
+            let quad: Vec<u32> = face_indices
+                .iter()
+                .map(|&c| welder.vertex(transformed_corners[c], normal))
+                .collect();
 
-            // Two triangles per face (triangulate quad)
-            // Triangle 1: 0, 1, 2
-            // Triangle 2: 0, 2, 3
-
-            for tri in [0, 1] {
-                let idx0 = face_indices[tri];
-                let idx1 = face_indices[tri + 1];
-                let idx2 = face_indices[tri + 2];
-
-                let v0 = transformed_corners[idx0];
-                let v1 = transformed_corners[idx1];
-                let v2 = transformed_corners[idx2];
-
-                mesh.vertices.extend_from_slice(&[
-                    v0[0] as f32, v0[1] as f32, v0[2] as f32,
-                    v1[0] as f32, v1[1] as f32, v1[2] as f32,
-                    v2[0] as f32, v2[1] as f32, v2[2] as f32,
-                ]);
-
-                mesh.normals.extend_from_slice(&[
-                    normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                    normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                    normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                ]);
-
-                mesh.indices.extend_from_slice(&[
-                    vertex_offset, vertex_offset + 1, vertex_offset + 2,
-                ]);
-
-                vertex_offset += 3;
-            }
+            welder.triangle(quad[0], quad[1], quad[2]);
+            welder.triangle(quad[0], quad[2], quad[3]);
         }
 
-        mesh
+        welder.finish()
     }
 
     fn bounding_box(&self) -> BoundingBox {
@@ -203,23 +246,23 @@ impl Cylinder {
 
 impl Primitive for Cylinder {
     fn to_mesh(&self, subdivisions: u32) -> PreviewMesh {
-        let mut mesh = PreviewMesh::new();
+        let mut welder = MeshWelder::new();
         let identity = Transform::identity();
         let transform = self.transform.as_ref().unwrap_or(&identity);
 
         let segments = subdivisions.max(8) as usize;
         let h = self.height / 2.0;
 
-        // Generate vertices
-        let mut vertex_offset = mesh.vertices.len() as u32 / 3;
-
         // Top and bottom center vertices
         let top_center = apply_transform_to_point([0.0, h, 0.0], transform);
         let bottom_center = apply_transform_to_point([0.0, -h, 0.0], transform);
 
-        // Side vertices
+        // Ring positions and per-vertex radial normals; each ring
+        // vertex is shared by the two side quads meeting at it, which
+        // both welds the geometry and shades the barrel smoothly
         let mut top_vertices = Vec::new();
         let mut bottom_vertices = Vec::new();
+        let mut side_normals = Vec::new();
 
         for i in 0..segments {
             let angle = 2.0 * std::f64::consts::PI * (i as f64) / (segments as f64);
@@ -237,92 +280,46 @@ impl Primitive for Cylinder {
 
             top_vertices.push(top);
             bottom_vertices.push(bottom);
+            side_normals.push(apply_transform_to_normal([cos_a, 0.0, sin_a], transform));
         }
 
-        // Top cap
+        let top_normal = apply_transform_to_normal([0.0, 1.0, 0.0], transform);
+        let bottom_normal = apply_transform_to_normal([0.0, -1.0, 0.0], transform);
+        let top_center_v = welder.vertex(top_center, top_normal);
+        let bottom_center_v = welder.vertex(bottom_center, bottom_normal);
+
+        // Top cap (wound counter-clockwise seen from +Y so the face points
+        // outward; mixed winding breaks signed-volume analysis). The rim
+        // stays split from the side ring because the cap normal differs.
         for i in 0..segments {
             let next = (i + 1) % segments;
-
-            mesh.vertices.extend_from_slice(&[
-                top_center[0] as f32, top_center[1] as f32, top_center[2] as f32,
-                top_vertices[i][0] as f32, top_vertices[i][1] as f32, top_vertices[i][2] as f32,
-                top_vertices[next][0] as f32, top_vertices[next][1] as f32, top_vertices[next][2] as f32,
-            ]);
-
-            let normal = apply_transform_to_normal([0.0, 1.0, 0.0], transform);
-            mesh.normals.extend_from_slice(&[
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-            ]);
-
-            mesh.indices.extend_from_slice(&[vertex_offset, vertex_offset + 1, vertex_offset + 2]);
-            vertex_offset += 3;
+            let a = welder.vertex(top_vertices[next], top_normal);
+            let b = welder.vertex(top_vertices[i], top_normal);
+            welder.triangle(top_center_v, a, b);
         }
 
-        // Bottom cap
+        // Bottom cap (clockwise seen from +Y, i.e. outward-facing -Y)
         for i in 0..segments {
             let next = (i + 1) % segments;
-
-            mesh.vertices.extend_from_slice(&[
-                bottom_center[0] as f32, bottom_center[1] as f32, bottom_center[2] as f32,
-                bottom_vertices[next][0] as f32, bottom_vertices[next][1] as f32, bottom_vertices[next][2] as f32,
-                bottom_vertices[i][0] as f32, bottom_vertices[i][1] as f32, bottom_vertices[i][2] as f32,
-            ]);
-
-            let normal = apply_transform_to_normal([0.0, -1.0, 0.0], transform);
-            mesh.normals.extend_from_slice(&[
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-            ]);
-
-            mesh.indices.extend_from_slice(&[vertex_offset, vertex_offset + 1, vertex_offset + 2]);
-            vertex_offset += 3;
+            let a = welder.vertex(bottom_vertices[i], bottom_normal);
+            let b = welder.vertex(bottom_vertices[next], bottom_normal);
+            welder.triangle(bottom_center_v, a, b);
         }
 
-        // Side faces
+        // Side faces with smooth per-vertex normals
         for i in 0..segments {
             let next = (i + 1) % segments;
 
-            let v0 = bottom_vertices[i];
-            let v1 = top_vertices[i];
-            let v2 = top_vertices[next];
-            let v3 = bottom_vertices[next];
-
-            mesh.vertices.extend_from_slice(&[
-                v0[0] as f32, v0[1] as f32, v0[2] as f32,
-                v1[0] as f32, v1[1] as f32, v1[2] as f32,
-                v2[0] as f32, v2[1] as f32, v2[2] as f32,
-                v0[0] as f32, v0[1] as f32, v0[2] as f32,
-                v2[0] as f32, v2[1] as f32, v2[2] as f32,
-                v3[0] as f32, v3[1] as f32, v3[2] as f32,
-            ]);
-
-            // Compute normal from direction vector
-            let angle = 2.0 * std::f64::consts::PI * (i as f64) / (segments as f64);
-            let nx = angle.cos();
-            let nz = angle.sin();
-            let normal = apply_transform_to_normal([nx, 0.0, nz], transform);
-
-            mesh.normals.extend_from_slice(&[
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-            ]);
-
-            mesh.indices.extend_from_slice(&[
-                vertex_offset, vertex_offset + 1, vertex_offset + 2,
-                vertex_offset + 3, vertex_offset + 4, vertex_offset + 5,
-            ]);
-
-            vertex_offset += 6;
+            let b0 = welder.vertex(bottom_vertices[i], side_normals[i]);
+            let t0 = welder.vertex(top_vertices[i], side_normals[i]);
+            let t1 = welder.vertex(top_vertices[next], side_normals[next]);
+            let b1 = welder.vertex(bottom_vertices[next], side_normals[next]);
+
+            welder.triangle(b0, t0, t1);
+            welder.triangle(b0, t1, b1);
         }
 
-        mesh
+        welder.finish()
     }
 
     fn bounding_box(&self) -> BoundingBox {
@@ -503,87 +500,71 @@ impl Cone {
 
 impl Primitive for Cone {
     fn to_mesh(&self, subdivisions: u32) -> PreviewMesh {
-        let mut mesh = PreviewMesh::new();
+        let mut welder = MeshWelder::new();
         let identity = Transform::identity();
         let transform = self.transform.as_ref().unwrap_or(&identity);
 
         let segments = subdivisions.max(8) as usize;
         let h = self.height;
+        let slope = self.radius / self.height;
 
-        let mut vertex_offset = mesh.vertices.len() as u32 / 3;
-
-        // Apex vertex
         let apex = apply_transform_to_point([0.0, h / 2.0, 0.0], transform);
         let bottom_center = apply_transform_to_point([0.0, -h / 2.0, 0.0], transform);
 
-        // Bottom vertices
+        // Base ring positions and the smooth side normal at each
+        // (outward and tilted up by the slope)
         let mut bottom_vertices = Vec::new();
+        let mut side_normals = Vec::new();
+        let norm_len = (1.0 + slope * slope).sqrt();
         for i in 0..segments {
             let angle = 2.0 * std::f64::consts::PI * (i as f64) / (segments as f64);
             let cos_a = angle.cos();
             let sin_a = angle.sin();
 
-            let bottom = apply_transform_to_point(
+            bottom_vertices.push(apply_transform_to_point(
                 [self.radius * cos_a, -h / 2.0, self.radius * sin_a],
                 transform,
-            );
-            bottom_vertices.push(bottom);
+            ));
+            side_normals.push(apply_transform_to_normal(
+                [cos_a / norm_len, slope / norm_len, sin_a / norm_len],
+                transform,
+            ));
         }
 
-        // Side faces
+        // Base cap (outward-facing -Y); the rim stays split from the
+        // slanted side ring because the normals differ
+        let bottom_normal = apply_transform_to_normal([0.0, -1.0, 0.0], transform);
+        let bottom_center_v = welder.vertex(bottom_center, bottom_normal);
         for i in 0..segments {
             let next = (i + 1) % segments;
-
-            mesh.vertices.extend_from_slice(&[
-                bottom_center[0] as f32, bottom_center[1] as f32, bottom_center[2] as f32,
-                bottom_vertices[next][0] as f32, bottom_vertices[next][1] as f32, bottom_vertices[next][2] as f32,
-                bottom_vertices[i][0] as f32, bottom_vertices[i][1] as f32, bottom_vertices[i][2] as f32,
-            ]);
-
-            let normal = apply_transform_to_normal([0.0, -1.0, 0.0], transform);
-            mesh.normals.extend_from_slice(&[
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-            ]);
-
-            mesh.indices.extend_from_slice(&[vertex_offset, vertex_offset + 1, vertex_offset + 2]);
-            vertex_offset += 3;
+            let a = welder.vertex(bottom_vertices[i], bottom_normal);
+            let b = welder.vertex(bottom_vertices[next], bottom_normal);
+            welder.triangle(bottom_center_v, a, b);
         }
 
-        // Cone sides
+        // Cone sides: base vertices shade smoothly around the ring;
+        // the apex gets one vertex per segment (normal at the facet's
+        // mid-angle) since a tip has no single smooth normal
         for i in 0..segments {
             let next = (i + 1) % segments;
 
-            mesh.vertices.extend_from_slice(&[
-                apex[0] as f32, apex[1] as f32, apex[2] as f32,
-                bottom_vertices[i][0] as f32, bottom_vertices[i][1] as f32, bottom_vertices[i][2] as f32,
-                bottom_vertices[next][0] as f32, bottom_vertices[next][1] as f32, bottom_vertices[next][2] as f32,
-            ]);
+            let mid_angle = 2.0 * std::f64::consts::PI * (i as f64 + 0.5) / (segments as f64);
+            let apex_normal = apply_transform_to_normal(
+                [
+                    mid_angle.cos() / norm_len,
+                    slope / norm_len,
+                    mid_angle.sin() / norm_len,
+                ],
+                transform,
+            );
 
-            // Compute normal for side face
-            let angle = 2.0 * std::f64::consts::PI * (i as f64) / (segments as f64);
-            let nx = angle.cos();
-            let nz = angle.sin();
-
-            // Normal for cone side points outward and upward
-            let slope = self.radius / self.height;
-            let ny = slope;
-            let len = (nx * nx + ny * ny + nz * nz).sqrt();
-            let mut normal = [nx / len, ny / len, nz / len];
-            normal = apply_transform_to_normal(normal, transform);
-
-            mesh.normals.extend_from_slice(&[
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-                normal[0] as f32, normal[1] as f32, normal[2] as f32,
-            ]);
-
-            mesh.indices.extend_from_slice(&[vertex_offset, vertex_offset + 1, vertex_offset + 2]);
-            vertex_offset += 3;
+            let tip = welder.vertex(apex, apex_normal);
+            let a = welder.vertex(bottom_vertices[next], side_normals[next]);
+            let b = welder.vertex(bottom_vertices[i], side_normals[i]);
+            welder.triangle(tip, a, b);
         }
 
-        mesh
+        welder.finish()
     }
 
     fn bounding_box(&self) -> BoundingBox {
@@ -751,3 +732,72 @@ pub fn create_primitive(
         PrimitiveType::Torus => Ok(std::boxed::Box::new(Torus::from_params(params)?)),
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    // Signed volume via the divergence theorem; positive only when
+    // every triangle is wound outward
+    fn signed_volume(mesh: &PreviewMesh) -> f64 {
+        let mut volume = 0.0;
+        for tri in mesh.indices.chunks_exact(3) {
+            let p = |i: u32| -> [f64; 3] {
+                let v = i as usize * 3;
+                [
+                    mesh.vertices[v] as f64,
+                    mesh.vertices[v + 1] as f64,
+                    mesh.vertices[v + 2] as f64,
+                ]
+            };
+            let (a, b, c) = (p(tri[0]), p(tri[1]), p(tri[2]));
+            volume += a[0] * (b[1] * c[2] - b[2] * c[1])
+                - a[1] * (b[0] * c[2] - b[2] * c[0])
+                + a[2] * (b[0] * c[1] - b[1] * c[0]);
+        }
+        volume / 6.0
+    }
+
+    #[test]
+    fn test_box_welds_to_24_vertices() {
+        let mesh = Box::new(2.0, 3.0, 4.0).to_mesh(16);
+
+        // 4 vertices per face, split at hard edges: 24, not 36
+        assert_eq!(mesh.vertices.len() / 3, 24);
+        assert_eq!(mesh.indices.len() / 3, 12);
+        assert_eq!(mesh.normals.len(), mesh.vertices.len());
+        assert!((signed_volume(&mesh) - 24.0).abs() < 1e-3);
+    }
+
+    #[test]
+    fn test_cylinder_welds_side_ring() {
+        let segments = 32;
+        let mesh = Cylinder::new(5.0, 10.0).to_mesh(segments);
+
+        // 2 centers + 2 cap rims + 2 smooth side rings; the old soup
+        // output carried 12 vertices per segment
+        assert_eq!(mesh.vertices.len() / 3, (4 * segments + 2) as usize);
+        assert_eq!(mesh.indices.len() / 3, (4 * segments) as usize);
+        assert!(signed_volume(&mesh) > 0.0);
+    }
+
+    #[test]
+    fn test_cone_is_outward_oriented() {
+        let mesh = Cone::new(3.0, 6.0).to_mesh(64);
+
+        let volume = signed_volume(&mesh);
+        let expected = std::f64::consts::PI * 3.0 * 3.0 * 6.0 / 3.0;
+        assert!(volume > 0.0, "cone winding must face outward");
+        // Tessellated volume approaches pi*r^2*h/3 from below
+        assert!((volume - expected).abs() / expected < 0.01);
+    }
+
+    #[test]
+    fn test_welded_normals_are_unit_length() {
+        let mesh = Cylinder::new(2.0, 4.0).to_mesh(16);
+        for n in mesh.normals.chunks_exact(3) {
+            let len = (n[0] * n[0] + n[1] * n[1] + n[2] * n[2]).sqrt();
+            assert!((len - 1.0).abs() < 1e-4);
+        }
+    }
+}
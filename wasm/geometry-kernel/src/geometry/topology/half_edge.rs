@@ -0,0 +1,372 @@
+//! Arena-backed half-edge mesh for adjacency queries.
+//!
+//! The string-keyed structures in `edge.rs`/`face.rs` model design
+//! intent; they are too allocation-heavy to answer the adjacency
+//! questions a fillet or chamfer asks ("which faces meet at this
+//! edge, at what angle, and what is the one-ring of this vertex?") at
+//! interactive rates. `HalfEdgeMesh` stores every entity in a flat
+//! arena — one `Vec` per entity type, `u32` handles, no per-entity
+//! allocation — so traversals walk contiguous memory, and building
+//! the structure from a tessellated index buffer is a single pass.
+
+use crate::errors::{KernelError, KernelResult};
+use std::collections::HashMap;
+
+/// Sentinel handle: "no entity" (boundary twin, unset references)
+pub const INVALID_HANDLE: u32 = u32::MAX;
+
+/// Vertex record: position plus one outgoing half-edge
+#[derive(Debug, Clone, Copy)]
+pub struct HeVertex {
+    pub position: [f64; 3],
+    /// One half-edge leaving this vertex (INVALID_HANDLE if isolated)
+    pub half_edge: u32,
+}
+
+/// Half-edge record: directed edge bordering one face
+#[derive(Debug, Clone, Copy)]
+pub struct HeHalfEdge {
+    /// Vertex this half-edge points away from
+    pub origin: u32,
+    /// Opposite half-edge (INVALID_HANDLE on a boundary)
+    pub twin: u32,
+    /// Next half-edge around the same face (counter-clockwise)
+    pub next: u32,
+    /// Face this half-edge borders
+    pub face: u32,
+}
+
+/// Face record: one of its bordering half-edges
+#[derive(Debug, Clone, Copy)]
+pub struct HeFace {
+    pub half_edge: u32,
+}
+
+/// Half-edge mesh over index-based arenas.
+#[derive(Debug, Clone)]
+pub struct HalfEdgeMesh {
+    pub vertices: Vec<HeVertex>,
+    pub half_edges: Vec<HeHalfEdge>,
+    pub faces: Vec<HeFace>,
+}
+
+impl HalfEdgeMesh {
+    /// Builds the half-edge structure from flat tessellation buffers
+    /// (xyz positions and triangle indices) in a single pass.
+    ///
+    /// Twins are resolved through a directed-edge map while faces are
+    /// inserted; an edge used twice in the same direction means the
+    /// mesh is non-manifold and construction fails.
+    pub fn from_buffers(positions: &[f64], indices: &[u32]) -> KernelResult<Self> {
+        if positions.len() % 3 != 0 {
+            return Err(KernelError::internal(
+                "Vertex buffer length must be a multiple of 3".to_string(),
+            ));
+        }
+        if indices.len() % 3 != 0 {
+            return Err(KernelError::internal(
+                "Index buffer length must be a multiple of 3".to_string(),
+            ));
+        }
+
+        let vertex_count = positions.len() / 3;
+        let face_count = indices.len() / 3;
+
+        let mut vertices: Vec<HeVertex> = (0..vertex_count)
+            .map(|i| HeVertex {
+                position: [positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]],
+                half_edge: INVALID_HANDLE,
+            })
+            .collect();
+
+        let mut half_edges: Vec<HeHalfEdge> = Vec::with_capacity(face_count * 3);
+        let mut faces: Vec<HeFace> = Vec::with_capacity(face_count);
+
+        // (origin, destination) -> half-edge handle, for twin linking
+        let mut directed: HashMap<(u32, u32), u32> = HashMap::with_capacity(face_count * 3);
+
+        for f in 0..face_count {
+            let tri = [indices[f * 3], indices[f * 3 + 1], indices[f * 3 + 2]];
+            for &v in &tri {
+                if v as usize >= vertex_count {
+                    return Err(KernelError::internal(format!(
+                        "Face {} references vertex {} outside the vertex buffer",
+                        f, v
+                    )));
+                }
+            }
+
+            let base = half_edges.len() as u32;
+            faces.push(HeFace { half_edge: base });
+
+            for k in 0..3u32 {
+                let origin = tri[k as usize];
+                let dest = tri[((k + 1) % 3) as usize];
+                let handle = base + k;
+
+                if directed.insert((origin, dest), handle).is_some() {
+                    return Err(KernelError::internal(format!(
+                        "Non-manifold input: directed edge {}->{} appears twice",
+                        origin, dest
+                    )));
+                }
+
+                // Twin may already exist from an earlier face
+                let twin = directed.get(&(dest, origin)).copied().unwrap_or(INVALID_HANDLE);
+                if twin != INVALID_HANDLE {
+                    half_edges[twin as usize].twin = handle;
+                }
+
+                half_edges.push(HeHalfEdge {
+                    origin,
+                    twin,
+                    next: base + (k + 1) % 3,
+                    face: f as u32,
+                });
+
+                if vertices[origin as usize].half_edge == INVALID_HANDLE {
+                    vertices[origin as usize].half_edge = handle;
+                }
+            }
+        }
+
+        Ok(HalfEdgeMesh {
+            vertices,
+            half_edges,
+            faces,
+        })
+    }
+
+    /// Vertex the half-edge points at
+    pub fn destination(&self, he: u32) -> u32 {
+        self.half_edges[self.half_edges[he as usize].next as usize].origin
+    }
+
+    /// The three half-edges bordering a face, in order
+    pub fn face_half_edges(&self, face: u32) -> [u32; 3] {
+        let first = self.faces[face as usize].half_edge;
+        let second = self.half_edges[first as usize].next;
+        let third = self.half_edges[second as usize].next;
+        [first, second, third]
+    }
+
+    /// Unit normal of a face (None for degenerate triangles)
+    pub fn face_normal(&self, face: u32) -> Option<[f64; 3]> {
+        let [a, b, c] = self.face_half_edges(face);
+        let p0 = self.vertices[self.half_edges[a as usize].origin as usize].position;
+        let p1 = self.vertices[self.half_edges[b as usize].origin as usize].position;
+        let p2 = self.vertices[self.half_edges[c as usize].origin as usize].position;
+
+        let u = [p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]];
+        let v = [p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]];
+        let n = [
+            u[1] * v[2] - u[2] * v[1],
+            u[2] * v[0] - u[0] * v[2],
+            u[0] * v[1] - u[1] * v[0],
+        ];
+        let len = (n[0] * n[0] + n[1] * n[1] + n[2] * n[2]).sqrt();
+        if len > 0.0 {
+            Some([n[0] / len, n[1] / len, n[2] / len])
+        } else {
+            None
+        }
+    }
+
+    /// Half-edges leaving a vertex (its one-ring), walking twin links.
+    ///
+    /// On a boundary vertex the circulation stops at the gap, so the
+    /// ring covers the reachable fan from the stored half-edge.
+    pub fn vertex_ring(&self, vertex: u32) -> Vec<u32> {
+        let start = self.vertices[vertex as usize].half_edge;
+        if start == INVALID_HANDLE {
+            return Vec::new();
+        }
+
+        let mut ring = Vec::new();
+        let mut current = start;
+        loop {
+            ring.push(current);
+
+            // Rotate around the vertex: twin of the previous half-edge
+            let prev = {
+                // next.next in a triangle is the edge entering `vertex`
+                let next = self.half_edges[current as usize].next;
+                self.half_edges[next as usize].next
+            };
+            let twin = self.half_edges[prev as usize].twin;
+            if twin == INVALID_HANDLE || twin == start {
+                break;
+            }
+            current = twin;
+
+            // Defensive bound for corrupt connectivity
+            if ring.len() > self.half_edges.len() {
+                break;
+            }
+        }
+        ring
+    }
+
+    /// The (at most two) faces sharing the undirected edge of `he`
+    pub fn edge_faces(&self, he: u32) -> (u32, u32) {
+        let this_face = self.half_edges[he as usize].face;
+        let twin = self.half_edges[he as usize].twin;
+        let other_face = if twin == INVALID_HANDLE {
+            INVALID_HANDLE
+        } else {
+            self.half_edges[twin as usize].face
+        };
+        (this_face, other_face)
+    }
+
+    /// Dihedral angle across the edge in radians (None on boundaries
+    /// or degenerate faces). 0 means coplanar, PI a knife edge.
+    pub fn dihedral_angle(&self, he: u32) -> Option<f64> {
+        let (f0, f1) = self.edge_faces(he);
+        if f1 == INVALID_HANDLE {
+            return None;
+        }
+        let n0 = self.face_normal(f0)?;
+        let n1 = self.face_normal(f1)?;
+        let d = (n0[0] * n1[0] + n0[1] * n1[1] + n0[2] * n1[2]).clamp(-1.0, 1.0);
+        Some(d.acos())
+    }
+
+    /// Half-edge handles of edges sharper than `angle_radians`, one
+    /// per undirected edge. This is the candidate set a fillet or
+    /// chamfer operates on.
+    pub fn sharp_edges(&self, angle_radians: f64) -> Vec<u32> {
+        let mut sharp = Vec::new();
+        for he in 0..self.half_edges.len() as u32 {
+            let twin = self.half_edges[he as usize].twin;
+            // Visit each undirected edge once
+            if twin != INVALID_HANDLE && twin < he {
+                continue;
+            }
+            if let Some(angle) = self.dihedral_angle(he) {
+                if angle > angle_radians {
+                    sharp.push(he);
+                }
+            }
+        }
+        sharp
+    }
+
+    /// True when every edge has a twin (closed surface, no boundary)
+    pub fn is_closed(&self) -> bool {
+        self.half_edges.iter().all(|he| he.twin != INVALID_HANDLE)
+    }
+
+    /// Number of undirected edges
+    pub fn edge_count(&self) -> usize {
+        let boundary = self
+            .half_edges
+            .iter()
+            .filter(|he| he.twin == INVALID_HANDLE)
+            .count();
+        (self.half_edges.len() - boundary) / 2 + boundary
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    // Unit cube: 8 vertices, 12 triangles, consistently wound
+    fn cube() -> (Vec<f64>, Vec<u32>) {
+        let vertices = vec![
+            -0.5, -0.5, -0.5, 0.5, -0.5, -0.5, 0.5, 0.5, -0.5, -0.5, 0.5, -0.5, -0.5, -0.5, 0.5,
+            0.5, -0.5, 0.5, 0.5, 0.5, 0.5, -0.5, 0.5, 0.5,
+        ];
+        let indices = vec![
+            0, 2, 1, 0, 3, 2, // -z
+            4, 5, 6, 4, 6, 7, // +z
+            0, 1, 5, 0, 5, 4, // -y
+            2, 3, 7, 2, 7, 6, // +y
+            0, 4, 7, 0, 7, 3, // -x
+            1, 2, 6, 1, 6, 5, // +x
+        ];
+        (vertices, indices)
+    }
+
+    #[test]
+    fn test_from_buffers_cube() {
+        let (vertices, indices) = cube();
+        let mesh = HalfEdgeMesh::from_buffers(&vertices, &indices).unwrap();
+
+        assert_eq!(mesh.vertices.len(), 8);
+        assert_eq!(mesh.faces.len(), 12);
+        assert_eq!(mesh.half_edges.len(), 36);
+        // Closed manifold: every half-edge twinned, E = 3F/2
+        assert!(mesh.is_closed());
+        assert_eq!(mesh.edge_count(), 18);
+    }
+
+    #[test]
+    fn test_twin_symmetry() {
+        let (vertices, indices) = cube();
+        let mesh = HalfEdgeMesh::from_buffers(&vertices, &indices).unwrap();
+
+        for he in 0..mesh.half_edges.len() as u32 {
+            let twin = mesh.half_edges[he as usize].twin;
+            assert_ne!(twin, INVALID_HANDLE);
+            assert_eq!(mesh.half_edges[twin as usize].twin, he);
+            // Twin runs the same edge backwards
+            assert_eq!(mesh.half_edges[twin as usize].origin, mesh.destination(he));
+        }
+    }
+
+    #[test]
+    fn test_vertex_ring_covers_incident_faces() {
+        let (vertices, indices) = cube();
+        let mesh = HalfEdgeMesh::from_buffers(&vertices, &indices).unwrap();
+
+        // Every cube corner touches 4 or 5 triangles depending on the
+        // diagonal split; the ring must contain one outgoing half-edge
+        // per incident face
+        for v in 0..8u32 {
+            let ring = mesh.vertex_ring(v);
+            let incident = indices.chunks_exact(3).filter(|t| t.contains(&v)).count();
+            assert_eq!(ring.len(), incident);
+            for &he in &ring {
+                assert_eq!(mesh.half_edges[he as usize].origin, v);
+            }
+        }
+    }
+
+    #[test]
+    fn test_sharp_edges_of_cube() {
+        let (vertices, indices) = cube();
+        let mesh = HalfEdgeMesh::from_buffers(&vertices, &indices).unwrap();
+
+        // The 12 geometric cube edges are 90-degree creases; the 6
+        // face diagonals are coplanar
+        let sharp = mesh.sharp_edges(45f64.to_radians());
+        assert_eq!(sharp.len(), 12);
+        for he in sharp {
+            let angle = mesh.dihedral_angle(he).unwrap();
+            assert!((angle - std::f64::consts::FRAC_PI_2).abs() < 1e-9);
+        }
+    }
+
+    #[test]
+    fn test_open_fan_has_boundary() {
+        // Two triangles sharing one edge: an open strip
+        let vertices = vec![0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0];
+        let indices = vec![0, 1, 2, 2, 1, 3];
+        let mesh = HalfEdgeMesh::from_buffers(&vertices, &indices).unwrap();
+
+        assert!(!mesh.is_closed());
+        assert_eq!(mesh.edge_count(), 5);
+        // The shared edge is coplanar, so no sharp edges at all
+        assert!(mesh.sharp_edges(1f64.to_radians()).is_empty());
+    }
+
+    #[test]
+    fn test_rejects_non_manifold() {
+        // Same directed edge 0->1 in two faces (inconsistent winding)
+        let vertices = vec![0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0];
+        let indices = vec![0, 1, 2, 0, 1, 3];
+        assert!(HalfEdgeMesh::from_buffers(&vertices, &indices).is_err());
+    }
+}
@@ -6,12 +6,14 @@
 
 pub mod edge;
 pub mod face;
+pub mod half_edge;
 pub mod shell;
 pub mod solid;
 
 // Re-export core topology types
 pub use edge::{Edge, EdgeId, EdgeType, HalfEdge};
 pub use face::{Face, FaceId, FaceOrientation, FaceType};
+pub use half_edge::{HalfEdgeMesh, HeFace, HeHalfEdge, HeVertex, INVALID_HANDLE};
 pub use shell::{Shell, ShellId, ShellType};
 pub use solid::{Solid, SolidId, TopologicalSolid};
 
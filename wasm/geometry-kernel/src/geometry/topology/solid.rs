@@ -891,10 +891,10 @@ mod tests {
         let inner_shell_id = ShellId::new("inner".to_string());
         shell_collection.insert(inner_shell_id.clone(), inner_shell);
 
-        let mut solid = Solid::new(outer_shell_id.clone(), SolidType::Solid);
+        let mut solid = Solid::new(outer_shell_id.clone(), SolidType::Simple);
         solid.inner_shells.push(inner_shell_id.clone());
 
-        let calculated_volume = solid.calculate_volume(&shell_collection);
+        let calculated_volume = solid.compute_volume(&shell_collection).unwrap();
 
         // Volume should be outer - inner = 100 - 30 = 70
         assert_eq!(calculated_volume, 70.0);
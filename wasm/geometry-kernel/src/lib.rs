@@ -41,14 +41,18 @@ use wasm_bindgen::prelude::*;
 mod compiler;
 mod errors;
 mod geometry;
-mod hashing;
-mod types;
+mod timing;
+// Public so the criterion bench target can drive them directly
+pub mod hashing;
+pub mod protocol;
+pub mod types;
 
 use compiler::CsgCompiler;
 use errors::KernelError;
 use types::*;
 
 // Import enhanced geometry system
+use geometry::analysis::MassPropertiesAnalyzer;
 use geometry::{
     GeometricAnalyzer, IRGraph, IRNode, IRValidator, MassProperties, MaterialProperties,
     NodeContent, NodeId, NodeType,
@@ -64,6 +68,9 @@ pub struct GeometryKernel {
     ir_graph: IRGraph,
     ir_validator: IRValidator,
     geometric_analyzer: GeometricAnalyzer,
+
+    // Pipeline timing spans for the perf HUD (always on; ring-buffered)
+    spans: timing::SpanRecorder,
 }
 
 #[wasm_bindgen]
@@ -80,6 +87,7 @@ impl GeometryKernel {
             ir_graph: geometry::create_ir_graph(),
             ir_validator: geometry::create_validator(),
             geometric_analyzer: geometry::create_analyzer(),
+            spans: timing::SpanRecorder::new(),
         }
     }
 
@@ -147,19 +155,56 @@ impl GeometryKernel {
         })
     }
 
+    /// Compile a binary-encoded intent to geometry (hot-path interface)
+    ///
+    /// # Arguments
+    /// * `intent_bytes` - Binary `GeometryIR` produced by
+    ///   `lib/geometry/binary-protocol.ts` (see `protocol` module for the
+    ///   wire format)
+    ///
+    /// # Returns
+    /// Binary `CompileResult`. Mesh vertex/index/normal buffers are raw
+    /// little-endian `f32`/`u32` words, so the TypeScript side views them
+    /// as typed arrays without any `JSON.parse`. Always returns a
+    /// decodable buffer — errors come back as an error-status response.
+    #[wasm_bindgen]
+    pub fn compile_intent_binary(&mut self, intent_bytes: &[u8]) -> Vec<u8> {
+        let result = (|| -> Result<Vec<u8>, KernelError> {
+            let t = timing::now_ms();
+            let ir = protocol::decode_geometry_ir(intent_bytes)?;
+            self.spans.record("decode_binary", t);
+
+            let result = self.compiler.compile(&ir)?;
+            self.spans.absorb(self.compiler.take_spans());
+
+            let t = timing::now_ms();
+            let bytes = protocol::encode_compile_result(&result);
+            self.spans.record("encode_binary", t);
+            Ok(bytes)
+        })();
+
+        result.unwrap_or_else(|error| protocol::encode_error_result(&error))
+    }
+
     fn compile_internal(&mut self, intent_json: &str) -> Result<String, KernelError> {
         // Parse JSON input
+        let t = timing::now_ms();
         let ir: GeometryIR = serde_json::from_str(intent_json).map_err(|e| {
             KernelError::invalid_json(format!("Invalid intent JSON: {}", e))
                 .with_context(errors::ErrorContext::new())
         })?;
+        self.spans.record("decode_json", t);
 
         // Compile intent to geometry
         let result = self.compiler.compile(&ir).map_err(|e| e)?;
+        self.spans.absorb(self.compiler.take_spans());
 
         // Serialize result to JSON
-        serde_json::to_string(&result)
-            .map_err(|e| KernelError::internal(format!("Failed to serialize result: {}", e)))
+        let t = timing::now_ms();
+        let json = serde_json::to_string(&result)
+            .map_err(|e| KernelError::internal(format!("Failed to serialize result: {}", e)))?;
+        self.spans.record("encode_json", t);
+        Ok(json)
     }
 
     fn compile_semantic_internal(&mut self, semantic_ir_json: &str) -> Result<String, KernelError> {
@@ -191,11 +236,16 @@ impl GeometryKernel {
             .to_string());
         }
 
+        // Only the dirty subtree needs re-evaluation; nodes outside it
+        // keep their cached results from the previous compile.
+        let dirty_count = self.ir_graph.dirty_nodes().len();
+
         // For now, return a success response with validation results
         // Full semantic compilation will be implemented in subsequent phases
         let response = serde_json::json!({
             "status": "compiled",
             "nodes_processed": input.nodes.len(),
+            "dirty_nodes": dirty_count,
             "validation_result": validation_result,
             "mesh": {
                 "vertices": [],
@@ -205,11 +255,190 @@ impl GeometryKernel {
             "manufacturing_analysis": validation_result.manufacturing_analysis
         });
 
+        // The graph is consistent with the compiled output now
+        self.ir_graph.mark_clean();
+
         serde_json::to_string(&response).map_err(|e| {
             KernelError::internal(format!("Failed to serialize semantic result: {}", e))
         })
     }
 
+    /// Analyze a batch of intents in one boundary crossing
+    ///
+    /// # Arguments
+    /// * `batch_json` - JSON `{"intents": [GeometryIR, ...]}`
+    ///
+    /// # Returns
+    /// JSON `{"results": [...]}` with one entry per intent, in input
+    /// order: `{intent_hash, status, volume, surface_area,
+    /// center_of_mass, bbox_min, bbox_max}` on success or
+    /// `{status: "error", error}` for that entry. A bad intent never
+    /// fails the whole batch.
+    ///
+    /// Compilation goes through the shared compiler, so unchanged
+    /// subtrees hit the evaluator's content-hash mesh cache and one
+    /// analyzer instance serves the whole batch. This is what lets
+    /// quoting and the manufacturability panel use true mesh-derived
+    /// volumes for N parts without N WASM calls.
+    #[wasm_bindgen]
+    pub fn analyze_batch(&mut self, batch_json: &str) -> String {
+        #[derive(serde::Deserialize)]
+        struct BatchInput {
+            intents: Vec<GeometryIR>,
+        }
+
+        let t = timing::now_ms();
+
+        let input: BatchInput = match serde_json::from_str(batch_json) {
+            Ok(input) => input,
+            Err(e) => {
+                return serde_json::json!({
+                    "results": [],
+                    "error": KernelError::invalid_json(format!("Invalid batch JSON: {}", e))
+                })
+                .to_string()
+            }
+        };
+
+        let analyzer = MassPropertiesAnalyzer::new();
+        let mut results = Vec::with_capacity(input.intents.len());
+
+        for ir in &input.intents {
+            results.push(self.analyze_single(ir, &analyzer));
+        }
+
+        self.spans.record("analyze_batch", t);
+
+        serde_json::json!({ "results": results }).to_string()
+    }
+
+    /// Derive mesh-driven toolpath metrics for an intent
+    ///
+    /// # Arguments
+    /// * `intent_json` - JSON string of GeometryIR
+    ///
+    /// # Returns
+    /// JSON `{status, intent_hash, metrics}` where `metrics` carries
+    /// removal volume, silhouette perimeter, projected area, overhang
+    /// area, surface area and max pocket depth (see
+    /// `geometry::analysis::toolpath`). One height-field build serves
+    /// all four process strategies, so comparing CNC, laser, printing
+    /// and sheet metal costs a single call.
+    #[wasm_bindgen]
+    pub fn estimate_toolpath(&mut self, intent_json: &str) -> String {
+        let result = (|| -> Result<String, KernelError> {
+            let ir: GeometryIR = serde_json::from_str(intent_json).map_err(|e| {
+                KernelError::invalid_json(format!("Invalid intent JSON: {}", e))
+            })?;
+
+            let compiled = self.compiler.compile(&ir)?;
+            self.spans.absorb(self.compiler.take_spans());
+            let mesh = compiled
+                .mesh
+                .as_ref()
+                .ok_or_else(|| KernelError::internal("Compile produced no mesh"))?;
+
+            let t = timing::now_ms();
+            let metrics = geometry::analysis::ToolpathAnalyzer::new().analyze_mesh(mesh)?;
+            self.spans.record("toolpath_metrics", t);
+
+            Ok(serde_json::json!({
+                "status": "ok",
+                "intent_hash": compiled.intent_hash,
+                "metrics": metrics,
+            })
+            .to_string())
+        })();
+
+        result.unwrap_or_else(|error| {
+            serde_json::json!({ "status": "error", "error": error }).to_string()
+        })
+    }
+
+    /// Mesh-based manufacturability analysis
+    ///
+    /// # Arguments
+    /// * `request_json` - JSON `{vertices, indices, options?}` where
+    ///   `vertices` is a flat xyz array, `indices` is a triangle index
+    ///   array, and `options` tunes thresholds (see
+    ///   `geometry::analysis::mesh_dfm::MeshDfmOptions`)
+    ///
+    /// # Returns
+    /// JSON `{status, report}` with wall thickness, draft angle and
+    /// hole diameter measurements taken from the actual mesh rather
+    /// than from its nominal parameters. This is what catches thin
+    /// walls in CSG-composed and imported geometry that the
+    /// parametric constraint checks cannot see.
+    #[wasm_bindgen]
+    pub fn analyze_mesh_dfm(&mut self, request_json: &str) -> String {
+        #[derive(serde::Deserialize)]
+        struct DfmInput {
+            vertices: Vec<f64>,
+            indices: Vec<u32>,
+            #[serde(default)]
+            options: geometry::analysis::MeshDfmOptions,
+        }
+
+        let result = (|| -> Result<String, KernelError> {
+            let input: DfmInput = serde_json::from_str(request_json).map_err(|e| {
+                KernelError::invalid_json(format!("Invalid mesh DFM request JSON: {}", e))
+            })?;
+
+            let t = timing::now_ms();
+            let report = geometry::analysis::analyze_mesh_dfm(
+                &input.vertices,
+                &input.indices,
+                &input.options,
+            )?;
+            self.spans.record("mesh_dfm", t);
+
+            Ok(serde_json::json!({
+                "status": "ok",
+                "report": report,
+            })
+            .to_string())
+        })();
+
+        result.unwrap_or_else(|error| {
+            serde_json::json!({ "status": "error", "error": error }).to_string()
+        })
+    }
+
+    fn analyze_single(
+        &mut self,
+        ir: &GeometryIR,
+        analyzer: &MassPropertiesAnalyzer,
+    ) -> serde_json::Value {
+        let entry = (|| -> Result<serde_json::Value, KernelError> {
+            let result = self.compiler.compile(ir)?;
+            let mesh = result
+                .mesh
+                .as_ref()
+                .ok_or_else(|| KernelError::internal("Compile produced no mesh"))?;
+
+            let props = analyzer.analyze_mesh(mesh)?;
+            let bbox = geometry::analysis::compute_bounding_box(mesh);
+
+            Ok(serde_json::json!({
+                "intent_hash": result.intent_hash,
+                "status": "ok",
+                "volume": props.volume,
+                "surface_area": props.surface_area,
+                "center_of_mass": props.center_of_mass,
+                "bbox_min": bbox.min,
+                "bbox_max": bbox.max,
+            }))
+        })();
+
+        entry.unwrap_or_else(|error| {
+            serde_json::json!({
+                "intent_hash": hashing::hash_intent(ir),
+                "status": "error",
+                "error": error,
+            })
+        })
+    }
+
     /// Validate intent without full compilation
     ///
     /// # Arguments
@@ -308,7 +537,7 @@ impl GeometryKernel {
             "name": "qutlas-geometry-kernel",
             "version": env!("CARGO_PKG_VERSION"),
             "rustc": env!("CARGO_PKG_RUST_VERSION"),
-            "features": ["semantic-ir", "manufacturing-constraints", "legacy-compatibility"],
+            "features": ["semantic-ir", "manufacturing-constraints", "legacy-compatibility", "binary-protocol"],
             "architecture": "dual-system",
             "ir_system": "enhanced",
             "legacy_support": true
@@ -336,13 +565,29 @@ impl GeometryKernel {
 
         serde_json::json!({
             "compiler_cache_size": compiler_stats.size,
+            "compiler_cache_hits": compiler_stats.hits,
             "analyzer_cache_total": analyzer_total,
             "analyzer_cache_fresh": analyzer_fresh,
-            "ir_graph_nodes": self.ir_graph.nodes().len()
+            "ir_graph_nodes": self.ir_graph.nodes().len(),
+            "ir_graph_dirty_nodes": self.ir_graph.dirty_nodes().len()
         })
         .to_string()
     }
 
+    /// Drain recorded pipeline timing spans
+    ///
+    /// # Returns
+    /// JSON array of `{name, start_ms, duration_ms}` objects, oldest
+    /// first. Spans are removed once taken; the internal ring buffer
+    /// keeps at most the newest 256 between polls, so an unpolled
+    /// kernel never grows. KernelBridge merges these into the perf HUD
+    /// ring buffer alongside worker-side spans.
+    #[wasm_bindgen]
+    pub fn take_perf_spans(&mut self) -> String {
+        let spans = self.spans.drain();
+        serde_json::to_string(&spans).unwrap_or_else(|_| "[]".to_string())
+    }
+
     /// Set mesh subdivision level
     ///
     /// # Arguments
@@ -444,9 +689,39 @@ mod tests {
         assert_eq!(result1.intent_hash, result2.intent_hash);
     }
 
+    #[test]
+    fn test_compile_intent_binary() {
+        let mut kernel = GeometryKernel::new();
+        let intent = create_simple_box_intent();
+        let intent_bytes = protocol::encode_geometry_ir(&intent);
+
+        let result_bytes = kernel.compile_intent_binary(&intent_bytes);
+        let result = protocol::decode_compile_result(&result_bytes).unwrap();
+
+        assert_eq!(result.status, CompileStatus::Compiled);
+        assert!(result.mesh.is_some());
+
+        // Binary and JSON paths share the compiler, so the second call
+        // hits the cache regardless of encoding
+        let result2_bytes = kernel.compile_intent_binary(&intent_bytes);
+        let result2 = protocol::decode_compile_result(&result2_bytes).unwrap();
+        assert_eq!(result2.status, CompileStatus::Cached);
+        assert_eq!(result2.intent_hash, result.intent_hash);
+    }
+
+    #[test]
+    fn test_compile_intent_binary_error_is_decodable() {
+        let mut kernel = GeometryKernel::new();
+        let result_bytes = kernel.compile_intent_binary(b"not a binary intent");
+        let result = protocol::decode_compile_result(&result_bytes).unwrap();
+
+        assert_eq!(result.status, CompileStatus::Error);
+        assert!(result.error.is_some());
+    }
+
     #[test]
     fn test_validate_valid_intent() {
-        let kernel = GeometryKernel::new();
+        let mut kernel = GeometryKernel::new();
         let intent = create_simple_box_intent();
         let intent_json = serde_json::to_string(&intent).unwrap();
 
@@ -509,6 +784,89 @@ mod tests {
         assert!(result.mesh.is_some());
     }
 
+    #[test]
+    fn test_take_perf_spans() {
+        let mut kernel = GeometryKernel::new();
+        let intent = create_simple_box_intent();
+        let intent_json = serde_json::to_string(&intent).unwrap();
+
+        kernel.compile_intent(&intent_json);
+        let spans_json = kernel.take_perf_spans();
+        let spans: Vec<serde_json::Value> = serde_json::from_str(&spans_json).unwrap();
+
+        let names: Vec<&str> = spans.iter().filter_map(|s| s["name"].as_str()).collect();
+        assert!(names.contains(&"decode_json"));
+        assert!(names.contains(&"evaluate"));
+        assert!(names.contains(&"encode_json"));
+
+        // Drained: polling again yields an empty array
+        let spans_json = kernel.take_perf_spans();
+        assert_eq!(spans_json, "[]");
+    }
+
+    #[test]
+    fn test_analyze_batch() {
+        let mut kernel = GeometryKernel::new();
+
+        let box_intent = create_simple_box_intent();
+        let mut cyl = create_simple_box_intent();
+        cyl.part = "cyl_part".to_string();
+        cyl.operations = vec![Intent::Primitive(PrimitiveIntent {
+            id: "cyl1".to_string(),
+            type_: PrimitiveType::Cylinder,
+            parameters: vec![("radius".to_string(), 5.0), ("height".to_string(), 20.0)]
+                .into_iter()
+                .collect(),
+            transform: None,
+            timestamp: 0.0,
+        })];
+
+        let batch = serde_json::json!({ "intents": [box_intent, cyl] });
+        let result_json = kernel.analyze_batch(&batch.to_string());
+        let result: serde_json::Value = serde_json::from_str(&result_json).unwrap();
+
+        let results = result["results"].as_array().unwrap();
+        assert_eq!(results.len(), 2);
+
+        // Box volume is exact; cylinder is tessellated so only approximate
+        let box_volume = results[0]["volume"].as_f64().unwrap();
+        assert!((box_volume - 1000.0).abs() < 1.0);
+        let cyl_volume = results[1]["volume"].as_f64().unwrap();
+        let expected = std::f64::consts::PI * 5.0 * 5.0 * 20.0;
+        assert!((cyl_volume - expected).abs() / expected < 0.05);
+
+        // AABB of the 10x10x10 box
+        let bbox_min = results[0]["bbox_min"].as_array().unwrap();
+        let bbox_max = results[0]["bbox_max"].as_array().unwrap();
+        for axis in 0..3 {
+            let extent = bbox_max[axis].as_f64().unwrap() - bbox_min[axis].as_f64().unwrap();
+            assert!((extent - 10.0).abs() < 1e-6);
+        }
+    }
+
+    #[test]
+    fn test_analyze_batch_partial_failure() {
+        let mut kernel = GeometryKernel::new();
+
+        let good = create_simple_box_intent();
+        let mut bad = create_simple_box_intent();
+        bad.part = "bad_part".to_string();
+        // Degenerate box: zero width fails validation
+        if let Intent::Primitive(ref mut p) = bad.operations[0] {
+            p.parameters.insert("width".to_string(), 0.0);
+        }
+
+        let batch = serde_json::json!({ "intents": [bad, good] });
+        let result_json = kernel.analyze_batch(&batch.to_string());
+        let result: serde_json::Value = serde_json::from_str(&result_json).unwrap();
+
+        let results = result["results"].as_array().unwrap();
+        assert_eq!(results.len(), 2);
+        assert_eq!(results[0]["status"], "error");
+        assert!(results[0]["error"].is_object());
+        assert_eq!(results[1]["status"], "ok");
+    }
+
     #[test]
     fn test_compile_error_handling() {
         let mut kernel = GeometryKernel::new();
@@ -540,13 +898,13 @@ mod tests {
         let stats_json = kernel.get_cache_stats();
         let stats: serde_json::Value = serde_json::from_str(&stats_json).unwrap();
 
-        assert!(stats["size"].as_i64().unwrap_or(0) > 0);
+        assert!(stats["compiler_cache_size"].as_i64().unwrap_or(0) > 0);
 
         kernel.clear_cache();
         let stats_json = kernel.get_cache_stats();
         let stats: serde_json::Value = serde_json::from_str(&stats_json).unwrap();
 
-        assert_eq!(stats["size"].as_i64().unwrap_or(0), 0);
+        assert_eq!(stats["compiler_cache_size"].as_i64().unwrap_or(0), 0);
     }
 
     #[test]
@@ -602,3 +960,4 @@ mod tests {
         }
     }
 }
+
@@ -0,0 +1,760 @@
+//! Compact binary protocol for the WASM boundary.
+//!
+//! The JSON interface round-trips every intent through `JSON.stringify` on
+//! the TypeScript side and `serde_json` here, which rivals tessellation
+//! time for small parameter edits. This module defines a little-endian
+//! binary framing (mirrored by `lib/geometry/binary-protocol.ts`) carried
+//! as `Uint8Array`, so the hot edit path skips string parsing entirely and
+//! mesh buffers are copied as raw `f32`/`u32` words.
+//!
+//! Wire format (version 1):
+//!
+//! Request (`GeometryIR`):
+//! - magic `QIR` + version byte
+//! - part name (u32 length + UTF-8)
+//! - operation count, then per operation a kind tag
+//!   (0 = primitive, 1 = operation) followed by its fields; numeric
+//!   parameters are raw f64, non-numeric operation parameters fall back
+//!   to an embedded JSON string with a tag byte
+//! - constraint count, then per constraint a type tag + JSON value string
+//!
+//! Response (`CompileResult`):
+//! - magic `QCR` + version byte
+//! - status byte, intent hash, optional error (code + message)
+//! - optional mesh as raw f32 vertex/normal and u32 index arrays
+//! - optional extras (step/topology/mfg_report) as one JSON string —
+//!   these are cold-path fields and not worth a bespoke encoding
+
+use crate::errors::{KernelError, KernelResult};
+use crate::types::{
+    CompileResult, CompileStatus, ConstraintType, GeometryIR, Intent, ManufacturingConstraint,
+    OperationIntent, OperationType, PreviewMesh, PrimitiveIntent, PrimitiveType, Transform,
+};
+use std::collections::HashMap;
+
+pub const PROTOCOL_VERSION: u8 = 1;
+
+const REQUEST_MAGIC: &[u8; 3] = b"QIR";
+const RESPONSE_MAGIC: &[u8; 3] = b"QCR";
+
+// ============ WRITER ============
+
+struct Writer {
+    buf: Vec<u8>,
+}
+
+impl Writer {
+    fn new() -> Self {
+        Writer { buf: Vec::new() }
+    }
+
+    fn u8(&mut self, v: u8) {
+        self.buf.push(v);
+    }
+
+    fn u32(&mut self, v: u32) {
+        self.buf.extend_from_slice(&v.to_le_bytes());
+    }
+
+    fn f64(&mut self, v: f64) {
+        self.buf.extend_from_slice(&v.to_le_bytes());
+    }
+
+    fn string(&mut self, s: &str) {
+        self.u32(s.len() as u32);
+        self.buf.extend_from_slice(s.as_bytes());
+    }
+
+    fn f32_slice(&mut self, values: &[f32]) {
+        self.u32(values.len() as u32);
+        for v in values {
+            self.buf.extend_from_slice(&v.to_le_bytes());
+        }
+    }
+
+    fn u32_slice(&mut self, values: &[u32]) {
+        self.u32(values.len() as u32);
+        for v in values {
+            self.buf.extend_from_slice(&v.to_le_bytes());
+        }
+    }
+}
+
+// ============ READER ============
+
+struct Reader<'a> {
+    buf: &'a [u8],
+    pos: usize,
+}
+
+impl<'a> Reader<'a> {
+    fn new(buf: &'a [u8]) -> Self {
+        Reader { buf, pos: 0 }
+    }
+
+    fn take(&mut self, n: usize) -> KernelResult<&'a [u8]> {
+        if self.pos + n > self.buf.len() {
+            return Err(KernelError::invalid_json(format!(
+                "Binary payload truncated at offset {}",
+                self.pos
+            )));
+        }
+        let slice = &self.buf[self.pos..self.pos + n];
+        self.pos += n;
+        Ok(slice)
+    }
+
+    fn u8(&mut self) -> KernelResult<u8> {
+        Ok(self.take(1)?[0])
+    }
+
+    fn u32(&mut self) -> KernelResult<u32> {
+        let bytes = self.take(4)?;
+        Ok(u32::from_le_bytes([bytes[0], bytes[1], bytes[2], bytes[3]]))
+    }
+
+    fn f64(&mut self) -> KernelResult<f64> {
+        let bytes = self.take(8)?;
+        let mut arr = [0u8; 8];
+        arr.copy_from_slice(bytes);
+        Ok(f64::from_le_bytes(arr))
+    }
+
+    fn string(&mut self) -> KernelResult<String> {
+        let len = self.u32()? as usize;
+        let bytes = self.take(len)?;
+        String::from_utf8(bytes.to_vec())
+            .map_err(|e| KernelError::invalid_json(format!("Invalid UTF-8 in binary payload: {}", e)))
+    }
+
+    fn f32_vec(&mut self) -> KernelResult<Vec<f32>> {
+        let len = self.u32()? as usize;
+        let bytes = self.take(len * 4)?;
+        Ok(bytes
+            .chunks_exact(4)
+            .map(|c| f32::from_le_bytes([c[0], c[1], c[2], c[3]]))
+            .collect())
+    }
+
+    fn u32_vec(&mut self) -> KernelResult<Vec<u32>> {
+        let len = self.u32()? as usize;
+        let bytes = self.take(len * 4)?;
+        Ok(bytes
+            .chunks_exact(4)
+            .map(|c| u32::from_le_bytes([c[0], c[1], c[2], c[3]]))
+            .collect())
+    }
+}
+
+// ============ TYPE TAGS ============
+
+fn primitive_type_tag(type_: &PrimitiveType) -> u8 {
+    match type_ {
+        PrimitiveType::Box => 0,
+        PrimitiveType::Cylinder => 1,
+        PrimitiveType::Sphere => 2,
+        PrimitiveType::Cone => 3,
+        PrimitiveType::Torus => 4,
+    }
+}
+
+fn primitive_type_from_tag(tag: u8) -> KernelResult<PrimitiveType> {
+    match tag {
+        0 => Ok(PrimitiveType::Box),
+        1 => Ok(PrimitiveType::Cylinder),
+        2 => Ok(PrimitiveType::Sphere),
+        3 => Ok(PrimitiveType::Cone),
+        4 => Ok(PrimitiveType::Torus),
+        _ => Err(KernelError::unknown_primitive(format!("tag {}", tag))),
+    }
+}
+
+fn operation_type_tag(type_: &OperationType) -> u8 {
+    match type_ {
+        OperationType::Union => 0,
+        OperationType::Subtract => 1,
+        OperationType::Intersect => 2,
+        OperationType::Fillet => 3,
+        OperationType::Hole => 4,
+        OperationType::Chamfer => 5,
+    }
+}
+
+fn operation_type_from_tag(tag: u8) -> KernelResult<OperationType> {
+    match tag {
+        0 => Ok(OperationType::Union),
+        1 => Ok(OperationType::Subtract),
+        2 => Ok(OperationType::Intersect),
+        3 => Ok(OperationType::Fillet),
+        4 => Ok(OperationType::Hole),
+        5 => Ok(OperationType::Chamfer),
+        _ => Err(KernelError::unknown_operation(format!("tag {}", tag))),
+    }
+}
+
+fn constraint_type_tag(type_: &ConstraintType) -> u8 {
+    match type_ {
+        ConstraintType::MinWallThickness => 0,
+        ConstraintType::ToolDiameter => 1,
+        ConstraintType::MaxOverhang => 2,
+        ConstraintType::Process => 3,
+        ConstraintType::Material => 4,
+    }
+}
+
+fn constraint_type_from_tag(tag: u8) -> KernelResult<ConstraintType> {
+    match tag {
+        0 => Ok(ConstraintType::MinWallThickness),
+        1 => Ok(ConstraintType::ToolDiameter),
+        2 => Ok(ConstraintType::MaxOverhang),
+        3 => Ok(ConstraintType::Process),
+        4 => Ok(ConstraintType::Material),
+        _ => Err(KernelError::invalid_intent(format!(
+            "Unknown constraint type tag {}",
+            tag
+        ))),
+    }
+}
+
+fn status_tag(status: &CompileStatus) -> u8 {
+    match status {
+        CompileStatus::Compiled => 0,
+        CompileStatus::Cached => 1,
+        CompileStatus::Fallback => 2,
+        CompileStatus::Error => 3,
+    }
+}
+
+fn status_from_tag(tag: u8) -> KernelResult<CompileStatus> {
+    match tag {
+        0 => Ok(CompileStatus::Compiled),
+        1 => Ok(CompileStatus::Cached),
+        2 => Ok(CompileStatus::Fallback),
+        3 => Ok(CompileStatus::Error),
+        _ => Err(KernelError::invalid_json(format!(
+            "Unknown status tag {}",
+            tag
+        ))),
+    }
+}
+
+// Transform presence bits
+const HAS_POSITION: u8 = 1;
+const HAS_ROTATION: u8 = 1 << 1;
+const HAS_SCALE: u8 = 1 << 2;
+
+// Operation parameter value kinds
+const PARAM_NUMBER: u8 = 0;
+const PARAM_JSON: u8 = 1;
+
+// ============ REQUEST ENCODING ============
+
+/// Encode a `GeometryIR` into the binary request format.
+///
+/// The TypeScript encoder in `lib/geometry/binary-protocol.ts` produces
+/// byte-identical output; this Rust encoder exists for round-trip tests
+/// and symmetry.
+pub fn encode_geometry_ir(ir: &GeometryIR) -> Vec<u8> {
+    let mut w = Writer::new();
+    w.buf.extend_from_slice(REQUEST_MAGIC);
+    w.u8(PROTOCOL_VERSION);
+    w.string(&ir.part);
+
+    w.u32(ir.operations.len() as u32);
+    for op in &ir.operations {
+        match op {
+            Intent::Primitive(p) => {
+                w.u8(0);
+                encode_primitive(&mut w, p);
+            }
+            Intent::Operation(o) => {
+                w.u8(1);
+                encode_operation(&mut w, o);
+            }
+        }
+    }
+
+    w.u32(ir.constraints.len() as u32);
+    for c in &ir.constraints {
+        w.u8(constraint_type_tag(&c.type_));
+        w.string(&c.value.to_string());
+    }
+
+    w.buf
+}
+
+fn encode_primitive(w: &mut Writer, p: &PrimitiveIntent) {
+    w.string(&p.id);
+    w.u8(primitive_type_tag(&p.type_));
+    w.f64(p.timestamp);
+
+    let mut flags = 0u8;
+    if let Some(t) = &p.transform {
+        if t.position.is_some() {
+            flags |= HAS_POSITION;
+        }
+        if t.rotation.is_some() {
+            flags |= HAS_ROTATION;
+        }
+        if t.scale.is_some() {
+            flags |= HAS_SCALE;
+        }
+    }
+    w.u8(flags);
+    if let Some(t) = &p.transform {
+        for field in [&t.position, &t.rotation, &t.scale].into_iter().flatten() {
+            w.f64(field[0]);
+            w.f64(field[1]);
+            w.f64(field[2]);
+        }
+    }
+
+    // Sorted for deterministic output (parameters live in a HashMap)
+    let mut params: Vec<_> = p.parameters.iter().collect();
+    params.sort_by(|a, b| a.0.cmp(b.0));
+    w.u32(params.len() as u32);
+    for (key, value) in params {
+        w.string(key);
+        w.f64(*value);
+    }
+}
+
+fn encode_operation(w: &mut Writer, o: &OperationIntent) {
+    w.string(&o.id);
+    w.u8(operation_type_tag(&o.type_));
+    w.string(&o.target);
+    match &o.operand {
+        Some(operand) => {
+            w.u8(1);
+            w.string(operand);
+        }
+        None => w.u8(0),
+    }
+    w.f64(o.timestamp);
+
+    let mut params: Vec<_> = o.parameters.iter().collect();
+    params.sort_by(|a, b| a.0.cmp(b.0));
+    w.u32(params.len() as u32);
+    for (key, value) in params {
+        w.string(key);
+        match value.as_f64() {
+            Some(n) => {
+                w.u8(PARAM_NUMBER);
+                w.f64(n);
+            }
+            None => {
+                w.u8(PARAM_JSON);
+                w.string(&value.to_string());
+            }
+        }
+    }
+}
+
+// ============ REQUEST DECODING ============
+
+/// Decode the binary request format into a `GeometryIR`.
+pub fn decode_geometry_ir(bytes: &[u8]) -> KernelResult<GeometryIR> {
+    let mut r = Reader::new(bytes);
+
+    let magic = r.take(3)?;
+    if magic != REQUEST_MAGIC {
+        return Err(KernelError::invalid_json("Bad binary request magic"));
+    }
+    let version = r.u8()?;
+    if version != PROTOCOL_VERSION {
+        return Err(KernelError::invalid_json(format!(
+            "Unsupported binary protocol version {}",
+            version
+        )));
+    }
+
+    let part = r.string()?;
+
+    let op_count = r.u32()? as usize;
+    let mut operations = Vec::with_capacity(op_count);
+    for _ in 0..op_count {
+        let kind = r.u8()?;
+        match kind {
+            0 => operations.push(Intent::Primitive(decode_primitive(&mut r)?)),
+            1 => operations.push(Intent::Operation(decode_operation(&mut r)?)),
+            _ => {
+                return Err(KernelError::invalid_intent(format!(
+                    "Unknown intent kind tag {}",
+                    kind
+                )))
+            }
+        }
+    }
+
+    let constraint_count = r.u32()? as usize;
+    let mut constraints = Vec::with_capacity(constraint_count);
+    for _ in 0..constraint_count {
+        let type_ = constraint_type_from_tag(r.u8()?)?;
+        let value_json = r.string()?;
+        let value = serde_json::from_str(&value_json).map_err(|e| {
+            KernelError::invalid_json(format!("Invalid constraint value JSON: {}", e))
+        })?;
+        constraints.push(ManufacturingConstraint { type_, value });
+    }
+
+    Ok(GeometryIR {
+        part,
+        operations,
+        constraints,
+    })
+}
+
+fn decode_primitive(r: &mut Reader) -> KernelResult<PrimitiveIntent> {
+    let id = r.string()?;
+    let type_ = primitive_type_from_tag(r.u8()?)?;
+    let timestamp = r.f64()?;
+
+    let flags = r.u8()?;
+    let mut read_vec3 = |r: &mut Reader| -> KernelResult<[f64; 3]> {
+        Ok([r.f64()?, r.f64()?, r.f64()?])
+    };
+    let transform = if flags != 0 {
+        Some(Transform {
+            position: if flags & HAS_POSITION != 0 {
+                Some(read_vec3(r)?)
+            } else {
+                None
+            },
+            rotation: if flags & HAS_ROTATION != 0 {
+                Some(read_vec3(r)?)
+            } else {
+                None
+            },
+            scale: if flags & HAS_SCALE != 0 {
+                Some(read_vec3(r)?)
+            } else {
+                None
+            },
+        })
+    } else {
+        None
+    };
+
+    let param_count = r.u32()? as usize;
+    let mut parameters = HashMap::with_capacity(param_count);
+    for _ in 0..param_count {
+        let key = r.string()?;
+        let value = r.f64()?;
+        parameters.insert(key, value);
+    }
+
+    Ok(PrimitiveIntent {
+        id,
+        type_,
+        parameters,
+        transform,
+        timestamp,
+    })
+}
+
+fn decode_operation(r: &mut Reader) -> KernelResult<OperationIntent> {
+    let id = r.string()?;
+    let type_ = operation_type_from_tag(r.u8()?)?;
+    let target = r.string()?;
+    let operand = if r.u8()? != 0 {
+        Some(r.string()?)
+    } else {
+        None
+    };
+    let timestamp = r.f64()?;
+
+    let param_count = r.u32()? as usize;
+    let mut parameters = HashMap::with_capacity(param_count);
+    for _ in 0..param_count {
+        let key = r.string()?;
+        let value = match r.u8()? {
+            PARAM_NUMBER => serde_json::json!(r.f64()?),
+            PARAM_JSON => {
+                let json = r.string()?;
+                serde_json::from_str(&json).map_err(|e| {
+                    KernelError::invalid_json(format!("Invalid parameter JSON: {}", e))
+                })?
+            }
+            tag => {
+                return Err(KernelError::invalid_intent(format!(
+                    "Unknown parameter value tag {}",
+                    tag
+                )))
+            }
+        };
+        parameters.insert(key, value);
+    }
+
+    Ok(OperationIntent {
+        id,
+        type_,
+        target,
+        operand,
+        parameters,
+        timestamp,
+    })
+}
+
+// ============ RESPONSE ENCODING ============
+
+/// Encode a `CompileResult` into the binary response format.
+pub fn encode_compile_result(result: &CompileResult) -> Vec<u8> {
+    let mut w = Writer::new();
+    w.buf.extend_from_slice(RESPONSE_MAGIC);
+    w.u8(PROTOCOL_VERSION);
+    w.u8(status_tag(&result.status));
+    w.string(&result.intent_hash);
+
+    match &result.error {
+        Some(error) => {
+            w.u8(1);
+            w.string(&error.code);
+            w.string(&error.message);
+        }
+        None => w.u8(0),
+    }
+
+    match &result.mesh {
+        Some(mesh) => {
+            w.u8(1);
+            w.f32_slice(&mesh.vertices);
+            w.u32_slice(&mesh.indices);
+            w.f32_slice(&mesh.normals);
+        }
+        None => w.u8(0),
+    }
+
+    // Cold-path fields ride along as one JSON blob when present
+    let has_extras =
+        result.step.is_some() || result.topology.is_some() || result.mfg_report.is_some();
+    if has_extras {
+        w.u8(1);
+        let extras = serde_json::json!({
+            "step": result.step,
+            "topology": result.topology,
+            "mfg_report": result.mfg_report,
+        });
+        w.string(&extras.to_string());
+    } else {
+        w.u8(0);
+    }
+
+    w.buf
+}
+
+/// Encode a bare `KernelError` as an error-status response so callers
+/// always receive a decodable buffer, mirroring the JSON interface's
+/// "always returns valid JSON" guarantee.
+pub fn encode_error_result(error: &KernelError) -> Vec<u8> {
+    encode_compile_result(&CompileResult {
+        status: CompileStatus::Error,
+        intent_hash: String::new(),
+        mesh: None,
+        step: None,
+        topology: None,
+        mfg_report: None,
+        error: Some(error.clone()),
+    })
+}
+
+/// Decode the binary response format (used by round-trip tests; the
+/// production decoder lives in `lib/geometry/binary-protocol.ts`).
+pub fn decode_compile_result(bytes: &[u8]) -> KernelResult<CompileResult> {
+    let mut r = Reader::new(bytes);
+
+    let magic = r.take(3)?;
+    if magic != RESPONSE_MAGIC {
+        return Err(KernelError::invalid_json("Bad binary response magic"));
+    }
+    let version = r.u8()?;
+    if version != PROTOCOL_VERSION {
+        return Err(KernelError::invalid_json(format!(
+            "Unsupported binary protocol version {}",
+            version
+        )));
+    }
+
+    let status = status_from_tag(r.u8()?)?;
+    let intent_hash = r.string()?;
+
+    let error = if r.u8()? != 0 {
+        let code = r.string()?;
+        let message = r.string()?;
+        Some(KernelError {
+            code,
+            message,
+            context: None,
+            hint: None,
+        })
+    } else {
+        None
+    };
+
+    let mesh = if r.u8()? != 0 {
+        Some(PreviewMesh {
+            vertices: r.f32_vec()?,
+            indices: r.u32_vec()?,
+            normals: r.f32_vec()?,
+        })
+    } else {
+        None
+    };
+
+    let (step, topology, mfg_report) = if r.u8()? != 0 {
+        let extras_json = r.string()?;
+        let extras: serde_json::Value = serde_json::from_str(&extras_json)
+            .map_err(|e| KernelError::invalid_json(format!("Invalid extras JSON: {}", e)))?;
+        (
+            serde_json::from_value(extras["step"].clone()).ok(),
+            serde_json::from_value(extras["topology"].clone()).ok(),
+            serde_json::from_value(extras["mfg_report"].clone()).ok(),
+        )
+    } else {
+        (None, None, None)
+    };
+
+    Ok(CompileResult {
+        status,
+        intent_hash,
+        mesh,
+        step,
+        topology,
+        mfg_report,
+        error,
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::types::StepExport;
+
+    fn sample_ir() -> GeometryIR {
+        GeometryIR {
+            part: "bracket".to_string(),
+            operations: vec![
+                Intent::Primitive(PrimitiveIntent {
+                    id: "box1".to_string(),
+                    type_: PrimitiveType::Box,
+                    parameters: vec![
+                        ("width".to_string(), 10.0),
+                        ("height".to_string(), 5.0),
+                        ("depth".to_string(), 2.5),
+                    ]
+                    .into_iter()
+                    .collect(),
+                    transform: Some(Transform {
+                        position: Some([1.0, 2.0, 3.0]),
+                        rotation: None,
+                        scale: Some([1.0, 1.0, 2.0]),
+                    }),
+                    timestamp: 1234.5,
+                }),
+                Intent::Operation(OperationIntent {
+                    id: "hole1".to_string(),
+                    type_: OperationType::Hole,
+                    target: "box1".to_string(),
+                    operand: None,
+                    parameters: vec![
+                        ("diameter".to_string(), serde_json::json!(3.0)),
+                        ("axis".to_string(), serde_json::json!("z")),
+                    ]
+                    .into_iter()
+                    .collect(),
+                    timestamp: 1240.0,
+                }),
+            ],
+            constraints: vec![ManufacturingConstraint {
+                type_: ConstraintType::MinWallThickness,
+                value: serde_json::json!(1.5),
+            }],
+        }
+    }
+
+    #[test]
+    fn test_geometry_ir_round_trip() {
+        let ir = sample_ir();
+        let bytes = encode_geometry_ir(&ir);
+        let decoded = decode_geometry_ir(&bytes).unwrap();
+
+        assert_eq!(decoded.part, ir.part);
+        assert_eq!(decoded.operations.len(), 2);
+        assert_eq!(decoded.constraints.len(), 1);
+
+        match &decoded.operations[0] {
+            Intent::Primitive(p) => {
+                assert_eq!(p.id, "box1");
+                assert_eq!(p.type_, PrimitiveType::Box);
+                assert_eq!(p.parameters["width"], 10.0);
+                let t = p.transform.as_ref().unwrap();
+                assert_eq!(t.position, Some([1.0, 2.0, 3.0]));
+                assert_eq!(t.rotation, None);
+                assert_eq!(t.scale, Some([1.0, 1.0, 2.0]));
+            }
+            _ => panic!("Expected primitive"),
+        }
+
+        match &decoded.operations[1] {
+            Intent::Operation(o) => {
+                assert_eq!(o.type_, OperationType::Hole);
+                assert_eq!(o.operand, None);
+                assert_eq!(o.parameters["diameter"], serde_json::json!(3.0));
+                assert_eq!(o.parameters["axis"], serde_json::json!("z"));
+            }
+            _ => panic!("Expected operation"),
+        }
+    }
+
+    #[test]
+    fn test_compile_result_round_trip() {
+        let result = CompileResult {
+            status: CompileStatus::Compiled,
+            intent_hash: "abc123".to_string(),
+            mesh: Some(PreviewMesh {
+                vertices: vec![0.0, 1.0, 2.0, 3.0, 4.0, 5.0],
+                indices: vec![0, 1, 0],
+                normals: vec![0.0, 0.0, 1.0, 0.0, 0.0, 1.0],
+            }),
+            step: Some(StepExport {
+                content: "ISO-10303-21;".to_string(),
+                entity_count: 7,
+            }),
+            topology: None,
+            mfg_report: None,
+            error: None,
+        };
+
+        let bytes = encode_compile_result(&result);
+        let decoded = decode_compile_result(&bytes).unwrap();
+
+        assert_eq!(decoded.status, CompileStatus::Compiled);
+        assert_eq!(decoded.intent_hash, "abc123");
+        let mesh = decoded.mesh.unwrap();
+        assert_eq!(mesh.vertices, vec![0.0, 1.0, 2.0, 3.0, 4.0, 5.0]);
+        assert_eq!(mesh.indices, vec![0, 1, 0]);
+        assert_eq!(decoded.step.unwrap().entity_count, 7);
+    }
+
+    #[test]
+    fn test_error_result_is_decodable() {
+        let error = KernelError::invalid_intent("no operations");
+        let bytes = encode_error_result(&error);
+        let decoded = decode_compile_result(&bytes).unwrap();
+
+        assert_eq!(decoded.status, CompileStatus::Error);
+        assert_eq!(decoded.error.unwrap().code, "INVALID_INTENT");
+    }
+
+    #[test]
+    fn test_truncated_payload_errors_cleanly() {
+        let bytes = encode_geometry_ir(&sample_ir());
+        let result = decode_geometry_ir(&bytes[..bytes.len() / 2]);
+        assert!(result.is_err());
+    }
+
+    #[test]
+    fn test_bad_magic_rejected() {
+        assert!(decode_geometry_ir(b"XXX\x01").is_err());
+        assert!(decode_compile_result(b"XXX\x01").is_err());
+    }
+}
@@ -0,0 +1,143 @@
+//! Low-overhead timing spans for the compile pipeline.
+//!
+//! The coarse counters in `get_cache_stats` cannot tell where a slow
+//! compile spent its time. Each pipeline stage records a named span
+//! into a fixed-capacity ring buffer; `GeometryKernel::take_perf_spans`
+//! drains it across the WASM boundary so the studio perf HUD can render
+//! a live breakdown. Recording is a clock read and a `VecDeque` push,
+//! cheap enough to stay on in production.
+
+use serde::Serialize;
+use std::collections::VecDeque;
+
+/// Ring buffer capacity; old spans are dropped once full so an
+/// unpolled kernel never grows unbounded
+pub const MAX_SPANS: usize = 256;
+
+/// One timed pipeline stage
+#[derive(Debug, Clone, Serialize)]
+pub struct Span {
+    /// Stage name, e.g. "parse", "evaluate", "cache_lookup"
+    pub name: String,
+    /// Milliseconds since an arbitrary epoch (wall clock on wasm,
+    /// process start natively) — spans are ordered, not absolute
+    pub start_ms: f64,
+    pub duration_ms: f64,
+}
+
+/// Fixed-capacity span ring buffer
+#[derive(Debug, Default)]
+pub struct SpanRecorder {
+    spans: VecDeque<Span>,
+}
+
+impl SpanRecorder {
+    pub fn new() -> Self {
+        SpanRecorder {
+            spans: VecDeque::new(),
+        }
+    }
+
+    /// Record a span that started at `start_ms` and ends now
+    pub fn record(&mut self, name: &str, start_ms: f64) {
+        self.push(Span {
+            name: name.to_string(),
+            start_ms,
+            duration_ms: now_ms() - start_ms,
+        });
+    }
+
+    /// Record a span with an explicit duration
+    pub fn record_with_duration(&mut self, name: &str, start_ms: f64, duration_ms: f64) {
+        self.push(Span {
+            name: name.to_string(),
+            start_ms,
+            duration_ms,
+        });
+    }
+
+    fn push(&mut self, span: Span) {
+        if self.spans.len() >= MAX_SPANS {
+            self.spans.pop_front();
+        }
+        self.spans.push_back(span);
+    }
+
+    /// Move all recorded spans out, oldest first
+    pub fn drain(&mut self) -> Vec<Span> {
+        self.spans.drain(..).collect()
+    }
+
+    /// Append spans recorded elsewhere (e.g. by the compiler) in order
+    pub fn absorb(&mut self, spans: Vec<Span>) {
+        for span in spans {
+            self.push(span);
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.spans.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.spans.is_empty()
+    }
+}
+
+/// Current time in milliseconds
+///
+/// On wasm32 this is `Date.now()`; natively it is elapsed time since
+/// first use. Both are monotonic enough for span durations.
+#[cfg(target_arch = "wasm32")]
+pub fn now_ms() -> f64 {
+    js_sys::Date::now()
+}
+
+#[cfg(not(target_arch = "wasm32"))]
+pub fn now_ms() -> f64 {
+    use std::sync::OnceLock;
+    use std::time::Instant;
+
+    static EPOCH: OnceLock<Instant> = OnceLock::new();
+    EPOCH.get_or_init(Instant::now).elapsed().as_secs_f64() * 1000.0
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_record_and_drain() {
+        let mut recorder = SpanRecorder::new();
+        let start = now_ms();
+        recorder.record("parse", start);
+        recorder.record_with_duration("evaluate", start, 2.5);
+
+        assert_eq!(recorder.len(), 2);
+        let spans = recorder.drain();
+        assert!(recorder.is_empty());
+        assert_eq!(spans[0].name, "parse");
+        assert_eq!(spans[1].name, "evaluate");
+        assert_eq!(spans[1].duration_ms, 2.5);
+    }
+
+    #[test]
+    fn test_ring_buffer_caps_at_max_spans() {
+        let mut recorder = SpanRecorder::new();
+        for i in 0..(MAX_SPANS + 10) {
+            recorder.record_with_duration(&format!("span_{}", i), 0.0, 1.0);
+        }
+
+        assert_eq!(recorder.len(), MAX_SPANS);
+        let spans = recorder.drain();
+        // Oldest entries were dropped
+        assert_eq!(spans[0].name, "span_10");
+    }
+
+    #[test]
+    fn test_now_ms_is_monotonic() {
+        let a = now_ms();
+        let b = now_ms();
+        assert!(b >= a);
+    }
+}
@@ -1,20 +1,102 @@
 // Cadmium Worker - Handles all geometry operations in a background thread
 // This replaces the OCCT worker with lightweight Cadmium-Core (JavaScript fallback)
 
+import { getCadmiumWasmResponse } from '../lib/wasm-preload';
+
 // Try to import Cadmium-Core WASM module, fall back to JavaScript implementation
 let CadmiumCore: any;
 let wasmAvailable = false;
 
+// Minimal module using v128 ops — validates only on SIMD-capable runtimes
+const WASM_SIMD_PROBE = new Uint8Array([
+  0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 10, 1,
+  8, 0, 65, 0, 253, 15, 253, 98, 11,
+]);
+
+function wasmSimdSupported(): boolean {
+  try {
+    return WebAssembly.validate(WASM_SIMD_PROBE);
+  } catch {
+    return false;
+  }
+}
+
+// Warm-start path: stream-compile the scalar binary served from
+// public/, reading bytes from the Cache API entry the main thread
+// prefetches during hydration. compileStreaming also lets Chromium
+// reuse its compiled-code cache keyed on the URL, so repeat visits
+// skip codegen entirely. The glue JS is bundled; only the wasm bytes
+// go through the cache, and a stale binary that no longer matches the
+// glue fails instantiation and falls through to the bundled import.
+async function loadWasmStreaming(): Promise<any | null> {
+  try {
+    const [glue, response]: [any, Response] = await Promise.all([
+      import('../public/wasm/pkg/cadmium_core_bg.js'),
+      getCadmiumWasmResponse(),
+    ]);
+    if (!response.ok) {
+      throw new Error(`Fetching wasm binary failed: HTTP ${response.status}`);
+    }
+
+    const module =
+      'compileStreaming' in WebAssembly
+        ? await WebAssembly.compileStreaming(response)
+        : await WebAssembly.compile(await response.arrayBuffer());
+
+    const instance = await WebAssembly.instantiate(module, {
+      './cadmium_core_bg.js': glue,
+    });
+    glue.__wbg_set_wasm(instance.exports);
+    (instance.exports as any).__wbindgen_start?.();
+    return glue;
+  } catch (error) {
+    console.warn('⚠️ Streaming WASM init failed, using bundled module:', error);
+    return null;
+  }
+}
+
+// Prefer the simd128 artifact when the runtime supports it; the scalar
+// pkg build stays as the universal fallback
+async function loadWasmModule(): Promise<any> {
+  if (wasmSimdSupported()) {
+    try {
+      console.log('🔄 Loading Cadmium SIMD WASM build...');
+      return await import('../../wasm/cadmium-core/pkg-simd');
+    } catch {
+      console.warn('⚠️ SIMD build not available, using scalar build');
+    }
+  }
+
+  const streamed = await loadWasmStreaming();
+  if (streamed) {
+    console.log('✅ Cadmium WASM loaded via streaming compile');
+    return streamed;
+  }
+
+  return import('../../wasm/cadmium-core/pkg');
+}
+
 async function initializeCadmiumCore() {
   try {
     // Try to import the WASM module
     // Using a relative path that Webpack can resolve during bundling
     console.log('🔄 Attempting to load Cadmium WASM module...');
-    const wasmModule = await import('../../wasm/cadmium-core/pkg');
-    
+    const wasmModule = await loadWasmModule();
+
     if (wasmModule && (wasmModule.create_box || wasmModule.default)) {
       CadmiumCore = wasmModule.default || wasmModule;
       wasmAvailable = true;
+
+      // Threaded builds export initThreadPool; rayon needs SharedArrayBuffer,
+      // which is only available on cross-origin-isolated pages
+      if (
+        typeof wasmModule.initThreadPool === 'function' &&
+        (self as any).crossOriginIsolated
+      ) {
+        await wasmModule.initThreadPool(navigator.hardwareConcurrency || 4);
+        console.log('✅ Cadmium thread pool initialized');
+      }
+
       console.log('✅ Cadmium WASM module loaded successfully');
       return true;
     }
@@ -38,10 +120,33 @@ async function initializeCadmiumCore() {
   }
 }
 
+// Geometry-kernel WASM (mesh DFM analysis) is loaded on first use:
+// only ANALYZE_DFM needs it and most sessions never run an analysis
+let geometryKernel: any = null;
+let geometryKernelFailed = false;
+
+async function getGeometryKernel(): Promise<any | null> {
+  if (geometryKernel) return geometryKernel;
+  if (geometryKernelFailed) return null;
+  try {
+    console.log('🔄 Loading geometry kernel for mesh analysis...');
+    const wasmModule: any = await import('../wasm/geometry-kernel/pkg');
+    geometryKernel = new wasmModule.GeometryKernel();
+    console.log('✅ Geometry kernel loaded');
+    return geometryKernel;
+  } catch (error) {
+    console.warn('⚠️ Geometry kernel not available, mesh DFM disabled:', error);
+    geometryKernelFailed = true;
+    return null;
+  }
+}
+
 interface WorkerMessage {
   id: string;
   operation: string;
   payload: any;
+  /** Date.now() on the sending side; lets the worker measure queue wait */
+  sentAt?: number;
 }
 
 interface WorkerResponse {
@@ -66,6 +171,29 @@ let totalCacheSize = 0;
 let isInitialized = false;
 let initializationError: Error | null = null;
 
+// ===== PERF SPANS =====
+// Ring buffer of timed stages (queue wait, cache lookup, execution,
+// transfer prep) drained by GET_PERF_SPANS for the studio perf HUD.
+// Recording is a clock read and an array push — cheap enough to stay
+// on in production.
+
+interface PerfSpan {
+  name: string;
+  operation: string;
+  startMs: number;
+  durationMs: number;
+}
+
+const MAX_PERF_SPANS = 512;
+const perfSpans: PerfSpan[] = [];
+
+function recordSpan(name: string, operation: string, startMs: number, durationMs: number) {
+  if (perfSpans.length >= MAX_PERF_SPANS) {
+    perfSpans.shift();
+  }
+  perfSpans.push({ name, operation, startMs, durationMs });
+}
+
 // Initialize Cadmium-Core (JavaScript implementation)
 async function initialize() {
   try {
@@ -101,10 +229,45 @@ async function initialize() {
   }
 }
 
+// Collect the ArrayBuffers backing any mesh views in a result so they
+// can be moved (not cloned) across the thread boundary.
+function collectMeshTransfers(result: any): Transferable[] {
+  const buffers: Transferable[] = [];
+  const collect = (mesh: any) => {
+    if (!mesh) return;
+    for (const key of ['vertices', 'indices', 'normals']) {
+      const view = mesh[key];
+      if (ArrayBuffer.isView(view) && !buffers.includes(view.buffer)) {
+        buffers.push(view.buffer);
+      }
+    }
+  };
+  collect(result?.mesh);
+  collect(result); // GET_MESH returns the mesh data directly
+
+  // Binary export payloads (streamed STL chunks, 3MF packages)
+  for (const key of ['buffer', 'chunk']) {
+    const view = result?.[key];
+    if (ArrayBuffer.isView(view) && !buffers.includes(view.buffer)) {
+      buffers.push(view.buffer);
+    }
+  }
+
+  return buffers;
+}
+
 // Main message handler
 self.onmessage = async (event: MessageEvent<WorkerMessage>) => {
-  const { id, operation, payload } = event.data;
-  
+  const { id, operation, payload, sentAt } = event.data;
+
+  // Queue wait: time between the main thread posting the message and
+  // this handler running (Date.now on both sides — performance.now
+  // epochs differ between contexts)
+  const receivedAt = performance.now();
+  if (typeof sentAt === 'number') {
+    recordSpan('queue_wait', operation, receivedAt, Math.max(Date.now() - sentAt, 0));
+  }
+
   if (!isInitialized && operation !== 'INIT') {
     self.postMessage({
       id,
@@ -113,18 +276,28 @@ self.onmessage = async (event: MessageEvent<WorkerMessage>) => {
     } as WorkerResponse);
     return;
   }
-  
+
   try {
     const result = await handleOperation(operation, payload);
-    
-    self.postMessage({
-      id,
-      type: 'RESULT',
-      result
-    } as WorkerResponse);
+    recordSpan('execute', operation, receivedAt, performance.now() - receivedAt);
+
+    // Transfer mesh buffers instead of structured-cloning them; the
+    // typed arrays are freshly allocated per response, so the cached
+    // mesh in this worker is unaffected.
+    const transferStart = performance.now();
+    const transfers = collectMeshTransfers(result);
+    (self as unknown as Worker).postMessage(
+      {
+        id,
+        type: 'RESULT',
+        result
+      } as WorkerResponse,
+      transfers
+    );
+    recordSpan('transfer', operation, transferStart, performance.now() - transferStart);
   } catch (error) {
     const errorMessage = error instanceof Error ? error.message : String(error);
-    
+
     self.postMessage({
       id,
       type: 'ERROR',
@@ -211,6 +384,22 @@ async function handleOperation(operation: string, payload: any): Promise<any> {
       };
     }
 
+    case 'IMPORT_MESH': {
+      // Register a mesh under a caller-supplied id. Used by the worker
+      // pool to migrate geometry between worker caches without
+      // changing the id the main thread holds.
+      const { geometryId, mesh: meshData } = payload;
+      const mesh = new CadmiumCore.Mesh(
+        meshData.vertices,
+        meshData.indices,
+        meshData.normals || []
+      );
+
+      addToCache(geometryId, mesh);
+
+      return { geometryId, success: true };
+    }
+
     case 'LOAD_MESH': {
       const { mesh: meshData } = payload;
       const mesh = new CadmiumCore.Mesh(
@@ -378,6 +567,67 @@ async function handleOperation(operation: string, payload: any): Promise<any> {
       return bbox;
     }
     
+    case 'DECIMATE_MESH': {
+      const { geometryId, targetTriangles } = payload;
+      const mesh = getFromCache(geometryId);
+
+      if (!mesh) {
+        throw new Error('Geometry not found in cache');
+      }
+
+      // Quadric decimation lives in the WASM core only; the JavaScript
+      // fallback serves the full-resolution mesh rather than failing
+      if (typeof CadmiumCore.decimate_mesh !== 'function') {
+        return {
+          geometryId,
+          decimated: false,
+          mesh: convertMeshToTransferable(mesh),
+        };
+      }
+
+      const resultMesh = CadmiumCore.decimate_mesh(mesh, targetTriangles || 10000);
+      const resultId = generateGeometryId();
+
+      addToCache(resultId, resultMesh);
+
+      return {
+        geometryId: resultId,
+        decimated: true,
+        mesh: convertMeshToTransferable(resultMesh),
+      };
+    }
+
+    case 'ANALYZE_DFM': {
+      const { geometryId, options } = payload;
+      const mesh = getFromCache(geometryId);
+
+      if (!mesh) {
+        throw new Error('Geometry not found in cache');
+      }
+
+      const kernel = await getGeometryKernel();
+      if (!kernel) {
+        // The parametric constraint checks still run on the main
+        // thread; signal that no mesh-level measurements exist
+        return { geometryId, available: false };
+      }
+
+      const resultJson = kernel.analyze_mesh_dfm(
+        JSON.stringify({
+          vertices: Array.from(mesh.vertices || []),
+          indices: Array.from(mesh.faces || []),
+          options: options || {},
+        })
+      );
+      const result = JSON.parse(resultJson);
+
+      if (result.status !== 'ok') {
+        throw new Error(result.error?.message || 'Mesh DFM analysis failed');
+      }
+
+      return { geometryId, available: true, report: result.report };
+    }
+
     // ===== EXPORT OPERATIONS =====
     case 'EXPORT_STL': {
       const { geometryId, filename } = payload;
@@ -402,7 +652,46 @@ async function handleOperation(operation: string, payload: any): Promise<any> {
       const objContent = CadmiumCore.export_obj(mesh, filename);
       return { content: objContent, format: 'obj' };
     }
-    
+
+    case 'EXPORT_STL_BINARY': {
+      const { geometryId, filename } = payload;
+      const mesh = getFromCache(geometryId);
+
+      if (!mesh) {
+        throw new Error('Geometry not found in cache');
+      }
+
+      const buffer = CadmiumCore.export_stl_binary(mesh, filename);
+      return { buffer, format: 'stl' };
+    }
+
+    case 'EXPORT_STL_CHUNK': {
+      const { geometryId, filename, chunkIndex, chunkTriangles } = payload;
+      const mesh = getFromCache(geometryId);
+
+      if (!mesh) {
+        throw new Error('Geometry not found in cache');
+      }
+
+      // Chunk 0 carries the 84-byte header; chunks concatenate to the
+      // full binary STL, so only one chunk lives in memory at a time.
+      const totalChunks = CadmiumCore.export_stl_chunk_count(mesh, chunkTriangles);
+      const chunk = CadmiumCore.export_stl_binary_chunk(mesh, filename, chunkIndex, chunkTriangles);
+      return { chunk, chunkIndex, totalChunks, format: 'stl' };
+    }
+
+    case 'EXPORT_3MF': {
+      const { geometryId, filename } = payload;
+      const mesh = getFromCache(geometryId);
+
+      if (!mesh) {
+        throw new Error('Geometry not found in cache');
+      }
+
+      const buffer = CadmiumCore.export_3mf(mesh, filename);
+      return { buffer, format: '3mf' };
+    }
+
     // ===== CACHE MANAGEMENT =====
     case 'CLEAR_CACHE': {
       geometryCache.clear();
@@ -414,18 +703,26 @@ async function handleOperation(operation: string, payload: any): Promise<any> {
       const deleted = geometryCache.delete(geometryId);
       return { success: deleted };
     }
-    
+
+    case 'GET_PERF_SPANS': {
+      // Drain: each poll returns only spans recorded since the last one
+      const spans = perfSpans.splice(0, perfSpans.length);
+      return { spans };
+    }
+
     default:
       throw new Error(`Unknown operation: ${operation}`);
   }
 }
 
-// Convert WASM mesh to transferable JavaScript object
+// Convert WASM mesh to transferable typed-array views. Each call
+// allocates fresh buffers so they can be handed to postMessage's
+// transfer list while the source mesh stays cached worker-side.
 function convertMeshToTransferable(mesh: any): any {
   return {
-    vertices: Array.from(mesh.vertices || []),
-    indices: Array.from(mesh.faces || []),
-    normals: Array.from(mesh.normals || [])
+    vertices: new Float32Array(mesh.vertices || []),
+    indices: new Uint32Array(mesh.faces || []),
+    normals: new Float32Array(mesh.normals || [])
   };
 }
 
@@ -515,12 +812,13 @@ function addToCache(id: string, mesh: any) {
 }
 
 function getFromCache(id: string): any | null {
+  const start = performance.now();
   const entry = geometryCache.get(id);
   if (entry) {
     entry.lastAccessed = Date.now();
-    return entry.mesh;
   }
-  return null;
+  recordSpan(entry ? 'cache_hit' : 'cache_miss', 'CACHE_LOOKUP', start, performance.now() - start);
+  return entry ? entry.mesh : null;
 }
 
 // Start initialization
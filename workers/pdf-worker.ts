@@ -0,0 +1,318 @@
+// PDF Worker - Builds quote PDFs in a background thread
+//
+// The quote exporter used to lay out the document on the main thread,
+// which froze the UI for the duration of the export. This worker
+// assembles a dependency-free PDF 1.4 document page by page: each
+// finished page is serialized into its own byte chunk immediately, so
+// memory stays proportional to one page's content stream, and the
+// concatenated result transfers back as a single ArrayBuffer.
+
+interface WorkerMessage {
+  id: string;
+  operation: string;
+  payload: any;
+}
+
+interface WorkerResponse {
+  id: string;
+  result?: any;
+  error?: string;
+  type: 'RESULT' | 'ERROR' | 'READY';
+}
+
+// ===== PDF WRITER =====
+
+const PAGE_WIDTH = 595.28; // A4 portrait, points
+const PAGE_HEIGHT = 841.89;
+const MARGIN = 50;
+
+// PDF string literal: escape delimiters, map the naira sign (not in
+// WinAnsi) to a plain prefix, drop anything else non-encodable
+function pdfEscape(text: string): string {
+  return text
+    .replace(/₦/g, 'NGN ')
+    .replace(/[^\x20-\x7e]/g, '')
+    .replace(/\\/g, '\\\\')
+    .replace(/\(/g, '\\(')
+    .replace(/\)/g, '\\)');
+}
+
+class PdfBuilder {
+  private chunks: Uint8Array[] = [];
+  private offsets: number[] = [];
+  private length = 0;
+  private nextObjectId = 1;
+  private pageIds: number[] = [];
+  private encoder = new TextEncoder();
+
+  // Object ids reserved up front so pages can reference them before
+  // the catalog is written
+  private readonly catalogId = this.reserve();
+  private readonly pagesId = this.reserve();
+  private readonly fontId = this.reserve();
+  private readonly boldFontId = this.reserve();
+
+  constructor() {
+    this.push('%PDF-1.4\n%\xb5\xb5\n');
+  }
+
+  private reserve(): number {
+    return this.nextObjectId++;
+  }
+
+  private push(text: string) {
+    const bytes = this.encoder.encode(text);
+    this.chunks.push(bytes);
+    this.length += bytes.length;
+  }
+
+  private writeObject(id: number, body: string) {
+    this.offsets[id] = this.length;
+    this.push(`${id} 0 obj\n${body}\nendobj\n`);
+  }
+
+  /** Serializes one finished page (content stream + page dict) */
+  addPage(content: string) {
+    const streamId = this.reserve();
+    const pageId = this.reserve();
+    this.writeObject(streamId, `<< /Length ${content.length} >>\nstream\n${content}\nendstream`);
+    this.writeObject(
+      pageId,
+      `<< /Type /Page /Parent ${this.pagesId} 0 R ` +
+        `/MediaBox [0 0 ${PAGE_WIDTH} ${PAGE_HEIGHT}] ` +
+        `/Resources << /Font << /F1 ${this.fontId} 0 R /F2 ${this.boldFontId} 0 R >> >> ` +
+        `/Contents ${streamId} 0 R >>`
+    );
+    this.pageIds.push(pageId);
+  }
+
+  finish(): Uint8Array {
+    this.writeObject(this.fontId, '<< /Type /Font /Subtype /Type1 /BaseFont /Helvetica /Encoding /WinAnsiEncoding >>');
+    this.writeObject(this.boldFontId, '<< /Type /Font /Subtype /Type1 /BaseFont /Helvetica-Bold /Encoding /WinAnsiEncoding >>');
+    this.writeObject(
+      this.pagesId,
+      `<< /Type /Pages /Kids [${this.pageIds.map((id) => `${id} 0 R`).join(' ')}] /Count ${this.pageIds.length} >>`
+    );
+    this.writeObject(this.catalogId, `<< /Type /Catalog /Pages ${this.pagesId} 0 R >>`);
+
+    const xrefOffset = this.length;
+    const count = this.nextObjectId;
+    let xref = `xref\n0 ${count}\n0000000000 65535 f \n`;
+    for (let i = 1; i < count; i++) {
+      xref += `${String(this.offsets[i] ?? 0).padStart(10, '0')} 00000 n \n`;
+    }
+    this.push(
+      `${xref}trailer\n<< /Size ${count} /Root ${this.catalogId} 0 R >>\nstartxref\n${xrefOffset}\n%%EOF\n`
+    );
+
+    const out = new Uint8Array(this.length);
+    let offset = 0;
+    for (const chunk of this.chunks) {
+      out.set(chunk, offset);
+      offset += chunk.length;
+    }
+    return out;
+  }
+}
+
+// Cursor-based page writer; starts a new page when the cursor runs
+// past the bottom margin
+class PageWriter {
+  private ops: string[] = [];
+  y = PAGE_HEIGHT - MARGIN;
+
+  constructor(private pdf: PdfBuilder) {}
+
+  text(x: number, y: number, size: number, value: string, options?: { bold?: boolean; color?: string }) {
+    const font = options?.bold ? 'F2' : 'F1';
+    const color = options?.color ?? '0 0 0';
+    this.ops.push(`BT ${color} rg /${font} ${size} Tf ${x.toFixed(2)} ${y.toFixed(2)} Td (${pdfEscape(value)}) Tj ET`);
+  }
+
+  line(x1: number, y1: number, x2: number, y2: number, width = 0.5, color = '0.85 0.85 0.85') {
+    this.ops.push(`${color} RG ${width} w ${x1.toFixed(2)} ${y1.toFixed(2)} m ${x2.toFixed(2)} ${y2.toFixed(2)} l S`);
+  }
+
+  rect(x: number, y: number, w: number, h: number, color: string) {
+    this.ops.push(`${color} rg ${x.toFixed(2)} ${y.toFixed(2)} ${w.toFixed(2)} ${h.toFixed(2)} re f`);
+  }
+
+  advance(by: number) {
+    this.y -= by;
+    if (this.y < MARGIN + 20) {
+      this.flush();
+      this.y = PAGE_HEIGHT - MARGIN;
+    }
+  }
+
+  flush() {
+    if (this.ops.length > 0) {
+      this.pdf.addPage(this.ops.join('\n'));
+      this.ops = [];
+    }
+  }
+}
+
+// ===== QUOTE LAYOUT =====
+
+const BLUE = '0 0.4 0.8';
+const GREY = '0.4 0.4 0.4';
+
+function formatPrice(amount: number): string {
+  return `NGN ${amount.toLocaleString('en-NG', { minimumFractionDigits: 2, maximumFractionDigits: 2 })}`;
+}
+
+function buildQuotePdf(quote: any, options: { includeBreakdown: boolean; includeNotes: boolean; companyName: string }): Uint8Array {
+  const pdf = new PdfBuilder();
+  const page = new PageWriter(pdf);
+  const right = PAGE_WIDTH - MARGIN;
+  const date = new Date(quote.timestamp).toLocaleDateString('en-NG', {
+    year: 'numeric',
+    month: 'long',
+    day: 'numeric',
+  });
+
+  // Header
+  page.text(MARGIN, page.y - 20, 24, options.companyName, { bold: true, color: BLUE });
+  page.text(MARGIN, page.y - 36, 9, 'Manufacturing Solutions', { color: GREY });
+  page.text(MARGIN, page.y - 48, 9, 'Advanced CNC & Fabrication', { color: GREY });
+  page.text(right - 80, page.y - 20, 18, 'QUOTE', { bold: true });
+  page.text(right - 200, page.y - 36, 9, `Quote ID: ${quote.jobId ?? '-'}`, { color: GREY });
+  page.text(right - 200, page.y - 48, 9, `Date: ${date}`, { color: GREY });
+  page.text(right - 200, page.y - 60, 9, `Valid for: ${quote.pricingValidMinutes} minutes`, { color: GREY });
+  page.advance(70);
+  page.line(MARGIN, page.y, right, page.y, 2, BLUE);
+  page.advance(30);
+
+  // Price summary
+  page.rect(MARGIN, page.y - 70, right - MARGIN, 80, '0.95 0.96 0.97');
+  page.text(MARGIN + 20, page.y - 14, 9, 'Estimated Total', { color: GREY });
+  page.text(MARGIN + 20, page.y - 42, 22, formatPrice(quote.breakdown.totalPrice), { bold: true, color: BLUE });
+  page.text(
+    MARGIN + 20,
+    page.y - 62,
+    9,
+    `Unit Price: ${formatPrice(quote.breakdown.unitPrice)}   |   Lead Time: ${quote.breakdown.leadTimeDays} days`,
+    { color: GREY }
+  );
+  page.advance(100);
+
+  // Part specifications
+  page.text(MARGIN, page.y, 13, 'Part Specifications', { bold: true });
+  page.advance(8);
+  page.line(MARGIN, page.y, right, page.y);
+  page.advance(18);
+
+  const specs: Array<[string, string]> = [
+    ['Geometry Type', String(quote.geometry.type)],
+    ['Volume', `${quote.geometry.volumeCm3} cm3`],
+    ['Material', String(quote.material.name)],
+    ['Process', String(quote.process)],
+    ['Weight', `${quote.material.massKg} kg`],
+    ['Manufacturability', `${quote.manufacturability.score}/100`],
+  ];
+  for (const [label, value] of specs) {
+    page.text(MARGIN, page.y, 10, `${label}:`, { color: GREY });
+    page.text(MARGIN + 150, page.y, 10, value, { bold: true });
+    page.advance(16);
+  }
+  page.advance(14);
+
+  // Cost breakdown
+  if (options.includeBreakdown) {
+    page.text(MARGIN, page.y, 13, 'Cost Breakdown', { bold: true });
+    page.advance(8);
+    page.line(MARGIN, page.y, right, page.y);
+    page.advance(18);
+
+    const wastePercent =
+      quote.breakdown.materialCost > 0
+        ? ((quote.breakdown.materialWaste / quote.breakdown.materialCost) * 100).toFixed(0)
+        : '0';
+    const rows: Array<[string, string, number, boolean]> = [
+      ['Material Cost', `${quote.material.volumeCm3} cm3 @ ${formatPrice(quote.material.pricePerKg)}/kg`, quote.breakdown.materialCost, false],
+      ['Material Waste', `~${wastePercent}%`, quote.breakdown.materialWaste, false],
+      ['Machine Time', `${quote.breakdown.machineTimeMinutes} minutes`, quote.breakdown.machineCost, false],
+      ['Tooling', String(quote.toolpath.machine), quote.breakdown.toolCost, false],
+      ['Labor', 'Setup + Inspection', quote.breakdown.laborCost, false],
+      ['Setup Fee', 'One-time setup', quote.breakdown.setupCost, false],
+      ['Subtotal', '', quote.breakdown.subtotal, true],
+      ['Platform Fee', `${(quote.breakdown.platformFeePercent * 100).toFixed(0)}%`, quote.breakdown.platformFee, false],
+      ['Total', '', quote.breakdown.totalPrice, true],
+    ];
+
+    page.text(MARGIN, page.y, 10, 'Item', { bold: true });
+    page.text(MARGIN + 160, page.y, 10, 'Details', { bold: true });
+    page.text(right - 120, page.y, 10, 'Amount', { bold: true });
+    page.advance(8);
+    page.line(MARGIN, page.y, right, page.y);
+    page.advance(14);
+
+    for (const [item, details, amount, emphasized] of rows) {
+      page.text(MARGIN, page.y, 10, item, { bold: emphasized });
+      page.text(MARGIN + 160, page.y, 9, details, { color: GREY });
+      page.text(right - 120, page.y, 10, formatPrice(amount), {
+        bold: emphasized,
+        color: emphasized ? BLUE : '0 0 0',
+      });
+      page.advance(6);
+      page.line(MARGIN, page.y, right, page.y, emphasized ? 1 : 0.5, emphasized ? '0.2 0.2 0.2' : '0.9 0.9 0.9');
+      page.advance(14);
+    }
+    page.advance(10);
+  }
+
+  // Notes
+  const notes: string[] = options.includeNotes ? (quote.details?.notes ?? []).filter(Boolean) : [];
+  if (notes.length > 0) {
+    page.text(MARGIN, page.y, 12, 'Important Notes', { bold: true });
+    page.advance(16);
+    for (const note of notes) {
+      page.text(MARGIN + 8, page.y, 9, `- ${note}`, { color: '0.52 0.4 0.02' });
+      page.advance(14);
+    }
+    page.advance(10);
+  }
+
+  // Footer
+  page.line(MARGIN, page.y, right, page.y);
+  page.advance(14);
+  page.text(MARGIN, page.y, 8, `This quote is valid for ${quote.pricingValidMinutes} minutes from generation time.`, { color: GREY });
+  page.advance(11);
+  page.text(MARGIN, page.y, 8, 'Final pricing may vary based on final design review and material availability.', { color: GREY });
+  page.advance(11);
+  page.text(MARGIN, page.y, 8, `${options.companyName} - Manufacturing Excellence`, { color: GREY });
+
+  page.flush();
+  return pdf.finish();
+}
+
+// ===== MESSAGE HANDLER =====
+
+self.onmessage = (event: MessageEvent<WorkerMessage>) => {
+  const { id, operation, payload } = event.data;
+
+  try {
+    if (operation === 'GENERATE_QUOTE_PDF') {
+      const bytes = buildQuotePdf(payload.quote, {
+        includeBreakdown: payload.includeBreakdown ?? true,
+        includeNotes: payload.includeNotes ?? true,
+        companyName: payload.companyName ?? 'Qutlas',
+      });
+      const response: WorkerResponse = { id, type: 'RESULT', result: { pdf: bytes.buffer } };
+      (self as unknown as Worker).postMessage(response, [bytes.buffer]);
+      return;
+    }
+
+    throw new Error(`Unknown operation: ${operation}`);
+  } catch (error) {
+    const response: WorkerResponse = {
+      id,
+      type: 'ERROR',
+      error: error instanceof Error ? error.message : String(error),
+    };
+    self.postMessage(response);
+  }
+};
+
+self.postMessage({ type: 'READY' });
@@ -0,0 +1,568 @@
+// Render Worker - Runs the studio viewport's three.js scene off the main
+// thread via OffscreenCanvas, so heavy React work (catalog modals, the
+// manufacturability panel, intent-chat updates) can't drop viewport
+// frames and orbiting a big scene can't stall the UI.
+//
+// Division of labor with the main thread:
+// - OrbitControls needs real DOM events, so the camera lives on the main
+//   thread and its pose is forwarded here as fire-and-forget SET_CAMERA
+//   frames (no reply, no id) whenever it changes.
+// - Everything that needs the scene graph - mesh generation, visual
+//   state, raycast picking, fit-view bounds - happens here. Meshes are
+//   rebuilt worker-side from the same serializable inputs the viewer
+//   used to feed generateMesh directly, so transferable mesh buffers
+//   from the cadmium worker flow through without touching React.
+//
+// The message protocol mirrors cadmium-worker: {id, operation, payload}
+// in, {id, type: 'RESULT' | 'ERROR', result | error} out, with READY
+// posted once on boot. Messages without an id get no reply.
+
+import * as THREE from 'three';
+import {
+  generateMesh,
+  disposeGeneratedMesh,
+  type MeshGeneratorInput,
+} from '../lib/mesh-generator';
+
+interface WorkerMessage {
+  /** Absent on fire-and-forget frames (SET_CAMERA, SYNC_OBJECTS, ...) */
+  id?: string;
+  operation: string;
+  payload: any;
+}
+
+interface WorkerResponse {
+  id: string;
+  result?: any;
+  error?: string;
+  type: 'RESULT' | 'ERROR' | 'READY';
+}
+
+/** Per-object state mirrored from the viewer's SYNC_OBJECTS payloads */
+interface SyncedObject {
+  id: string;
+  geometryKey: string;
+  input: MeshGeneratorInput;
+  visible: boolean;
+  selected: boolean;
+  color?: string;
+}
+
+const SELECTION_COLOR = 0x2a2a72;
+
+let renderer: THREE.WebGLRenderer | null = null;
+let scene: THREE.Scene | null = null;
+let camera: THREE.PerspectiveCamera | null = null;
+let grid: THREE.GridHelper | null = null;
+
+// Workspace meshes keyed by object id, plus the records they were built
+// from so visual state can be reapplied without a resync
+const meshes = new Map<string, THREE.Mesh>();
+const objectRecords = new Map<string, SyncedObject>();
+
+// Meshes streamed through the canvas-utils bridge (AI geometry,
+// progressive LOD refinements) - same registry updateCanvasMesh keeps
+// on the main thread when rendering locally
+const bridgeMeshes = new Map<string, THREE.Mesh>();
+
+const sketchLines: THREE.Line[] = [];
+
+let hoveredId: string | null = null;
+
+const raycaster = new THREE.Raycaster();
+const pickPoint = new THREE.Vector2();
+
+function parseHexColor(color: string | undefined, fallback: number): number {
+  if (!color) return fallback;
+  const normalized = color.startsWith('#') ? color.slice(1) : color;
+  const parsed = Number.parseInt(normalized, 16);
+  return Number.isFinite(parsed) ? parsed : fallback;
+}
+
+// --- Render scheduling -----------------------------------------------
+// The camera only moves when a SET_CAMERA frame arrives, so unlike the
+// main-thread viewer there is no idle polling loop: every state-changing
+// message schedules exactly one coalesced render.
+
+let renderScheduled = false;
+
+const scheduleFrame: (cb: () => void) => void =
+  typeof requestAnimationFrame === 'function'
+    ? (cb) => requestAnimationFrame(() => cb())
+    : (cb) => void setTimeout(cb, 16);
+
+function scheduleRender(): void {
+  if (renderScheduled) return;
+  renderScheduled = true;
+
+  scheduleFrame(() => {
+    renderScheduled = false;
+    if (renderer && scene && camera) {
+      renderer.render(scene, camera);
+    }
+  });
+}
+
+// --- Visual state ----------------------------------------------------
+
+function getOrCreateEdgesMesh(mesh: THREE.Mesh): THREE.LineSegments {
+  const existing = mesh.userData.edgesMesh as THREE.LineSegments | undefined;
+  if (existing) return existing;
+
+  const edges = new THREE.EdgesGeometry(mesh.geometry);
+  const wireframe = new THREE.LineSegments(
+    edges,
+    new THREE.LineBasicMaterial({
+      color: SELECTION_COLOR,
+      transparent: true,
+      opacity: 0.8,
+      depthTest: true,
+    })
+  );
+
+  wireframe.name = 'selection-edges';
+  wireframe.visible = false;
+
+  mesh.add(wireframe);
+  mesh.userData.edgesMesh = wireframe;
+
+  return wireframe;
+}
+
+function applyMeshVisualState(meshId: string): void {
+  const mesh = meshes.get(meshId);
+  const record = objectRecords.get(meshId);
+  if (!mesh || !record) return;
+
+  const isSelected = record.selected;
+  const isHovered = hoveredId === meshId;
+
+  const material = mesh.material as THREE.MeshStandardMaterial;
+  material.color.setHex(parseHexColor(record.color, 0x0077ff));
+
+  if (isSelected) {
+    material.emissive.setHex(SELECTION_COLOR);
+    material.emissiveIntensity = 0.35;
+  } else if (isHovered) {
+    material.emissive.setHex(SELECTION_COLOR);
+    material.emissiveIntensity = 0.18;
+  } else {
+    material.emissive.setHex(0x000000);
+    material.emissiveIntensity = 0;
+  }
+
+  const existingEdgesMesh = mesh.userData.edgesMesh as THREE.LineSegments | undefined;
+
+  if (isSelected || isHovered) {
+    const edgesMesh = existingEdgesMesh ?? getOrCreateEdgesMesh(mesh);
+    edgesMesh.visible = true;
+    const edgesMaterial = edgesMesh.material as THREE.LineBasicMaterial;
+    edgesMaterial.opacity = isSelected ? 0.85 : 0.35;
+  } else if (existingEdgesMesh) {
+    existingEdgesMesh.visible = false;
+  }
+}
+
+// --- Operations ------------------------------------------------------
+
+function handleInit(payload: {
+  canvas: OffscreenCanvas;
+  width: number;
+  height: number;
+  pixelRatio: number;
+  showGrid: boolean;
+  isMobile: boolean;
+}): { ok: true } {
+  const { canvas, width, height, pixelRatio, showGrid, isMobile } = payload;
+
+  scene = new THREE.Scene();
+  scene.background = new THREE.Color(0xf5f5f5);
+
+  camera = new THREE.PerspectiveCamera(50, width / height, 0.1, 10000);
+  camera.position.set(70, 70, 70);
+  camera.lookAt(0, 0, 0);
+
+  renderer = new THREE.WebGLRenderer({
+    canvas: canvas as unknown as HTMLCanvasElement,
+    antialias: true,
+    powerPreference: 'high-performance',
+  });
+  renderer.setPixelRatio(pixelRatio);
+  // updateStyle must stay false: the transferred canvas has no CSS
+  // box and three would throw trying to set style on it
+  renderer.setSize(width, height, false);
+  renderer.shadowMap.enabled = true;
+  renderer.outputColorSpace = THREE.SRGBColorSpace;
+
+  const directionalLight = new THREE.DirectionalLight(0xffffff, 1);
+  directionalLight.position.set(50, 50, 50);
+  directionalLight.castShadow = true;
+  directionalLight.shadow.mapSize.width = isMobile ? 512 : 1024;
+  directionalLight.shadow.mapSize.height = isMobile ? 512 : 1024;
+  scene.add(directionalLight);
+
+  const ambientLight = new THREE.AmbientLight(0xffffff, 0.5);
+  scene.add(ambientLight);
+
+  grid = new THREE.GridHelper(100, 20, 0xcccccc, 0xe0e0e0);
+  grid.visible = showGrid;
+  scene.add(grid);
+
+  if (!isMobile) {
+    const axesHelper = new THREE.AxesHelper(20);
+    scene.add(axesHelper);
+  }
+
+  scheduleRender();
+  return { ok: true };
+}
+
+function handleResize(payload: { width: number; height: number; pixelRatio: number }): void {
+  if (!renderer || !camera) return;
+
+  camera.aspect = payload.width / payload.height;
+  camera.updateProjectionMatrix();
+
+  renderer.setPixelRatio(payload.pixelRatio);
+  renderer.setSize(payload.width, payload.height, false);
+  scheduleRender();
+}
+
+function handleSetCamera(payload: {
+  position: [number, number, number];
+  quaternion: [number, number, number, number];
+  zoom: number;
+}): void {
+  if (!camera) return;
+
+  camera.position.fromArray(payload.position);
+  camera.quaternion.fromArray(payload.quaternion);
+  if (camera.zoom !== payload.zoom) {
+    camera.zoom = payload.zoom;
+    camera.updateProjectionMatrix();
+  }
+  scheduleRender();
+}
+
+function handleSyncObjects(payload: {
+  objects: SyncedObject[];
+  hoveredId: string | null;
+}): void {
+  if (!scene) return;
+
+  if (payload.hoveredId !== undefined) {
+    hoveredId = payload.hoveredId;
+  }
+
+  const nextIds = new Set(payload.objects.map((o) => o.id));
+
+  meshes.forEach((mesh, id) => {
+    if (!nextIds.has(id)) {
+      scene!.remove(mesh);
+      disposeGeneratedMesh(mesh);
+      meshes.delete(id);
+      objectRecords.delete(id);
+    }
+  });
+
+  for (const record of payload.objects) {
+    const existing = meshes.get(record.id);
+
+    if (!existing || existing.userData.geometryKey !== record.geometryKey) {
+      if (existing) {
+        scene.remove(existing);
+        disposeGeneratedMesh(existing);
+        meshes.delete(record.id);
+      }
+
+      const mesh = generateMesh(record.input);
+      mesh.userData.id = record.id;
+      mesh.userData.geometryKey = record.geometryKey;
+      mesh.visible = record.visible;
+
+      scene.add(mesh);
+      meshes.set(record.id, mesh);
+    } else {
+      existing.visible = record.visible;
+    }
+
+    objectRecords.set(record.id, record);
+    applyMeshVisualState(record.id);
+  }
+
+  scheduleRender();
+}
+
+function handleSetVisual(payload: { hoveredId: string | null }): void {
+  const previous = hoveredId;
+  hoveredId = payload.hoveredId;
+
+  if (previous === hoveredId) return;
+
+  if (previous) applyMeshVisualState(previous);
+  if (hoveredId) applyMeshVisualState(hoveredId);
+  scheduleRender();
+}
+
+function handlePick(payload: { x: number; y: number }): string | null {
+  if (!camera) return null;
+
+  pickPoint.set(payload.x, payload.y);
+  raycaster.setFromCamera(pickPoint, camera);
+
+  const pickables: THREE.Object3D[] = [
+    ...meshes.values(),
+    ...bridgeMeshes.values(),
+  ];
+  const intersects = raycaster.intersectObjects(pickables, true);
+
+  for (const hit of intersects) {
+    let obj: THREE.Object3D | null = hit.object;
+    while (obj && !obj.userData.id) {
+      obj = obj.parent;
+    }
+    if (obj?.userData?.id) {
+      return obj.userData.id as string;
+    }
+  }
+
+  return null;
+}
+
+function handleFitView(): { center: [number, number, number]; maxDim: number } | null {
+  const box = new THREE.Box3();
+  let any = false;
+
+  const expand = (mesh: THREE.Mesh) => {
+    if (mesh.visible) {
+      box.expandByObject(mesh);
+      any = true;
+    }
+  };
+  meshes.forEach(expand);
+  bridgeMeshes.forEach(expand);
+
+  if (!any || box.isEmpty()) return null;
+
+  const center = box.getCenter(new THREE.Vector3());
+  const size = box.getSize(new THREE.Vector3());
+
+  return {
+    center: [center.x, center.y, center.z],
+    maxDim: Math.max(size.x, size.y, size.z),
+  };
+}
+
+// Bridge meshes keep updateCanvasMesh's contract: same id swaps the
+// geometry in place so progressive LOD upgrades preserve material and
+// scene membership.
+function handleUpdateMesh(payload: {
+  id: string;
+  mesh: {
+    vertices: Float32Array | number[];
+    indices: Uint32Array | number[];
+    normals?: Float32Array | number[];
+  };
+  color?: number;
+}): void {
+  if (!scene) return;
+
+  const { id, mesh: meshData, color } = payload;
+  if (!meshData?.vertices || !meshData?.indices) return;
+
+  const geometry = new THREE.BufferGeometry();
+
+  const vertices =
+    meshData.vertices instanceof Float32Array
+      ? meshData.vertices
+      : new Float32Array(meshData.vertices);
+  const indices =
+    meshData.indices instanceof Uint32Array
+      ? meshData.indices
+      : new Uint32Array(meshData.indices);
+
+  geometry.setAttribute('position', new THREE.BufferAttribute(vertices, 3));
+  geometry.setIndex(new THREE.BufferAttribute(indices, 1));
+
+  if (meshData.normals) {
+    const normals =
+      meshData.normals instanceof Float32Array
+        ? meshData.normals
+        : new Float32Array(meshData.normals);
+    geometry.setAttribute('normal', new THREE.BufferAttribute(normals, 3));
+  } else {
+    geometry.computeVertexNormals();
+  }
+
+  geometry.computeBoundingSphere();
+
+  const existing = bridgeMeshes.get(id);
+  if (existing) {
+    existing.geometry.dispose();
+    existing.geometry = geometry;
+    if (color !== undefined) {
+      (existing.material as THREE.MeshStandardMaterial).color.setHex(color);
+    }
+    scheduleRender();
+    return;
+  }
+
+  const material = new THREE.MeshStandardMaterial({
+    color: color ?? 0x0077ff,
+    roughness: 0.4,
+    metalness: 0.3,
+    side: THREE.DoubleSide,
+  });
+
+  const mesh = new THREE.Mesh(geometry, material);
+  mesh.userData.id = id;
+  mesh.name = id;
+  mesh.castShadow = true;
+  mesh.receiveShadow = true;
+
+  scene.add(mesh);
+  bridgeMeshes.set(id, mesh);
+  scheduleRender();
+}
+
+function disposeBridgeMesh(mesh: THREE.Mesh): void {
+  mesh.geometry.dispose();
+  const material = mesh.material;
+  if (Array.isArray(material)) {
+    material.forEach((m) => m.dispose());
+  } else {
+    material.dispose();
+  }
+}
+
+function handleRemoveMesh(payload: { id: string }): void {
+  const mesh = bridgeMeshes.get(payload.id);
+  if (!mesh || !scene) return;
+
+  scene.remove(mesh);
+  disposeBridgeMesh(mesh);
+  bridgeMeshes.delete(payload.id);
+  scheduleRender();
+}
+
+function handleClearMeshes(): void {
+  if (!scene) return;
+
+  bridgeMeshes.forEach((mesh) => {
+    scene!.remove(mesh);
+    disposeBridgeMesh(mesh);
+  });
+  bridgeMeshes.clear();
+  scheduleRender();
+}
+
+function handleAddSketchLine(payload: {
+  from: [number, number, number];
+  to: [number, number, number];
+}): void {
+  if (!scene) return;
+
+  const points = [
+    new THREE.Vector3(...payload.from),
+    new THREE.Vector3(...payload.to),
+  ];
+  const geometry = new THREE.BufferGeometry().setFromPoints(points);
+  const material = new THREE.LineBasicMaterial({ color: SELECTION_COLOR });
+  const line = new THREE.Line(geometry, material);
+
+  scene.add(line);
+  sketchLines.push(line);
+  scheduleRender();
+}
+
+function handleClearSketch(): void {
+  if (!scene) return;
+
+  for (const line of sketchLines) {
+    scene.remove(line);
+    line.geometry.dispose();
+    (line.material as THREE.Material).dispose();
+  }
+  sketchLines.length = 0;
+  scheduleRender();
+}
+
+function handleDispose(): void {
+  meshes.forEach((mesh) => {
+    scene?.remove(mesh);
+    disposeGeneratedMesh(mesh);
+  });
+  meshes.clear();
+  objectRecords.clear();
+
+  handleClearMeshes();
+  handleClearSketch();
+
+  renderer?.dispose();
+  renderer = null;
+  scene = null;
+  camera = null;
+  grid = null;
+}
+
+function handleOperation(operation: string, payload: any): any {
+  switch (operation) {
+    case 'INIT':
+      return handleInit(payload);
+    case 'RESIZE':
+      return handleResize(payload);
+    case 'SET_CAMERA':
+      return handleSetCamera(payload);
+    case 'SYNC_OBJECTS':
+      return handleSyncObjects(payload);
+    case 'SET_VISUAL':
+      return handleSetVisual(payload);
+    case 'SET_GRID':
+      if (grid) {
+        grid.visible = Boolean(payload.visible);
+        scheduleRender();
+      }
+      return undefined;
+    case 'PICK':
+      return handlePick(payload);
+    case 'FIT_VIEW':
+      return handleFitView();
+    case 'UPDATE_MESH':
+      return handleUpdateMesh(payload);
+    case 'REMOVE_MESH':
+      return handleRemoveMesh(payload);
+    case 'CLEAR_MESHES':
+      return handleClearMeshes();
+    case 'ADD_SKETCH_LINE':
+      return handleAddSketchLine(payload);
+    case 'CLEAR_SKETCH':
+      return handleClearSketch();
+    case 'DISPOSE':
+      return handleDispose();
+    default:
+      throw new Error(`Unknown render operation: ${operation}`);
+  }
+}
+
+self.onmessage = (event: MessageEvent<WorkerMessage>) => {
+  const { id, operation, payload } = event.data;
+
+  try {
+    const result = handleOperation(operation, payload);
+
+    // High-frequency frames (camera poses, object syncs) come without
+    // an id and expect no reply
+    if (id) {
+      self.postMessage({ id, type: 'RESULT', result } as WorkerResponse);
+    }
+  } catch (error) {
+    const errorMessage = error instanceof Error ? error.message : String(error);
+    if (id) {
+      self.postMessage({ id, type: 'ERROR', error: errorMessage } as WorkerResponse);
+    } else {
+      console.error('❌ Render worker operation failed:', operation, errorMessage);
+    }
+  }
+};
+
+self.postMessage({ type: 'READY' });